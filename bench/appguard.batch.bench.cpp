@@ -0,0 +1,168 @@
+/**
+ * Throughput of micro-batched decisions against the latency the coalescing window adds.
+ *
+ * Closed-loop callers make HTTP decisions against a stand-in server, first as unary calls
+ * and then through `AppGuardBatcher` with growing windows. For each run it prints the
+ * decisions per second and the median and 99th percentile latency, and how much the
+ * median grew over the unary calls.
+ *
+ * Usage: appguard.batch.bench [callers] [seconds] [service time in µs]
+ */
+
+#include "appguard.bench.server.hpp"
+#include "../src/appguard.batcher.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <future>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+using HttpRequestBatcher = AppGuardBatcher<appguard::AppGuardHttpRequest, appguard::AppGuardResponse>;
+// Makes one decision and returns once it is answered.
+using Decide = std::function<void()>;
+
+struct Run
+{
+    double rate;
+    double p50;
+    double p99;
+};
+
+static Run Measure(std::size_t callers, std::chrono::seconds duration, const Decide &decide)
+{
+    std::atomic_bool running{true};
+    std::vector<std::vector<double>> latencies(callers);
+    std::vector<std::thread> threads;
+
+    for (std::size_t i = 0; i < callers; i++)
+    {
+        threads.emplace_back([&, i]()
+                             {
+            while (running.load(std::memory_order_relaxed))
+            {
+                auto start = Clock::now();
+                decide();
+                latencies[i].push_back(std::chrono::duration<double, std::micro>(Clock::now() - start).count());
+            } });
+    }
+
+    std::this_thread::sleep_for(duration);
+    running = false;
+
+    for (auto &thread : threads)
+        thread.join();
+
+    std::vector<double> all;
+    for (auto &samples : latencies)
+        all.insert(all.end(), samples.begin(), samples.end());
+
+    std::sort(all.begin(), all.end());
+
+    if (all.empty())
+        return Run{0, 0, 0};
+
+    return Run{
+        static_cast<double>(all.size()) / static_cast<double>(duration.count()),
+        all[all.size() / 2],
+        all[all.size() * 99 / 100],
+    };
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t callers = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 64;
+    std::chrono::seconds duration(argc > 2 ? std::strtol(argv[2], nullptr, 10) : 5);
+    std::chrono::microseconds service_time(argc > 3 ? std::strtol(argv[3], nullptr, 10) : 0);
+
+    AppGuardBenchServer server(service_time);
+    auto channel = grpc::CreateChannel(server.Address(), grpc::InsecureChannelCredentials());
+    auto stub = appguard::AppGuard::NewStub(channel);
+    channel->WaitForConnected(std::chrono::system_clock::now() + std::chrono::seconds(5));
+
+    const auto request = MakeBenchRequest();
+
+    std::printf("%zu callers, %lld s per run, %lld us service time\n\n",
+                callers,
+                static_cast<long long>(duration.count()),
+                static_cast<long long>(service_time.count()));
+    std::printf("%-16s %14s %10s %10s %14s\n", "mode", "decisions/s", "p50 us", "p99 us", "added p50 us");
+
+    auto unary = Measure(
+        callers,
+        duration,
+        [&]()
+        {
+            grpc::ClientContext context;
+            appguard::AppGuardResponse response;
+            std::promise<void> done;
+
+            stub->experimental_async()->HandleHttpRequest(&context, &request, &response, [&done](grpc::Status)
+                                                          { done.set_value(); });
+            done.get_future().wait();
+        });
+
+    std::printf("%-16s %14.0f %10.0f %10.0f %14s\n", "unary", unary.rate, unary.p50, unary.p99, "-");
+
+    for (auto window : {50, 200, 1000})
+    {
+        HttpRequestBatcher batcher(
+            std::chrono::microseconds(window),
+            64,
+            [&stub](std::vector<appguard::AppGuardHttpRequest> requests,
+                    std::chrono::system_clock::time_point,
+                    HttpRequestBatcher::BatchCallback done)
+            {
+                struct Call
+                {
+                    grpc::ClientContext context;
+                    appguard::AppGuardHttpRequestBatch request;
+                    appguard::AppGuardResponseBatch response;
+                };
+
+                auto call = std::make_shared<Call>();
+
+                for (auto &request : requests)
+                    *call->request.add_requests() = std::move(request);
+
+                stub->experimental_async()->HandleHttpRequestBatch(
+                    &call->context,
+                    &call->request,
+                    &call->response,
+                    [call, done = std::move(done)](grpc::Status status)
+                    {
+                        auto *responses = call->response.mutable_responses();
+                        std::vector<appguard::AppGuardResponse> results(
+                            std::make_move_iterator(responses->begin()),
+                            std::make_move_iterator(responses->end()));
+
+                        done(status, results);
+                    });
+            });
+
+        auto batched = Measure(
+            callers,
+            duration,
+            [&]()
+            {
+                std::promise<void> done;
+
+                batcher.Add(
+                    request,
+                    std::chrono::system_clock::now() + std::chrono::seconds(5),
+                    [&done](const grpc::Status &, appguard::AppGuardResponse &)
+                    { done.set_value(); });
+
+                done.get_future().wait();
+            });
+
+        char mode[32];
+        std::snprintf(mode, sizeof(mode), "batch %d us", window);
+        std::printf("%-16s %14.0f %10.0f %10.0f %14.0f\n", mode, batched.rate, batched.p50, batched.p99, batched.p50 - unary.p50);
+    }
+
+    return 0;
+}
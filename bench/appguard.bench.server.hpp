@@ -0,0 +1,104 @@
+#pragma once
+
+#include "../src/generated/appguard.pb.h"
+#include "../src/generated/appguard.grpc.pb.h"
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <grpcpp/grpcpp.h>
+
+/**
+ * @brief Stand-in AppGuard server for the benchmarks.
+ *
+ * Answers every decision with `ALLOW` after a fixed service time per call, so that the
+ * numbers measure the client and the transport rather than a real firewall.
+ */
+class AppGuardBenchServer final : public appguard::AppGuard::Service
+{
+public:
+    /**
+     * @brief Starts the server on an ephemeral loopback port.
+     *
+     * @param service_time Time spent on each call, batch calls included.
+     */
+    explicit AppGuardBenchServer(std::chrono::microseconds service_time = std::chrono::microseconds(0))
+        : service_time(service_time)
+    {
+        grpc::ServerBuilder builder;
+        builder.AddListeningPort("127.0.0.1:0", grpc::InsecureServerCredentials(), &this->port);
+        builder.RegisterService(this);
+        this->server = builder.BuildAndStart();
+    }
+
+    ~AppGuardBenchServer() override
+    {
+        this->server->Shutdown();
+    }
+
+    /**
+     * @brief Returns the address to connect to.
+     */
+    std::string Address() const { return "127.0.0.1:" + std::to_string(this->port); }
+
+    grpc::Status HandleTcpConnection(
+        grpc::ServerContext *,
+        const appguard::AppGuardTcpConnection *,
+        appguard::AppGuardTcpResponse *) override
+    {
+        this->Serve();
+        return grpc::Status::OK;
+    }
+
+    grpc::Status HandleHttpRequest(
+        grpc::ServerContext *,
+        const appguard::AppGuardHttpRequest *,
+        appguard::AppGuardResponse *response) override
+    {
+        this->Serve();
+        response->set_policy(appguard_commands::FirewallPolicy::ALLOW);
+        return grpc::Status::OK;
+    }
+
+    grpc::Status HandleHttpRequestBatch(
+        grpc::ServerContext *,
+        const appguard::AppGuardHttpRequestBatch *batch,
+        appguard::AppGuardResponseBatch *responses) override
+    {
+        this->Serve();
+
+        for (int i = 0; i < batch->requests_size(); i++)
+            responses->add_responses()->set_policy(appguard_commands::FirewallPolicy::ALLOW);
+
+        return grpc::Status::OK;
+    }
+
+private:
+    void Serve() const
+    {
+        if (this->service_time.count() > 0)
+            std::this_thread::sleep_for(this->service_time);
+    }
+
+    std::chrono::microseconds service_time;
+    int port = 0;
+    std::unique_ptr<grpc::Server> server;
+};
+
+/**
+ * @brief Builds an HTTP request shaped like the ones the module sends.
+ */
+inline appguard::AppGuardHttpRequest MakeBenchRequest()
+{
+    appguard::AppGuardHttpRequest request;
+
+    request.set_token("bench-token");
+    request.set_original_url("/index.html");
+    request.set_method("GET");
+    (*request.mutable_headers())["host"] = "localhost";
+    (*request.mutable_headers())["user-agent"] = "appguard-bench";
+    request.mutable_tcp_info()->mutable_connection()->set_source_ip("127.0.0.1");
+
+    return request;
+}
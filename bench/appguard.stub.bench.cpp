@@ -0,0 +1,145 @@
+/**
+ * Calls per second and heap allocations per call of the ways to make a unary decision.
+ *
+ * Closed-loop callers make HTTP decisions against a stand-in server with a new stub per
+ * call and the synchronous API, as the wrapper used to, then with one shared stub, as its
+ * blocking calls do now, and then with the shared stub and the callback API, which it keeps
+ * for the calls that resume a request on completion, waited on here for comparison. Allocations
+ * are counted by replacing the global `operator new`; they include the stand-in server's,
+ * which are the same in every mode, so the differences are what the client saves.
+ *
+ * Usage: appguard.stub.bench [callers] [seconds]
+ */
+
+#include "appguard.bench.server.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <future>
+#include <new>
+#include <vector>
+
+static std::atomic<std::uint64_t> allocations{0};
+
+void *operator new(std::size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+
+    if (void *ptr = std::malloc(size ? size : 1))
+        return ptr;
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+struct Run
+{
+    double rate;
+    double allocations;
+};
+
+// Makes one decision and returns once it is answered.
+using Decide = std::function<void()>;
+
+static Run Measure(std::size_t callers, std::chrono::seconds duration, const Decide &decide)
+{
+    std::atomic_bool running{true};
+    std::atomic<std::uint64_t> calls{0};
+    std::vector<std::thread> threads;
+
+    auto before = allocations.load();
+
+    for (std::size_t i = 0; i < callers; i++)
+    {
+        threads.emplace_back([&]()
+                             {
+            while (running.load(std::memory_order_relaxed))
+            {
+                decide();
+                calls.fetch_add(1, std::memory_order_relaxed);
+            } });
+    }
+
+    std::this_thread::sleep_for(duration);
+    running = false;
+
+    for (auto &thread : threads)
+        thread.join();
+
+    auto count = std::max<std::uint64_t>(calls.load(), 1);
+
+    return Run{
+        static_cast<double>(count) / static_cast<double>(duration.count()),
+        static_cast<double>(allocations.load() - before) / static_cast<double>(count),
+    };
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t callers = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 16;
+    std::chrono::seconds duration(argc > 2 ? std::strtol(argv[2], nullptr, 10) : 5);
+
+    AppGuardBenchServer server;
+    auto channel = grpc::CreateChannel(server.Address(), grpc::InsecureChannelCredentials());
+    auto stub = appguard::AppGuard::NewStub(channel);
+    channel->WaitForConnected(std::chrono::system_clock::now() + std::chrono::seconds(5));
+
+    const auto request = MakeBenchRequest();
+
+    std::printf("%zu callers, %lld s per run\n\n", callers, static_cast<long long>(duration.count()));
+    std::printf("%-24s %12s %14s %16s\n", "mode", "calls/s", "allocs/call", "allocs saved");
+
+    auto per_call = Measure(
+        callers,
+        duration,
+        [&]()
+        {
+            grpc::ClientContext context;
+            appguard::AppGuardResponse response;
+            appguard::AppGuard::NewStub(channel)->HandleHttpRequest(&context, request, &response);
+        });
+
+    std::printf("%-24s %12.0f %14.1f %16s\n", "new stub, sync", per_call.rate, per_call.allocations, "-");
+
+    auto shared = Measure(
+        callers,
+        duration,
+        [&]()
+        {
+            grpc::ClientContext context;
+            appguard::AppGuardResponse response;
+            stub->HandleHttpRequest(&context, request, &response);
+        });
+
+    std::printf("%-24s %12.0f %14.1f %16.1f\n", "shared stub, sync", shared.rate, shared.allocations, per_call.allocations - shared.allocations);
+
+    auto callback = Measure(
+        callers,
+        duration,
+        [&]()
+        {
+            grpc::ClientContext context;
+            appguard::AppGuardResponse response;
+            std::promise<void> done;
+
+            stub->experimental_async()->HandleHttpRequest(&context, &request, &response, [&done](grpc::Status)
+                                                          { done.set_value(); });
+            done.get_future().wait();
+        });
+
+    std::printf("%-24s %12.0f %14.1f %16.1f\n", "shared stub, callback", callback.rate, callback.allocations, per_call.allocations - callback.allocations);
+
+    return 0;
+}
@@ -0,0 +1,259 @@
+#include "appguard.agent.hpp"
+
+#include <chrono>
+
+struct AppGuardAgent::Slot
+{
+    // Indicates that the slot is assigned to a client.
+    ngx_uint_t used;
+    // CRC32 of the key of the client, checked before the key itself.
+    uint32_t hash;
+    size_t key_len;
+    u_char key[KeyCapacity];
+    // Last time a worker of the client used the slot, in seconds of `Now`.
+    int64_t seen;
+    // Process running the control stream, or 0 if there is none.
+    ngx_pid_t leader;
+    // Time until which the leader holds the slot unless it renews, in seconds of `Now`.
+    int64_t lease;
+    // Set once the server has rejected or de-authorized the client.
+    ngx_uint_t stopped;
+    ngx_uint_t defaults_version;
+    size_t defaults_len;
+    u_char defaults[DefaultsCapacity];
+    size_t token_len;
+    u_char token[TokenCapacity];
+};
+
+/**
+ * @brief Returns the monotonic clock in seconds; it is the same in every process.
+ */
+static int64_t Now()
+{
+    return std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+AppGuardAgent &AppGuardAgent::Instance()
+{
+    static AppGuardAgent instance;
+    return instance;
+}
+
+ngx_shm_zone_t *AppGuardAgent::AddZone(ngx_conf_t *cf, void *tag)
+{
+    static ngx_str_t name = ngx_string("appguard_agent");
+
+    // The slots, plus the slab pool's own bookkeeping.
+    size_t size = sizeof(Slot) * Slots + 8 * ngx_pagesize;
+
+    ngx_shm_zone_t *zone = ngx_shared_memory_add(cf, &name, size, tag);
+    if (zone == nullptr)
+        return nullptr;
+
+    zone->init = AppGuardAgent::InitZone;
+
+    return zone;
+}
+
+ngx_int_t AppGuardAgent::InitZone(ngx_shm_zone_t *zone, void *data)
+{
+    // A zone kept across a reload keeps its slots and their leaders.
+    if (data)
+    {
+        zone->data = data;
+        return NGX_OK;
+    }
+
+    auto *pool = reinterpret_cast<ngx_slab_pool_t *>(zone->shm.addr);
+
+    if (zone->shm.exists)
+    {
+        zone->data = pool->data;
+        return NGX_OK;
+    }
+
+    auto *slots = static_cast<Slot *>(ngx_slab_calloc(pool, sizeof(Slot) * Slots));
+    if (slots == nullptr)
+        return NGX_ERROR;
+
+    pool->data = slots;
+    zone->data = slots;
+
+    return NGX_OK;
+}
+
+void AppGuardAgent::Attach(ngx_shm_zone_t *zone) noexcept
+{
+    this->pool = reinterpret_cast<ngx_slab_pool_t *>(zone->shm.addr);
+    this->slots = static_cast<Slot *>(zone->data);
+}
+
+AppGuardAgent::Slot *AppGuardAgent::Join(const std::string &key)
+{
+    if (!this->pool)
+        return nullptr;
+
+    if (key.size() > KeyCapacity)
+    {
+        ngx_log_error(NGX_LOG_WARN, ngx_cycle->log, 0, "AppGuard: Client key is too large to share with other workers");
+        return nullptr;
+    }
+
+    uint32_t hash = ngx_crc32_long(reinterpret_cast<u_char *>(const_cast<char *>(key.data())), key.size());
+    auto now = Now();
+    Slot *slot = nullptr;
+
+    ngx_shmtx_lock(&this->pool->mutex);
+
+    for (std::size_t i = 0; i < Slots; i++)
+    {
+        auto &candidate = this->slots[i];
+
+        if (candidate.used && candidate.hash == hash && candidate.key_len == key.size() &&
+            ngx_memcmp(candidate.key, key.data(), key.size()) == 0)
+        {
+            slot = &candidate;
+            break;
+        }
+
+        // Slots of clients that no worker uses any more, such as those dropped from the
+        // configuration by a reload, are reclaimed once their leader's lease has run out.
+        bool free = !candidate.used || (candidate.lease < now && now - candidate.seen > SlotExpiry.count());
+
+        if (free && !slot)
+            slot = &candidate;
+    }
+
+    if (slot && (!slot->used || slot->hash != hash || slot->key_len != key.size() ||
+                 ngx_memcmp(slot->key, key.data(), key.size()) != 0))
+    {
+        ngx_memzero(slot, sizeof(Slot));
+        slot->used = 1;
+        slot->hash = hash;
+        slot->key_len = key.size();
+        ngx_memcpy(slot->key, key.data(), key.size());
+    }
+
+    if (slot)
+        slot->seen = now;
+
+    ngx_shmtx_unlock(&this->pool->mutex);
+
+    return slot;
+}
+
+bool AppGuardAgent::TryLead(Slot *slot)
+{
+    auto now = Now();
+
+    ngx_shmtx_lock(&this->pool->mutex);
+
+    // A leader that exits resigns; one that died without resigning is replaced once its
+    // lease runs out, so a recycled PID can't keep the slot.
+    if (slot->leader != ngx_pid && (slot->leader == 0 || slot->lease < now))
+    {
+        slot->leader = ngx_pid;
+        slot->stopped = 0;
+        slot->token_len = 0;
+    }
+
+    bool leading = slot->leader == ngx_pid;
+
+    if (leading)
+        slot->lease = now + LeaseDuration.count();
+
+    slot->seen = now;
+
+    ngx_shmtx_unlock(&this->pool->mutex);
+
+    return leading;
+}
+
+bool AppGuardAgent::Renew(Slot *slot)
+{
+    auto now = Now();
+
+    ngx_shmtx_lock(&this->pool->mutex);
+
+    bool leading = slot->leader == ngx_pid;
+
+    if (leading)
+    {
+        slot->lease = now + LeaseDuration.count();
+        slot->seen = now;
+    }
+
+    ngx_shmtx_unlock(&this->pool->mutex);
+
+    return leading;
+}
+
+void AppGuardAgent::Resign(Slot *slot)
+{
+    ngx_shmtx_lock(&this->pool->mutex);
+
+    if (slot->leader == ngx_pid)
+    {
+        slot->leader = 0;
+        slot->lease = 0;
+    }
+
+    ngx_shmtx_unlock(&this->pool->mutex);
+}
+
+void AppGuardAgent::PublishToken(Slot *slot, const std::string &token)
+{
+    if (token.size() > TokenCapacity)
+    {
+        ngx_log_error(NGX_LOG_ERR, ngx_cycle->log, 0, "AppGuard: Token is too large to share with other workers");
+        return;
+    }
+
+    ngx_shmtx_lock(&this->pool->mutex);
+
+    ngx_memcpy(slot->token, token.data(), token.size());
+    slot->token_len = token.size();
+
+    ngx_shmtx_unlock(&this->pool->mutex);
+}
+
+void AppGuardAgent::PublishDefaults(Slot *slot, const std::string &defaults)
+{
+    if (defaults.size() > DefaultsCapacity)
+        return;
+
+    ngx_shmtx_lock(&this->pool->mutex);
+
+    ngx_memcpy(slot->defaults, defaults.data(), defaults.size());
+    slot->defaults_len = defaults.size();
+    slot->defaults_version++;
+
+    ngx_shmtx_unlock(&this->pool->mutex);
+}
+
+void AppGuardAgent::PublishStopped(Slot *slot)
+{
+    ngx_shmtx_lock(&this->pool->mutex);
+
+    slot->stopped = 1;
+    slot->token_len = 0;
+
+    ngx_shmtx_unlock(&this->pool->mutex);
+}
+
+void AppGuardAgent::Read(Slot *slot, State &state)
+{
+    ngx_shmtx_lock(&this->pool->mutex);
+
+    state.token.assign(reinterpret_cast<const char *>(slot->token), slot->token_len);
+    state.stopped = slot->stopped;
+    slot->seen = Now();
+
+    if (state.defaults_version != slot->defaults_version)
+    {
+        state.defaults.assign(reinterpret_cast<const char *>(slot->defaults), slot->defaults_len);
+        state.defaults_version = slot->defaults_version;
+    }
+
+    ngx_shmtx_unlock(&this->pool->mutex);
+}
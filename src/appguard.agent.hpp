@@ -0,0 +1,138 @@
+#pragma once
+
+extern "C"
+{
+#include <ngx_config.h>
+#include <ngx_core.h>
+}
+
+#include <chrono>
+#include <string>
+
+/**
+ * @brief Shares one control stream per AppGuard client among all workers (`appguard_agent`).
+ *
+ * Every client (installation code and server) gets a slot in a shared memory zone. The
+ * first worker that opens the client becomes the slot's leader: it runs the control
+ * stream and publishes the token and the firewall defaults into the slot. The other
+ * workers follow the slot instead of opening control streams of their own. The leader
+ * holds the slot under a lease it keeps renewing; when it exits or stops renewing, the
+ * next follower to notice takes over, so the control stream survives worker restarts
+ * and reloads. Slots that no worker has used for `SlotExpiry` are reused for new clients.
+ */
+class AppGuardAgent
+{
+public:
+    /// Opaque slot in the shared zone.
+    struct Slot;
+
+    /// Maximum number of clients sharing the zone.
+    static constexpr std::size_t Slots = 16;
+    /// Largest token that can be published.
+    static constexpr std::size_t TokenCapacity = 8192;
+    /// Largest serialized firewall defaults that can be published.
+    static constexpr std::size_t DefaultsCapacity = 256;
+    /// Largest key identifying a client.
+    static constexpr std::size_t KeyCapacity = 512;
+    /// How long the leader holds the slot without renewing its lease.
+    static constexpr std::chrono::seconds LeaseDuration{10};
+    /// How long a slot that no worker uses is kept before it is reused.
+    static constexpr std::chrono::seconds SlotExpiry{60};
+
+    /**
+     * @brief What a follower reads from its slot.
+     */
+    struct State
+    {
+        // The current token; empty while the leader has none.
+        std::string token;
+        // The serialized firewall defaults.
+        std::string defaults;
+        // Incremented each time the leader publishes firewall defaults.
+        ngx_uint_t defaults_version = 0;
+        // Set once the server has rejected or de-authorized the client.
+        bool stopped = false;
+    };
+
+    /**
+     * @brief Returns the per-process agent instance.
+     */
+    static AppGuardAgent &Instance();
+
+    /**
+     * @brief Registers the shared memory zone of the agent.
+     *
+     * @param cf NGINX configuration context.
+     * @param tag Tag of the owning module.
+     * @return The zone, or nullptr on failure.
+     */
+    static ngx_shm_zone_t *AddZone(ngx_conf_t *cf, void *tag);
+
+    /**
+     * @brief Uses the zone in this process; called from the worker process.
+     *
+     * @param zone The zone returned by `AddZone`.
+     */
+    void Attach(ngx_shm_zone_t *zone) noexcept;
+
+    /**
+     * @brief Returns the slot of a client, assigning a free one if needed.
+     *
+     * @param key Identifies the client.
+     * @return The slot, or nullptr if the agent isn't enabled, the key is too large or every slot is taken.
+     */
+    Slot *Join(const std::string &key);
+
+    /**
+     * @brief Makes this process the leader of the slot if it has no leader or its lease ran out.
+     *
+     * @return True if this process leads the slot; its lease is renewed.
+     */
+    bool TryLead(Slot *slot);
+
+    /**
+     * @brief Renews the lease of the leader; called by the leader well within `LeaseDuration`.
+     *
+     * @return False if another process took the slot over.
+     */
+    bool Renew(Slot *slot);
+
+    /**
+     * @brief Gives up the leadership of the slot, if this process holds it.
+     */
+    void Resign(Slot *slot);
+
+    /**
+     * @brief Publishes the token; called by the leader.
+     */
+    void PublishToken(Slot *slot, const std::string &token);
+
+    /**
+     * @brief Publishes the serialized firewall defaults; called by the leader.
+     */
+    void PublishDefaults(Slot *slot, const std::string &defaults);
+
+    /**
+     * @brief Publishes that the client was rejected; followers stop as well.
+     */
+    void PublishStopped(Slot *slot);
+
+    /**
+     * @brief Reads the slot; called by followers.
+     */
+    void Read(Slot *slot, State &state);
+
+private:
+    AppGuardAgent() = default;
+
+    /**
+     * @brief Initializes the zone, or takes over the zone of the previous cycle.
+     */
+    static ngx_int_t InitZone(ngx_shm_zone_t *zone, void *data);
+
+private:
+    // Slab pool of the zone, or nullptr if the agent isn't enabled.
+    ngx_slab_pool_t *pool = nullptr;
+    // Slots at the start of the zone.
+    Slot *slots = nullptr;
+};
@@ -0,0 +1,213 @@
+#pragma once
+
+#include <grpcpp/grpcpp.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Coalesces individual decision calls into batch calls.
+ *
+ * Items added from any thread are collected for at most `window` after the first one
+ * arrives, or until `size` items are waiting, and then handed to the sender as a single
+ * batch. The sender starts one asynchronous batch call and reports the results in the
+ * order of the items; each item's callback then receives its own result.
+ *
+ * @tparam Item Message describing a single decision.
+ * @tparam Result Message answering a single decision.
+ */
+template <typename Item, typename Result>
+class AppGuardBatcher
+{
+public:
+    /// Receives the result of a single item.
+    using Callback = std::function<void(const grpc::Status &, Result &)>;
+    /// Receives the results of a batch, in the order of its items.
+    using BatchCallback = std::function<void(const grpc::Status &, std::vector<Result> &)>;
+    /// Starts a batch call with the given deadline; must invoke the callback exactly once.
+    using Sender = std::function<void(std::vector<Item>, std::chrono::system_clock::time_point, BatchCallback)>;
+
+    /**
+     * @brief Starts the thread collecting batches.
+     *
+     * @param window Longest time an item waits for others to join its batch.
+     * @param size Largest number of items in a batch.
+     * @param sender Starts the batch calls.
+     */
+    AppGuardBatcher(std::chrono::microseconds window, std::size_t size, Sender sender)
+        : window(window), size(size), sender(std::move(sender))
+    {
+        this->thread = std::thread([this]()
+                                   { this->Run(); });
+    }
+
+    /**
+     * @brief Stops the thread; items that haven't been sent fail with `CANCELLED`.
+     */
+    ~AppGuardBatcher()
+    {
+        {
+            std::lock_guard lock(this->mutex);
+            this->running = false;
+        }
+
+        this->cv.notify_all();
+
+        if (this->thread.joinable())
+            this->thread.join();
+
+        grpc::Status status(grpc::StatusCode::CANCELLED, "AppGuard batcher stopped");
+        for (auto &entry : this->entries)
+        {
+            Result result;
+            entry.callback(status, result);
+        }
+    }
+
+    AppGuardBatcher(const AppGuardBatcher &) = delete;
+    AppGuardBatcher &operator=(const AppGuardBatcher &) = delete;
+
+    /**
+     * @brief Queues an item for the next batch.
+     *
+     * @param item The decision to make.
+     * @param deadline Deadline of the item; a batch uses the earliest deadline of its items.
+     * @param callback Invoked with the item's result.
+     */
+    void Add(Item item, std::chrono::system_clock::time_point deadline, Callback callback)
+    {
+        bool wakeup;
+        {
+            std::lock_guard lock(this->mutex);
+
+            this->entries.push_back({std::move(item), deadline, std::move(callback), std::chrono::steady_clock::now()});
+
+            // The thread waits for the first item, then for the window or a full batch.
+            wakeup = this->entries.size() == 1 || this->entries.size() >= this->size;
+        }
+
+        if (wakeup)
+            this->cv.notify_one();
+    }
+
+private:
+    /**
+     * @brief A queued item with its deadline and callback.
+     */
+    struct Entry
+    {
+        Item item;
+        std::chrono::system_clock::time_point deadline;
+        Callback callback;
+        // When the item was queued; the window of a batch runs from its oldest item.
+        std::chrono::steady_clock::time_point arrived;
+    };
+
+    /**
+     * @brief Body of the thread collecting batches.
+     */
+    void Run()
+    {
+        std::unique_lock lock(this->mutex);
+
+        while (true)
+        {
+            this->cv.wait(lock, [this]
+                          { return !this->running || !this->entries.empty(); });
+
+            if (!this->running)
+                return;
+
+            this->cv.wait_until(lock, this->entries.front().arrived + this->window, [this]
+                                { return !this->running || this->entries.size() >= this->size; });
+
+            if (!this->running)
+                return;
+
+            std::vector<Entry> batch;
+
+            if (this->entries.size() > this->size)
+            {
+                auto end = this->entries.begin() + this->size;
+                batch.assign(std::make_move_iterator(this->entries.begin()), std::make_move_iterator(end));
+                // The items left over keep the window they opened on arrival.
+                this->entries.erase(this->entries.begin(), end);
+            }
+            else
+            {
+                batch.swap(this->entries);
+            }
+
+            lock.unlock();
+            this->Send(std::move(batch));
+            lock.lock();
+        }
+    }
+
+    /**
+     * @brief Hands a batch to the sender and dispatches its results.
+     */
+    void Send(std::vector<Entry> batch)
+    {
+        auto deadline = std::chrono::system_clock::time_point::max();
+        std::vector<Item> items;
+        std::vector<Callback> callbacks;
+
+        items.reserve(batch.size());
+        callbacks.reserve(batch.size());
+
+        for (auto &entry : batch)
+        {
+            deadline = std::min(deadline, entry.deadline);
+            items.push_back(std::move(entry.item));
+            callbacks.push_back(std::move(entry.callback));
+        }
+
+        this->sender(
+            std::move(items),
+            deadline,
+            [callbacks = std::move(callbacks)](const grpc::Status &status, std::vector<Result> &results)
+            {
+                for (std::size_t i = 0; i < callbacks.size(); i++)
+                {
+                    if (!status.ok())
+                    {
+                        Result result;
+                        callbacks[i](status, result);
+                    }
+                    else if (i < results.size())
+                    {
+                        callbacks[i](status, results[i]);
+                    }
+                    else
+                    {
+                        Result result;
+                        callbacks[i](grpc::Status(grpc::StatusCode::INTERNAL, "AppGuard batch response is incomplete"), result);
+                    }
+                }
+            });
+    }
+
+private:
+    // Longest time an item waits for others to join its batch.
+    const std::chrono::microseconds window;
+    // Largest number of items in a batch.
+    const std::size_t size;
+    // Starts the batch calls.
+    const Sender sender;
+    // Protects the queued items.
+    std::mutex mutex;
+    // Signals the thread about new items or shutdown.
+    std::condition_variable cv;
+    // Items waiting for the next batch.
+    std::vector<Entry> entries;
+    // Indicates that the thread should keep running.
+    bool running = true;
+    // Thread collecting batches.
+    std::thread thread;
+};
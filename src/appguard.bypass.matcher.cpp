@@ -0,0 +1,173 @@
+#include "appguard.bypass.matcher.hpp"
+
+#include <algorithm>
+#include <array>
+
+bool AppGuardBypassMatcher::Add(std::string_view pattern, std::string &error)
+{
+    if (pattern.empty())
+    {
+        error = "empty pattern";
+        return false;
+    }
+
+    if (pattern.size() > 2 && pattern.substr(0, 2) == "*.")
+    {
+        if (pattern.size() - 2 > MaxExtensionLength)
+        {
+            error = "extension is too long";
+            return false;
+        }
+
+        std::string extension(pattern.substr(2));
+        std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c)
+                       { return static_cast<char>(std::tolower(c)); });
+
+        this->max_extension_length = std::max(this->max_extension_length, extension.size());
+        this->extensions.push_back(std::move(extension));
+        return true;
+    }
+
+    if (pattern[0] == '~')
+    {
+        bool caseless = pattern.size() > 1 && pattern[1] == '*';
+        auto regex = pattern.substr(caseless ? 2 : 1);
+
+        if (!this->regexes)
+        {
+            RE2::Options options;
+            options.set_log_errors(false);
+            this->regexes = std::make_unique<RE2::Set>(options, RE2::UNANCHORED);
+        }
+
+        std::string expression = caseless ? "(?i)" + std::string(regex) : std::string(regex);
+
+        if (this->regexes->Add(expression, &error) == -1)
+            return false;
+
+        return true;
+    }
+
+    this->AddPrefix(pattern);
+    return true;
+}
+
+bool AppGuardBypassMatcher::Compile(std::string &error)
+{
+    if (this->compiled)
+        return true;
+
+    this->compiled = true;
+
+    std::sort(this->extensions.begin(), this->extensions.end());
+    this->extensions.erase(
+        std::unique(this->extensions.begin(), this->extensions.end()),
+        this->extensions.end());
+
+    if (this->regexes && !this->regexes->Compile())
+    {
+        error = "failed to compile regular expressions";
+        return false;
+    }
+
+    return true;
+}
+
+bool AppGuardBypassMatcher::Matches(const ngx_str_t &uri) const
+{
+    if (this->MatchesPrefix(uri) || this->MatchesExtension(uri))
+        return true;
+
+    if (this->regexes)
+    {
+        re2::StringPiece text(reinterpret_cast<const char *>(uri.data), uri.len);
+        return this->regexes->Match(text, nullptr);
+    }
+
+    return false;
+}
+
+void AppGuardBypassMatcher::AddPrefix(std::string_view prefix)
+{
+    uint32_t node = 0;
+
+    for (u_char byte : prefix)
+    {
+        auto &children = this->trie[node].children;
+        auto child = std::find_if(children.begin(), children.end(), [byte](const auto &entry)
+                                  { return entry.first == byte; });
+
+        if (child != children.end())
+        {
+            node = child->second;
+            continue;
+        }
+
+        auto next = static_cast<uint32_t>(this->trie.size());
+        children.emplace_back(byte, next);
+        this->trie.emplace_back();
+        node = next;
+    }
+
+    this->trie[node].terminal = true;
+}
+
+bool AppGuardBypassMatcher::MatchesPrefix(const ngx_str_t &uri) const
+{
+    uint32_t node = 0;
+
+    for (size_t i = 0; i < uri.len; i++)
+    {
+        const auto &children = this->trie[node].children;
+        auto child = std::find_if(children.begin(), children.end(), [byte = uri.data[i]](const auto &entry)
+                                  { return entry.first == byte; });
+
+        if (child == children.end())
+            return false;
+
+        node = child->second;
+
+        if (this->trie[node].terminal)
+            return true;
+    }
+
+    return false;
+}
+
+bool AppGuardBypassMatcher::MatchesExtension(const ngx_str_t &uri) const
+{
+    if (this->extensions.empty())
+        return false;
+
+    size_t dot = uri.len;
+    for (size_t i = uri.len; i > 0; i--)
+    {
+        u_char c = uri.data[i - 1];
+
+        if (c == '/')
+            return false;
+
+        if (c == '.')
+        {
+            dot = i - 1;
+            break;
+        }
+    }
+
+    if (dot == uri.len)
+        return false;
+
+    size_t length = uri.len - dot - 1;
+    if (length == 0 || length > this->max_extension_length)
+        return false;
+
+    std::array<char, MaxExtensionLength> buffer;
+
+    for (size_t i = 0; i < length; i++)
+        buffer[i] = static_cast<char>(ngx_tolower(uri.data[dot + 1 + i]));
+
+    std::string_view extension(buffer.data(), length);
+    return std::binary_search(this->extensions.begin(), this->extensions.end(), extension,
+                              [](std::string_view a, std::string_view b)
+                              { return a < b; });
+}
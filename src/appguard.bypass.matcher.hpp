@@ -0,0 +1,98 @@
+#pragma once
+
+extern "C"
+{
+#include <ngx_config.h>
+#include <ngx_core.h>
+}
+
+#include <re2/re2.h>
+#include <re2/set.h>
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Matches request URIs against the `appguard_bypass` patterns.
+ *
+ * Patterns are compiled once at configuration time: prefixes into a trie, extensions into
+ * a sorted list, and regular expressions into a single `RE2::Set`, so a lookup is a single
+ * pass over the URI bytes for each kind of pattern and never copies the URI.
+ *
+ * Pattern syntax:
+ *  - `*.ext`  matches URIs whose last path segment ends with `.ext` (case-insensitive);
+ *  - `~regex` matches URIs containing a match of `regex` (`~*` for case-insensitive);
+ *  - anything else is a prefix of the URI.
+ */
+class AppGuardBypassMatcher
+{
+public:
+    /// Longest supported extension.
+    static constexpr size_t MaxExtensionLength = 32;
+
+    /**
+     * @brief Adds a pattern; must be called before `Compile`.
+     *
+     * @param pattern The pattern as written in the configuration.
+     * @param error Receives a description of the problem on failure.
+     * @return True on success.
+     */
+    bool Add(std::string_view pattern, std::string &error);
+
+    /**
+     * @brief Compiles the regular expressions; does nothing if already compiled.
+     *
+     * @param error Receives a description of the problem on failure.
+     * @return True on success.
+     */
+    bool Compile(std::string &error);
+
+    /**
+     * @brief Checks whether a URI matches any pattern.
+     *
+     * @param uri The request URI (path without arguments).
+     * @return True if the request should bypass AppGuard.
+     */
+    bool Matches(const ngx_str_t &uri) const;
+
+private:
+    /**
+     * @brief Node of the prefix trie; children are few, so they are scanned linearly.
+     */
+    struct TrieNode
+    {
+        // Pairs of the next byte and the index of the child node.
+        std::vector<std::pair<u_char, uint32_t>> children;
+        // Indicates that a prefix ends at this node.
+        bool terminal = false;
+    };
+
+    /**
+     * @brief Adds a prefix to the trie.
+     */
+    void AddPrefix(std::string_view prefix);
+
+    /**
+     * @brief Checks whether the URI starts with any of the prefixes.
+     */
+    bool MatchesPrefix(const ngx_str_t &uri) const;
+
+    /**
+     * @brief Checks whether the URI ends with any of the extensions.
+     */
+    bool MatchesExtension(const ngx_str_t &uri) const;
+
+private:
+    // Prefix trie; the first node is the root.
+    std::vector<TrieNode> trie{1};
+    // Lowercase extensions without the dot, sorted once compiled.
+    std::vector<std::string> extensions;
+    // Length of the longest extension.
+    size_t max_extension_length = 0;
+    // Regular expressions; nullptr if there are none.
+    std::unique_ptr<RE2::Set> regexes;
+    // Indicates that `Compile` has been called.
+    bool compiled = false;
+};
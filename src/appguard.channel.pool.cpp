@@ -0,0 +1,454 @@
+extern "C"
+{
+#include <ngx_config.h>
+#include <ngx_core.h>
+}
+
+#include "appguard.channel.pool.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <netdb.h>
+#include <arpa/inet.h>
+
+// Time constant of the latency average; samples this old weigh 1/e of a fresh one.
+static constexpr double LatencyDecay = 10e9;
+
+static inline std::int64_t Now() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+static std::minstd_rand &Random()
+{
+    static thread_local std::minstd_rand random(std::random_device{}());
+    return random;
+}
+
+/**
+ * @brief Expands a host name with several addresses into one target per address.
+ *
+ * @return Pairs of target and authority; the authority is empty when the target is `addr` itself.
+ */
+static std::vector<std::pair<std::string, std::string>> Resolve(const std::string &addr)
+{
+    std::vector<std::pair<std::string, std::string>> targets;
+
+    auto colon = addr.rfind(':');
+
+    // URIs, IPv6 literals and addresses without a port are left to gRPC's own resolver.
+    if (addr.find("://") != std::string::npos || addr.rfind("unix:", 0) == 0 ||
+        addr.rfind('[', 0) == 0 || colon == std::string::npos)
+    {
+        targets.emplace_back(addr, "");
+        return targets;
+    }
+
+    auto host = addr.substr(0, colon);
+    auto port = addr.substr(colon + 1);
+
+    in_addr ipv4;
+    if (inet_pton(AF_INET, host.c_str(), &ipv4) == 1)
+    {
+        targets.emplace_back(addr, "");
+        return targets;
+    }
+
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+
+    addrinfo *result = nullptr;
+    if (getaddrinfo(host.c_str(), port.c_str(), &hints, &result) == 0)
+    {
+        for (addrinfo *ai = result; ai; ai = ai->ai_next)
+        {
+            char ip[NI_MAXHOST];
+            if (getnameinfo(ai->ai_addr, ai->ai_addrlen, ip, sizeof(ip), nullptr, 0, NI_NUMERICHOST) != 0)
+                continue;
+
+            auto target = ai->ai_family == AF_INET6
+                              ? "[" + std::string(ip) + "]:" + port
+                              : std::string(ip) + ":" + port;
+
+            auto same = [&target](const auto &other)
+            { return other.first == target; };
+
+            if (std::none_of(targets.begin(), targets.end(), same))
+                targets.emplace_back(std::move(target), addr);
+        }
+
+        freeaddrinfo(result);
+    }
+
+    // A single address gains nothing over letting gRPC resolve the name and track its changes.
+    if (targets.size() <= 1)
+    {
+        targets.clear();
+        targets.emplace_back(addr, "");
+    }
+
+    return targets;
+}
+
+AppGuardChannelPool::Lease::Lease(Member *member, bool probe) noexcept
+    : member(member), start(std::chrono::steady_clock::now()), probe(probe)
+{
+    member->outstanding++;
+    member->backend->outstanding++;
+}
+
+void AppGuardChannelPool::Lease::Release() noexcept
+{
+    if (!this->member)
+        return;
+
+    this->member->outstanding--;
+    this->member->backend->outstanding--;
+
+    // A probe that never completed lets the next call probe instead.
+    if (this->probe)
+        this->member->backend->probing.store(false, std::memory_order_release);
+
+    this->member = nullptr;
+}
+
+void AppGuardChannelPool::Lease::Complete(const grpc::Status &status)
+{
+    if (!this->member)
+        return;
+
+    Backend *backend = this->member->backend;
+    std::int64_t now = Now();
+
+    switch (status.error_code())
+    {
+    case grpc::StatusCode::UNAVAILABLE:
+    case grpc::StatusCode::DEADLINE_EXCEEDED:
+    case grpc::StatusCode::INTERNAL:
+    case grpc::StatusCode::UNKNOWN:
+    case grpc::StatusCode::RESOURCE_EXHAUSTED:
+        if (this->probe || backend->failures.fetch_add(1, std::memory_order_relaxed) + 1 >= OpenAfter)
+            AppGuardChannelPool::Trip(backend, now);
+        break;
+
+    case grpc::StatusCode::CANCELLED:
+        // Says nothing about the backend, nor about its latency.
+        this->Release();
+        return;
+
+    default:
+        backend->failures.store(0, std::memory_order_relaxed);
+
+        if (this->probe)
+        {
+            backend->circuit.store(Circuit::Closed, std::memory_order_relaxed);
+
+            ngx_log_error(
+                NGX_LOG_NOTICE,
+                ngx_cycle->log,
+                0,
+                "AppGuard: Backend %s recovered; closing its circuit",
+                backend->addr.c_str());
+        }
+        break;
+    }
+
+    // Concurrent completions may overwrite each other's sample, which only costs a sample.
+    std::int64_t rtt = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           std::chrono::steady_clock::now() - this->start)
+                           .count();
+    std::int64_t latency = backend->latency.load(std::memory_order_relaxed);
+
+    if (latency == 0 || rtt > latency)
+    {
+        latency = rtt;
+    }
+    else
+    {
+        double elapsed = static_cast<double>(now - backend->sampled.load(std::memory_order_relaxed));
+        double weight = std::exp(-std::max(elapsed, 0.0) / LatencyDecay);
+
+        latency = static_cast<std::int64_t>(latency * weight + rtt * (1.0 - weight));
+    }
+
+    backend->latency.store(latency, std::memory_order_relaxed);
+    backend->sampled.store(now, std::memory_order_relaxed);
+
+    this->Release();
+}
+
+AppGuardChannelPool::AppGuardChannelPool(
+    const std::vector<std::string> &addrs,
+    const std::shared_ptr<grpc::ChannelCredentials> &credentials,
+    std::size_t count)
+{
+    count = std::max<std::size_t>(count, 1);
+
+    for (const auto &addr : addrs)
+    {
+        for (const auto &[target, authority] : Resolve(addr))
+        {
+            auto backend = std::make_unique<Backend>();
+            backend->addr = target;
+
+            for (std::size_t i = 0; i < count; i++)
+            {
+                grpc::ChannelArguments args;
+                args.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+                args.SetInt("appguard.channel_index", static_cast<int>(i));
+
+                // Backends resolved from a name still present it to the server and its certificate.
+                if (!authority.empty())
+                {
+                    args.SetString(GRPC_ARG_DEFAULT_AUTHORITY, authority);
+                    args.SetSslTargetNameOverride(authority.substr(0, authority.rfind(':')));
+                }
+
+                auto member = std::make_unique<Member>();
+                member->backend = backend.get();
+                member->channel = grpc::CreateCustomChannel(target, credentials, args);
+                member->stub = appguard::AppGuard::NewStub(member->channel);
+
+                backend->members.push_back(std::move(member));
+            }
+
+            this->backends.push_back(std::move(backend));
+        }
+    }
+}
+
+void AppGuardChannelPool::Connect()
+{
+    for (const auto &backend : this->backends)
+        for (const auto &member : backend->members)
+            member->channel->GetState(true);
+}
+
+bool AppGuardChannelPool::Open() const noexcept
+{
+    std::int64_t now = Now();
+
+    for (const auto &backend : this->backends)
+    {
+        switch (backend->circuit.load(std::memory_order_relaxed))
+        {
+        case Circuit::Closed:
+            return false;
+        case Circuit::Open:
+            if (backend->open_until.load(std::memory_order_relaxed) <= now)
+                return false;
+            break;
+        case Circuit::HalfOpen:
+            if (!backend->probing.load(std::memory_order_relaxed))
+                return false;
+            break;
+        }
+    }
+
+    return true;
+}
+
+AppGuardChannelPool::Lease AppGuardChannelPool::Acquire()
+{
+    std::size_t count = this->backends.size();
+    Backend *backend = this->backends[0].get();
+
+    bool probe = false;
+
+    auto cost = [](const Backend *backend)
+    {
+        auto latency = static_cast<double>(std::max<std::int64_t>(backend->latency.load(std::memory_order_relaxed), 1));
+        return latency * static_cast<double>(backend->outstanding.load(std::memory_order_relaxed) + 1);
+    };
+
+    if (count > 1)
+    {
+        // Power of two choices: compare two distinct backends picked at random.
+        auto &random = Random();
+        std::size_t a = random() % count;
+        std::size_t b = random() % (count - 1);
+        b += b >= a;
+
+        Backend *first = this->backends[a].get();
+        Backend *second = this->backends[b].get();
+        std::int64_t now = Now();
+
+        // A tripped backend that is due for a probe gets it ahead of the closed ones, so
+        // that it rejoins the rotation once it recovers instead of waiting for every other
+        // backend to fail as well.
+        if (!Closed(first) && TryProbe(first, now))
+        {
+            backend = first;
+            probe = true;
+        }
+        else if (!Closed(second) && TryProbe(second, now))
+        {
+            backend = second;
+            probe = true;
+        }
+        else if (Closed(first) && Closed(second))
+        {
+            backend = cost(first) <= cost(second) ? first : second;
+        }
+        else if (Closed(first) || Closed(second))
+        {
+            backend = Closed(first) ? first : second;
+        }
+        else
+        {
+            // Both are open: fall back to the cheapest closed backend, if any.
+            backend = nullptr;
+
+            for (const auto &candidate : this->backends)
+            {
+                if (Closed(candidate.get()) && (!backend || cost(candidate.get()) < cost(backend)))
+                    backend = candidate.get();
+            }
+        }
+    }
+    else if (!Closed(backend))
+    {
+        backend = nullptr;
+    }
+
+    // Every circuit is open: the call goes through only as the probe of a backend.
+    if (!backend)
+    {
+        std::int64_t now = Now();
+
+        for (const auto &candidate : this->backends)
+        {
+            if (TryProbe(candidate.get(), now))
+            {
+                backend = candidate.get();
+                probe = true;
+                break;
+            }
+        }
+
+        if (!backend)
+            return Lease();
+    }
+
+    std::size_t members = backend->members.size();
+    std::size_t start = members > 1 ? Random()() % members : 0;
+
+    Member *best = backend->members[start].get();
+    std::size_t best_outstanding = best->outstanding.load(std::memory_order_relaxed);
+
+    for (std::size_t i = 1; i < members && best_outstanding > 0; i++)
+    {
+        Member *member = backend->members[(start + i) % members].get();
+        std::size_t outstanding = member->outstanding.load(std::memory_order_relaxed);
+
+        if (outstanding < best_outstanding)
+        {
+            best = member;
+            best_outstanding = outstanding;
+        }
+    }
+
+    return Lease(best, probe);
+}
+
+AppGuardChannelPool::Lease AppGuardChannelPool::Acquire(const std::shared_ptr<grpc::Channel> &channel)
+{
+    for (const auto &backend : this->backends)
+    {
+        if (backend->members[0]->channel != channel)
+            continue;
+
+        if (Closed(backend.get()))
+            return Lease(backend->members[0].get(), false);
+
+        if (TryProbe(backend.get(), Now()))
+            return Lease(backend->members[0].get(), true);
+
+        break;
+    }
+
+    return Lease();
+}
+
+std::shared_ptr<grpc::Channel> AppGuardChannelPool::StreamChannel()
+{
+    std::size_t count = this->backends.size();
+    std::size_t current = this->stream_backend.load(std::memory_order_relaxed);
+
+    std::size_t fallback = current;
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        std::size_t index = (current + i) % count;
+        const auto &backend = this->backends[index];
+
+        if (Closed(backend.get()))
+        {
+            this->stream_backend.store(index, std::memory_order_relaxed);
+            return backend->members[0]->channel;
+        }
+
+        if (backend->open_until < this->backends[fallback]->open_until)
+            fallback = index;
+    }
+
+    this->stream_backend.store(fallback, std::memory_order_relaxed);
+    return this->backends[fallback]->members[0]->channel;
+}
+
+bool AppGuardChannelPool::StreamFailed(const std::shared_ptr<grpc::Channel> &channel)
+{
+    std::int64_t now = Now();
+    bool failover = false;
+
+    for (const auto &backend : this->backends)
+    {
+        if (backend->members[0]->channel == channel)
+            AppGuardChannelPool::Trip(backend.get(), now);
+        else
+            failover = failover || Closed(backend.get());
+    }
+
+    return failover;
+}
+
+void AppGuardChannelPool::Trip(Backend *backend, std::int64_t now)
+{
+    backend->open_until.store(
+        now + std::chrono::duration_cast<std::chrono::nanoseconds>(OpenTime).count(),
+        std::memory_order_relaxed);
+    backend->failures.store(0, std::memory_order_relaxed);
+
+    if (backend->circuit.exchange(Circuit::Open, std::memory_order_relaxed) == Circuit::Closed)
+    {
+        ngx_log_error(
+            NGX_LOG_WARN,
+            ngx_cycle->log,
+            0,
+            "AppGuard: Backend %s is failing; opening its circuit for %d seconds",
+            backend->addr.c_str(),
+            static_cast<int>(OpenTime.count()));
+    }
+}
+
+bool AppGuardChannelPool::TryProbe(Backend *backend, std::int64_t now)
+{
+    auto circuit = backend->circuit.load(std::memory_order_relaxed);
+
+    if (circuit == Circuit::Closed)
+        return false;
+
+    if (circuit == Circuit::Open)
+    {
+        if (backend->open_until.load(std::memory_order_relaxed) > now)
+            return false;
+
+        backend->circuit.compare_exchange_strong(circuit, Circuit::HalfOpen, std::memory_order_relaxed);
+    }
+
+    return !backend->probing.exchange(true, std::memory_order_acquire);
+}
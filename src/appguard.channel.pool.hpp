@@ -0,0 +1,232 @@
+#pragma once
+
+#include "generated/appguard.grpc.pb.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include <grpcpp/grpcpp.h>
+
+/**
+ * @brief Balances the calls of a client over its AppGuard backends and their channels.
+ *
+ * Each backend is a server address from `appguard_server_addr`; a host name resolving to
+ * several addresses gives a backend per address. Each backend gets `appguard_channels`
+ * channels with their own HTTP/2 connections, so a slow stream or a full
+ * `MAX_CONCURRENT_STREAMS` on one connection only holds back the calls sharing it.
+ *
+ * A call goes to the better of two randomly chosen backends by peak-EWMA: the decaying
+ * average of their latencies, which jumps to any slower sample, times their outstanding
+ * calls. Within the backend, it goes to the channel with the fewest outstanding calls.
+ *
+ * Each backend has a circuit breaker. It opens when `OpenAfter` calls fail in a row, calls
+ * running past their latency budget included, or when the backend's control stream fails.
+ * An open backend receives no calls for `OpenTime`; it then turns half-open and receives
+ * a single probe call at a time until one succeeds, which closes it and returns it to the
+ * rotation, or fails, which opens it again. Probes are made whether or not other backends
+ * are healthy. While every circuit is open, calls fail at once instead of waiting on the backends.
+ */
+class AppGuardChannelPool
+{
+public:
+    /// Consecutive failed calls after which the circuit of a backend opens.
+    static constexpr std::uint32_t OpenAfter = 5;
+    /// How long an open circuit lets no call through before probing the backend.
+    static constexpr std::chrono::seconds OpenTime{10};
+
+    /**
+     * @brief State of the circuit breaker of a backend.
+     */
+    enum class Circuit
+    {
+        // Calls go through.
+        Closed,
+        // Calls are refused until `open_until`.
+        Open,
+        // A single probe call at a time goes through.
+        HalfOpen,
+    };
+
+    struct Backend;
+
+    /**
+     * @brief A channel of the pool, with its stub and its number of outstanding calls.
+     */
+    struct Member
+    {
+        Backend *backend;
+        std::shared_ptr<grpc::Channel> channel;
+        std::unique_ptr<appguard::AppGuard::Stub> stub;
+        std::atomic<std::size_t> outstanding{0};
+    };
+
+    /**
+     * @brief A server address with its channels and its health.
+     */
+    struct Backend
+    {
+        std::string addr;
+        std::vector<std::unique_ptr<Member>> members;
+        // Calls outstanding over all the channels.
+        std::atomic<std::size_t> outstanding{0};
+        // Peak-EWMA of the call latency, in nanoseconds.
+        std::atomic<std::int64_t> latency{0};
+        // Time of the last latency sample, in nanoseconds of the steady clock.
+        std::atomic<std::int64_t> sampled{0};
+        // State of the circuit breaker.
+        std::atomic<Circuit> circuit{Circuit::Closed};
+        // Calls failed in a row while closed.
+        std::atomic<std::uint32_t> failures{0};
+        // End of the current opening, in nanoseconds of the steady clock.
+        std::atomic<std::int64_t> open_until{0};
+        // Indicates that a probe call is in flight while half-open.
+        std::atomic_bool probing{false};
+    };
+
+    /**
+     * @brief Counts a call against a channel for as long as it is held.
+     *
+     * The pool must outlive its leases.
+     */
+    class Lease
+    {
+    public:
+        Lease() = default;
+        Lease(Member *member, bool probe) noexcept;
+        ~Lease() { this->Release(); }
+
+        Lease(Lease &&other) noexcept : member(other.member), start(other.start), probe(other.probe) { other.member = nullptr; }
+        Lease &operator=(Lease &&other) noexcept
+        {
+            this->Release();
+            this->member = other.member;
+            this->start = other.start;
+            this->probe = other.probe;
+            other.member = nullptr;
+            return *this;
+        }
+
+        Lease(const Lease &) = delete;
+        Lease &operator=(const Lease &) = delete;
+
+        /**
+         * @brief Indicates that the lease holds a channel; it doesn't while every circuit is open.
+         */
+        inline explicit operator bool() const noexcept { return this->member != nullptr; }
+
+        /**
+         * @brief Returns the stub to make the call with.
+         */
+        inline appguard::AppGuard::Stub *operator->() const noexcept { return this->member->stub.get(); }
+
+        /**
+         * @brief Records the outcome of the call in the backend's health and releases the lease.
+         *
+         * @param status The status of the call.
+         */
+        void Complete(const grpc::Status &status);
+
+    private:
+        void Release() noexcept;
+
+        Member *member = nullptr;
+        std::chrono::steady_clock::time_point start;
+        // Indicates that the call probes a half-open backend.
+        bool probe = false;
+    };
+
+    /**
+     * @brief Opens `count` channels to each backend.
+     *
+     * The channels use distinct arguments and local subchannel pools so that gRPC doesn't
+     * fold them back into a single connection.
+     *
+     * @param addrs Addresses of the AppGuard servers.
+     * @param credentials Credentials of the channels.
+     * @param count Number of channels per backend; at least one is opened.
+     */
+    AppGuardChannelPool(
+        const std::vector<std::string> &addrs,
+        const std::shared_ptr<grpc::ChannelCredentials> &credentials,
+        std::size_t count);
+
+    AppGuardChannelPool(const AppGuardChannelPool &) = delete;
+    AppGuardChannelPool &operator=(const AppGuardChannelPool &) = delete;
+
+    /**
+     * @brief Starts connecting every channel without waiting for them.
+     *
+     * Backends that fail to connect open their circuits through the calls they fail.
+     */
+    void Connect();
+
+    /**
+     * @brief Indicates whether every circuit is open, so calls would be refused.
+     *
+     * Callers check it before waiting on anything else for a call.
+     */
+    bool Open() const noexcept;
+
+    /**
+     * @brief Picks the channel for a new call.
+     *
+     * @return The lease, or an empty one if every circuit is open or already probed.
+     */
+    Lease Acquire();
+
+    /**
+     * @brief Leases the channel of a stream for a call made over it.
+     *
+     * The call then counts against the health of the stream's backend like any other.
+     *
+     * @param channel A channel returned by `StreamChannel`.
+     * @return The lease, or an empty one if the backend's circuit is open or already probed.
+     */
+    Lease Acquire(const std::shared_ptr<grpc::Channel> &channel);
+
+    /**
+     * @brief Picks the channel for a new stream.
+     *
+     * Streams stay on the backend they last used while it is healthy, so that a reconnect
+     * doesn't move them without a reason.
+     *
+     * @return The first channel of a closed backend, or of the backend that probes soonest.
+     */
+    std::shared_ptr<grpc::Channel> StreamChannel();
+
+    /**
+     * @brief Opens the circuit of the backend of a channel whose stream failed.
+     *
+     * @param channel A channel returned by `StreamChannel`.
+     * @return True if another backend is closed and streams should move to it right away.
+     */
+    bool StreamFailed(const std::shared_ptr<grpc::Channel> &channel);
+
+private:
+    /**
+     * @brief Opens the circuit of a backend for `OpenTime`.
+     */
+    static void Trip(Backend *backend, std::int64_t now);
+
+    /**
+     * @brief Indicates whether the circuit of a backend is closed.
+     */
+    static inline bool Closed(const Backend *backend) noexcept
+    {
+        return backend->circuit.load(std::memory_order_relaxed) == Circuit::Closed;
+    }
+
+    /**
+     * @brief Claims the probe of a backend whose circuit is due to be probed.
+     *
+     * @return True if the caller makes the probe call.
+     */
+    static bool TryProbe(Backend *backend, std::int64_t now);
+
+    // The backends; never resized after construction.
+    std::vector<std::unique_ptr<Backend>> backends;
+    // Backend the streams last used.
+    std::atomic<std::size_t> stream_backend{0};
+};
@@ -0,0 +1,293 @@
+#include "appguard.decision.stream.hpp"
+#include "appguard.inner.utils.hpp"
+
+#include <algorithm>
+
+AppGuardDecisionStream::AppGuardDecisionStream(std::shared_ptr<AppGuardChannelPool> channels, std::shared_ptr<AppGuardStream> control)
+    : channels(channels), control(control)
+{
+    this->thread = std::thread([this]()
+                               { this->Run(); });
+}
+
+AppGuardDecisionStream::~AppGuardDecisionStream()
+{
+    {
+        std::lock_guard lock(this->mutex);
+        this->running = false;
+
+        if (this->context)
+            this->context->TryCancel();
+    }
+
+    this->cv.notify_all();
+
+    if (this->thread.joinable())
+        this->thread.join();
+}
+
+bool AppGuardDecisionStream::Connected() const
+{
+    return this->connected && this->control->PeekToken() != nullptr;
+}
+
+void AppGuardDecisionStream::Send(
+    appguard::AppGuardDecisionRequest request,
+    std::chrono::system_clock::time_point deadline,
+    Callback callback)
+{
+    grpc::Status status;
+    {
+        std::lock_guard lock(this->mutex);
+
+        if (!this->connected)
+        {
+            status = grpc::Status(grpc::StatusCode::UNAVAILABLE, "AppGuard decision stream is not connected");
+        }
+        else if (this->pending.size() >= Capacity)
+        {
+            status = grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED, "AppGuard decision stream is full");
+        }
+        else if (auto lease = this->channels->Acquire(this->channel); !lease)
+        {
+            status = grpc::Status(grpc::StatusCode::UNAVAILABLE, "AppGuard decision stream backend is failing");
+        }
+        else
+        {
+            auto id = this->next_id++;
+
+            request.set_id(id);
+            request.clear_token();
+
+            this->pending.emplace(id, Pending{deadline, std::move(callback), std::move(lease)});
+            this->deadlines.emplace(deadline, id);
+            this->queue.push_back(std::move(request));
+        }
+    }
+
+    if (status.ok())
+    {
+        this->cv.notify_all();
+        return;
+    }
+
+    appguard::AppGuardDecisionResponse none;
+    callback(status, none);
+}
+
+void AppGuardDecisionStream::Run()
+{
+    std::unique_lock lock(this->mutex);
+
+    while (this->running)
+    {
+        this->context = std::make_unique<grpc::ClientContext>();
+
+        lock.unlock();
+
+        auto channel = this->channels->StreamChannel();
+        auto stub = appguard::AppGuard::NewStub(channel);
+        auto stream = stub->DecisionStream(this->context.get());
+
+        lock.lock();
+        this->channel = channel;
+        this->connected = this->running;
+        lock.unlock();
+
+        std::thread writer([this, &stream]()
+                           { this->Write(stream.get()); });
+
+        appguard::AppGuardDecisionResponse response;
+        while (stream->Read(&response))
+        {
+            Callback callback;
+            {
+                std::lock_guard guard(this->mutex);
+                callback = this->Take(response.id(), grpc::Status::OK);
+            }
+
+            if (callback)
+                callback(grpc::Status::OK, response);
+        }
+
+        lock.lock();
+        this->connected = false;
+        this->context->TryCancel();
+        lock.unlock();
+
+        this->cv.notify_all();
+        writer.join();
+
+        auto status = stream->Finish();
+
+        lock.lock();
+        auto callbacks = this->TakeAll();
+        this->context.reset();
+        this->channel.reset();
+        lock.unlock();
+
+        Fail(callbacks, grpc::Status(grpc::StatusCode::UNAVAILABLE, "AppGuard decision stream closed"));
+
+        lock.lock();
+
+        if (!this->running)
+            break;
+
+        if (status.error_code() == grpc::StatusCode::UNIMPLEMENTED)
+        {
+            ngx_log_error(
+                NGX_LOG_WARN,
+                ngx_cycle->log,
+                0,
+                "AppGuard: Server doesn't support the decision stream; using unary calls");
+            break;
+        }
+
+        ngx_log_error(
+            NGX_LOG_ERR,
+            ngx_cycle->log,
+            0,
+            "AppGuard: Decision stream closed (%d: %s); falling back to unary calls",
+            static_cast<int>(status.error_code()),
+            status.error_message().c_str());
+
+        // Reopen it on another backend right away.
+        if (this->channels->StreamFailed(channel))
+            continue;
+
+        this->cv.wait_for(lock, std::chrono::seconds(5), [this]
+                          { return !this->running; });
+    }
+}
+
+void AppGuardDecisionStream::Write(ReaderWriter *stream)
+{
+    std::string sent_token;
+    std::unique_lock lock(this->mutex);
+
+    while (this->running && this->connected)
+    {
+        if (auto expired = this->TakeExpired(); !expired.empty())
+        {
+            lock.unlock();
+            Fail(expired, grpc::Status(grpc::StatusCode::DEADLINE_EXCEEDED, "Deadline Exceeded"));
+            lock.lock();
+            continue;
+        }
+
+        // Decisions wait in the queue until a token is available; their deadlines still apply.
+        // Held across the writes below; the control stream may replace it meanwhile.
+        auto token = this->control->PeekToken();
+
+        if (this->queue.empty() || !token)
+        {
+            auto wakeup = this->deadlines.empty()
+                              ? std::chrono::system_clock::time_point::max()
+                              : this->deadlines.begin()->first;
+
+            if (!this->queue.empty())
+                wakeup = std::min(wakeup, std::chrono::system_clock::now() + std::chrono::milliseconds(50));
+
+            auto wait = [this]
+            { return !this->running || !this->connected || !this->queue.empty(); };
+
+            if (wakeup == std::chrono::system_clock::time_point::max())
+                this->cv.wait(lock, wait);
+            else if (this->queue.empty())
+                this->cv.wait_until(lock, wakeup, wait);
+            else
+                this->cv.wait_until(lock, wakeup);
+
+            continue;
+        }
+
+        std::deque<appguard::AppGuardDecisionRequest> batch;
+        batch.swap(this->queue);
+
+        lock.unlock();
+
+        for (auto &request : batch)
+        {
+            if (*token != sent_token)
+            {
+                request.set_token(*token);
+                sent_token = *token;
+            }
+
+            if (!stream->Write(request))
+            {
+                // The reader sees the stream fail and fails the pending decisions.
+                return;
+            }
+        }
+
+        lock.lock();
+    }
+}
+
+AppGuardDecisionStream::Callback AppGuardDecisionStream::Take(std::uint64_t id, const grpc::Status &status)
+{
+    auto iter = this->pending.find(id);
+    if (iter == this->pending.end())
+        return nullptr;
+
+    auto callback = std::move(iter->second.callback);
+    iter->second.lease.Complete(status);
+
+    this->deadlines.erase({iter->second.deadline, id});
+    this->pending.erase(iter);
+
+    return callback;
+}
+
+std::vector<AppGuardDecisionStream::Callback> AppGuardDecisionStream::TakeExpired()
+{
+    std::vector<Callback> callbacks;
+    auto now = std::chrono::system_clock::now();
+    grpc::Status status(grpc::StatusCode::DEADLINE_EXCEEDED, "Deadline Exceeded");
+
+    while (!this->deadlines.empty() && this->deadlines.begin()->first <= now)
+    {
+        auto id = this->deadlines.begin()->second;
+        callbacks.push_back(this->Take(id, status));
+    }
+
+    if (!callbacks.empty())
+    {
+        // Expired decisions that haven't been written yet are dropped from the queue.
+        auto end = std::remove_if(
+            this->queue.begin(),
+            this->queue.end(),
+            [this](const appguard::AppGuardDecisionRequest &request)
+            { return this->pending.find(request.id()) == this->pending.end(); });
+
+        this->queue.erase(end, this->queue.end());
+    }
+
+    return callbacks;
+}
+
+std::vector<AppGuardDecisionStream::Callback> AppGuardDecisionStream::TakeAll()
+{
+    std::vector<Callback> callbacks;
+    callbacks.reserve(this->pending.size());
+
+    // The leases are released without an outcome; the failed stream already trips its backend.
+    for (auto &[_, entry] : this->pending)
+        callbacks.push_back(std::move(entry.callback));
+
+    this->pending.clear();
+    this->deadlines.clear();
+    this->queue.clear();
+
+    return callbacks;
+}
+
+void AppGuardDecisionStream::Fail(std::vector<Callback> &callbacks, const grpc::Status &status)
+{
+    for (auto &callback : callbacks)
+    {
+        appguard::AppGuardDecisionResponse none;
+        callback(status, none);
+    }
+}
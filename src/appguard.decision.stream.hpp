@@ -0,0 +1,151 @@
+#pragma once
+
+#include "generated/appguard.pb.h"
+#include "generated/appguard.grpc.pb.h"
+#include "appguard.stream.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <unordered_map>
+#include <grpcpp/grpcpp.h>
+
+/**
+ * @brief Multiplexes decision calls over one long-lived `DecisionStream`.
+ *
+ * Each decision is tagged with an id and written to the stream by a writer thread;
+ * a reader thread matches the verdicts, which may arrive in any order, back to their
+ * callbacks. The token is only written when it changes. The stream is reopened after
+ * a failure; while it is down, decisions fail with `UNAVAILABLE` so that the caller can
+ * fall back to unary calls.
+ *
+ * At most `Capacity` decisions may be outstanding at once; further ones fail with
+ * `RESOURCE_EXHAUSTED` instead of queuing up behind a slow server.
+ *
+ * Each decision holds a lease on the stream's channel, so decisions count against the
+ * circuit breaker of the stream's backend like unary calls do. While that circuit is
+ * open, decisions fail with `UNAVAILABLE` too.
+ */
+class AppGuardDecisionStream
+{
+public:
+    /// Receives the verdict of a decision; invoked exactly once, on an internal thread or inline on failure.
+    using Callback = std::function<void(const grpc::Status &, appguard::AppGuardDecisionResponse &)>;
+
+    /// Maximum number of decisions queued or awaiting a verdict at once.
+    static constexpr std::size_t Capacity = 4096;
+
+    /**
+     * @brief Starts the thread maintaining the stream.
+     *
+     * @param channels The channels to the AppGuard backends; the stream moves to a healthy backend when its own fails.
+     * @param control The control stream providing the authentication token.
+     */
+    AppGuardDecisionStream(std::shared_ptr<AppGuardChannelPool> channels, std::shared_ptr<AppGuardStream> control);
+
+    /**
+     * @brief Closes the stream; outstanding decisions fail with `UNAVAILABLE`.
+     */
+    ~AppGuardDecisionStream();
+
+    AppGuardDecisionStream(const AppGuardDecisionStream &) = delete;
+    AppGuardDecisionStream &operator=(const AppGuardDecisionStream &) = delete;
+
+    /**
+     * @brief Indicates whether the stream is open and a token is available to send decisions with.
+     */
+    bool Connected() const;
+
+    /**
+     * @brief Queues a decision.
+     *
+     * The id and token of `request` are set by the stream.
+     *
+     * @param request The decision to make.
+     * @param deadline The decision fails with `DEADLINE_EXCEEDED` past this point.
+     * @param callback Invoked with the verdict.
+     */
+    void Send(
+        appguard::AppGuardDecisionRequest request,
+        std::chrono::system_clock::time_point deadline,
+        Callback callback);
+
+private:
+    using ReaderWriter = grpc::ClientReaderWriter<appguard::AppGuardDecisionRequest, appguard::AppGuardDecisionResponse>;
+
+    /**
+     * @brief A decision waiting for its verdict.
+     */
+    struct Pending
+    {
+        std::chrono::system_clock::time_point deadline;
+        Callback callback;
+        // Counts the decision against the health of the stream's backend.
+        AppGuardChannelPool::Lease lease;
+    };
+
+    /**
+     * @brief Body of the thread opening the stream and reading the verdicts.
+     */
+    void Run();
+
+    /**
+     * @brief Body of the thread writing the decisions of one stream.
+     */
+    void Write(ReaderWriter *stream);
+
+    /**
+     * @brief Removes a decision, records its outcome in the backend's health and returns its callback; the lock must be held.
+     *
+     * @return The callback, or nullptr if the decision has already completed.
+     */
+    Callback Take(std::uint64_t id, const grpc::Status &status);
+
+    /**
+     * @brief Removes the decisions past their deadline; the lock must be held.
+     */
+    std::vector<Callback> TakeExpired();
+
+    /**
+     * @brief Removes every decision; the lock must be held.
+     */
+    std::vector<Callback> TakeAll();
+
+    /**
+     * @brief Fails decisions with the given status; the lock must not be held.
+     */
+    static void Fail(std::vector<Callback> &callbacks, const grpc::Status &status);
+
+private:
+    // gRPC channels to the backends.
+    std::shared_ptr<AppGuardChannelPool> channels;
+    // Control stream providing the authentication token.
+    std::shared_ptr<AppGuardStream> control;
+    // Protects the fields below.
+    std::mutex mutex;
+    // Signals the writer about new decisions, and both threads about shutdown.
+    std::condition_variable cv;
+    // Decisions waiting to be written.
+    std::deque<appguard::AppGuardDecisionRequest> queue;
+    // Decisions waiting to be written or answered, by id.
+    std::unordered_map<std::uint64_t, Pending> pending;
+    // Deadlines of the pending decisions, earliest first.
+    std::set<std::pair<std::chrono::system_clock::time_point, std::uint64_t>> deadlines;
+    // Id of the next decision.
+    std::uint64_t next_id = 1;
+    // Indicates that the stream should be kept open.
+    bool running = true;
+    // Indicates that the current stream can be written to.
+    std::atomic_bool connected{false};
+    // Client context of the current stream.
+    std::unique_ptr<grpc::ClientContext> context;
+    // Channel of the current stream.
+    std::shared_ptr<grpc::Channel> channel;
+    // Thread opening the stream and reading the verdicts.
+    std::thread thread;
+};
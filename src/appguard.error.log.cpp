@@ -0,0 +1,142 @@
+#include "appguard.error.log.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+AppGuardErrorLog &AppGuardErrorLog::Instance()
+{
+    static AppGuardErrorLog instance;
+    return instance;
+}
+
+void AppGuardErrorLog::Start(ngx_log_t *log)
+{
+    this->timer.handler = AppGuardErrorLog::OnTimer;
+    this->timer.log = log;
+    this->timer.data = this;
+    // Pending summaries don't hold up a graceful shutdown; `Stop` logs them.
+    this->timer.cancelable = 1;
+}
+
+void AppGuardErrorLog::Stop()
+{
+    for (auto &[server, entries] : this->servers)
+        for (auto &[reason, entry] : entries)
+            Summarize(reason, entry);
+
+    this->servers.clear();
+
+    if (this->timer.timer_set)
+        ngx_del_timer(&this->timer);
+}
+
+void AppGuardErrorLog::Failure(ngx_http_request_t *request, ngx_msec_t interval, const char *reason, const ngx_str_t *fallback)
+{
+    if (interval > 0)
+    {
+        auto *cscf = static_cast<ngx_http_core_srv_conf_t *>(ngx_http_get_module_srv_conf(request, ngx_http_core_module));
+        auto &entries = this->servers[cscf];
+
+        if (auto it = entries.find(std::string_view(reason)); it != entries.end())
+        {
+            it->second.suppressed++;
+            return;
+        }
+
+        entries.emplace(reason, Entry{cscf->server_name, interval, ngx_current_msec + interval, 0});
+
+        if (!this->timer.timer_set)
+            ngx_add_timer(&this->timer, interval);
+    }
+
+    if (fallback)
+    {
+        ngx_log_error(
+            NGX_LOG_ERR,
+            request->connection->log,
+            0,
+            "AppGuardClientException: %s; falling back to default policy '%V'",
+            reason,
+            fallback);
+    }
+    else
+    {
+        ngx_log_error(NGX_LOG_ERR, request->connection->log, 0, "AppGuardClientException: %s", reason);
+    }
+}
+
+void AppGuardErrorLog::OnTimer(ngx_event_t *event)
+{
+    auto *self = static_cast<AppGuardErrorLog *>(event->data);
+
+    for (auto server = self->servers.begin(); server != self->servers.end();)
+    {
+        auto &entries = server->second;
+
+        for (auto it = entries.begin(); it != entries.end();)
+        {
+            auto &entry = it->second;
+
+            if (static_cast<ngx_msec_int_t>(entry.next - ngx_current_msec) > 0)
+            {
+                ++it;
+                continue;
+            }
+
+            // An error that stopped occurring is logged right away the next time.
+            if (entry.suppressed == 0)
+            {
+                it = entries.erase(it);
+                continue;
+            }
+
+            Summarize(it->first, entry);
+            entry.next = ngx_current_msec + entry.interval;
+            ++it;
+        }
+
+        server = entries.empty() ? self->servers.erase(server) : std::next(server);
+    }
+
+    self->Schedule();
+}
+
+void AppGuardErrorLog::Summarize(const std::string &reason, Entry &entry)
+{
+    if (entry.suppressed == 0)
+        return;
+
+    ngx_log_error(
+        NGX_LOG_ERR,
+        ngx_cycle->log,
+        0,
+        "AppGuardClientException: %s; %ui more times in server \"%V\" in the last %M ms",
+        reason.c_str(),
+        entry.suppressed,
+        &entry.server,
+        entry.interval);
+
+    entry.suppressed = 0;
+}
+
+void AppGuardErrorLog::Schedule()
+{
+    bool pending = false;
+    ngx_msec_int_t earliest = 0;
+
+    for (const auto &[server, entries] : this->servers)
+    {
+        for (const auto &[reason, entry] : entries)
+        {
+            auto delay = static_cast<ngx_msec_int_t>(entry.next - ngx_current_msec);
+
+            if (!pending || delay < earliest)
+                earliest = delay;
+
+            pending = true;
+        }
+    }
+
+    if (pending)
+        ngx_add_timer(&this->timer, static_cast<ngx_msec_t>(std::max<ngx_msec_int_t>(earliest, 1)));
+}
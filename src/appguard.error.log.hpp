@@ -0,0 +1,92 @@
+#pragma once
+
+extern "C"
+{
+#include <ngx_config.h>
+#include <ngx_core.h>
+#include <ngx_http.h>
+}
+
+#include <map>
+#include <string>
+#include <string_view>
+
+/**
+ * @brief Rate-limits the logging of failed AppGuard calls (`appguard_error_log_interval`).
+ *
+ * The first failure of an error in a server block is logged right away. Further failures
+ * of the same error in the same server block are only counted, and a summary with their
+ * count is logged once per interval for as long as they keep occurring. Only used from
+ * the event loop of the worker.
+ */
+class AppGuardErrorLog
+{
+public:
+    /**
+     * @brief Returns the per-process instance.
+     */
+    static AppGuardErrorLog &Instance();
+
+    /**
+     * @brief Arms the summary timer; called from the worker process (init_process hook).
+     * @param log The log of the cycle.
+     */
+    void Start(ngx_log_t *log);
+
+    /**
+     * @brief Logs the summaries still pending; called on worker exit.
+     */
+    void Stop();
+
+    /**
+     * @brief Logs a failed call, or counts it if its error was logged within `interval`.
+     *
+     * @param request The request the call was made for.
+     * @param interval Period of the summaries; zero logs every failure.
+     * @param reason Message of the error.
+     * @param fallback Default policy the request falls back to, or nullptr if it doesn't.
+     */
+    void Failure(ngx_http_request_t *request, ngx_msec_t interval, const char *reason, const ngx_str_t *fallback);
+
+private:
+    AppGuardErrorLog() = default;
+
+    /**
+     * @brief An error being suppressed in a server block.
+     */
+    struct Entry
+    {
+        // Name of the server block.
+        ngx_str_t server;
+        // Period of the summaries.
+        ngx_msec_t interval;
+        // Time of the next summary.
+        ngx_msec_t next;
+        // Failures counted since the last line logged.
+        ngx_uint_t suppressed;
+    };
+
+    // Entries by error message; the lookup by `std::string_view` doesn't allocate.
+    using Entries = std::map<std::string, Entry, std::less<>>;
+
+    /**
+     * @brief Logs the summaries that are due and re-arms the timer.
+     */
+    static void OnTimer(ngx_event_t *event);
+
+    /**
+     * @brief Logs the summary of an entry and resets its count.
+     */
+    static void Summarize(const std::string &reason, Entry &entry);
+
+    /**
+     * @brief Arms the timer for the earliest summary, if there is any.
+     */
+    void Schedule();
+
+private:
+    // Entries by server block, keyed by its core configuration.
+    std::map<const void *, Entries> servers;
+    // Fires when the earliest summary is due.
+    ngx_event_t timer{};
+};
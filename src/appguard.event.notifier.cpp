@@ -0,0 +1,153 @@
+#include "appguard.event.notifier.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#if (NGX_HAVE_EVENTFD)
+#include <sys/eventfd.h>
+#endif
+
+AppGuardEventNotifier &AppGuardEventNotifier::Instance()
+{
+    static AppGuardEventNotifier instance;
+    return instance;
+}
+
+ngx_int_t AppGuardEventNotifier::Initialize(ngx_cycle_t *cycle)
+{
+    if (this->connection)
+        return NGX_OK;
+
+    int read_fd = -1;
+
+#if (NGX_HAVE_EVENTFD)
+    read_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (read_fd == -1)
+    {
+        ngx_log_error(NGX_LOG_ERR, cycle->log, ngx_errno, "AppGuard: eventfd() failed");
+        return NGX_ERROR;
+    }
+
+    this->write_fd = read_fd;
+#else
+    int fds[2];
+    if (pipe(fds) == -1)
+    {
+        ngx_log_error(NGX_LOG_ERR, cycle->log, ngx_errno, "AppGuard: pipe() failed");
+        return NGX_ERROR;
+    }
+
+    for (int fd : fds)
+    {
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+        fcntl(fd, F_SETFD, FD_CLOEXEC);
+    }
+
+    read_fd = fds[0];
+    this->write_fd = fds[1];
+#endif
+
+    ngx_connection_t *c = ngx_get_connection(read_fd, cycle->log);
+    if (c == nullptr)
+    {
+        close(read_fd);
+        if (this->write_fd != read_fd)
+            close(this->write_fd);
+
+        this->write_fd = -1;
+        return NGX_ERROR;
+    }
+
+    c->data = this;
+    c->read->handler = AppGuardEventNotifier::EventHandler;
+    c->read->log = cycle->log;
+
+    if (ngx_add_event(c->read, NGX_READ_EVENT, 0) != NGX_OK)
+    {
+        ngx_close_connection(c);
+        if (this->write_fd != read_fd)
+            close(this->write_fd);
+
+        this->write_fd = -1;
+        return NGX_ERROR;
+    }
+
+    this->connection = c;
+    return NGX_OK;
+}
+
+void AppGuardEventNotifier::Shutdown()
+{
+    if (!this->connection)
+        return;
+
+    int read_fd = this->connection->fd;
+
+    ngx_close_connection(this->connection);
+    this->connection = nullptr;
+
+    std::lock_guard lock(this->mutex);
+
+    if (this->write_fd != read_fd)
+        close(this->write_fd);
+
+    this->write_fd = -1;
+    this->tasks.clear();
+}
+
+void AppGuardEventNotifier::Post(Task task)
+{
+    bool wakeup;
+    {
+        std::lock_guard lock(this->mutex);
+        if (this->write_fd == -1)
+            return;
+
+        // Only the first task of a batch needs to wake the event loop up.
+        wakeup = this->tasks.empty();
+        this->tasks.push_back(std::move(task));
+    }
+
+    if (!wakeup)
+        return;
+
+#if (NGX_HAVE_EVENTFD)
+    uint64_t value = 1;
+#else
+    char value = 1;
+#endif
+
+    std::lock_guard lock(this->mutex);
+    if (this->write_fd != -1)
+        (void)!write(this->write_fd, &value, sizeof(value));
+}
+
+void AppGuardEventNotifier::EventHandler(ngx_event_t *event)
+{
+    auto *connection = static_cast<ngx_connection_t *>(event->data);
+    auto *self = static_cast<AppGuardEventNotifier *>(connection->data);
+
+#if (NGX_HAVE_EVENTFD)
+    uint64_t value;
+    (void)!read(connection->fd, &value, sizeof(value));
+#else
+    char buffer[64];
+    while (read(connection->fd, buffer, sizeof(buffer)) > 0)
+    {
+    }
+#endif
+
+    self->Drain();
+}
+
+void AppGuardEventNotifier::Drain()
+{
+    std::vector<Task> ready;
+    {
+        std::lock_guard lock(this->mutex);
+        ready.swap(this->tasks);
+    }
+
+    for (auto &task : ready)
+        task();
+}
\ No newline at end of file
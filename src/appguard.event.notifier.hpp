@@ -0,0 +1,83 @@
+#pragma once
+
+extern "C"
+{
+#include <ngx_config.h>
+#include <ngx_core.h>
+#include <ngx_event.h>
+}
+
+#include <functional>
+#include <mutex>
+#include <vector>
+
+/**
+ * @brief Hands work from gRPC completion threads back to the NGINX event loop.
+ *
+ * NGINX request structures may only be touched from the worker's own thread. Completions
+ * of asynchronous AppGuard calls are therefore posted here; the notifier wakes the event
+ * loop through an eventfd (or a pipe where eventfd is unavailable) and runs the posted
+ * tasks from the read handler of that descriptor.
+ */
+class AppGuardEventNotifier
+{
+public:
+    using Task = std::function<void()>;
+
+    /**
+     * @brief Returns the per-process notifier instance.
+     */
+    static AppGuardEventNotifier &Instance();
+
+    /**
+     * @brief Creates the wake-up descriptor and registers it with the event loop.
+     *
+     * Must be called from the worker process (init_process hook).
+     *
+     * @param cycle Current NGINX cycle.
+     * @return `NGX_OK` on success or `NGX_ERROR` on failure.
+     */
+    ngx_int_t Initialize(ngx_cycle_t *cycle);
+
+    /**
+     * @brief Unregisters and closes the wake-up descriptor, dropping pending tasks.
+     */
+    void Shutdown();
+
+    /**
+     * @brief Indicates whether the notifier is registered with the event loop.
+     */
+    inline bool Active() const noexcept { return this->connection != nullptr; }
+
+    /**
+     * @brief Schedules a task to be executed on the NGINX event loop.
+     *
+     * Safe to call from any thread. Tasks must not throw.
+     *
+     * @param task The task to execute.
+     */
+    void Post(Task task);
+
+private:
+    AppGuardEventNotifier() = default;
+
+    /**
+     * @brief Read handler of the wake-up descriptor.
+     */
+    static void EventHandler(ngx_event_t *event);
+
+    /**
+     * @brief Runs every task posted so far.
+     */
+    void Drain();
+
+private:
+    // Protects the task queue.
+    std::mutex mutex;
+    // Tasks waiting to be executed on the event loop.
+    std::vector<Task> tasks;
+    // NGINX connection wrapping the readable end of the wake-up descriptor.
+    ngx_connection_t *connection = nullptr;
+    // Writable end of the wake-up descriptor.
+    int write_fd = -1;
+};
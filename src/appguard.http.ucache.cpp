@@ -1,20 +1,33 @@
 #include "appguard.http.ucache.hpp"
+#include <algorithm>
 #include <tuple>
 #include <sstream>
+#include <vector>
 
 static std::string SerializeQuery(const google::protobuf::Map<std::string, std::string> &queryMap)
 {
+    // The map's iteration order depends on its hashing and insertion history, so the
+    // same query could otherwise yield different keys.
+    std::vector<const google::protobuf::MapPair<std::string, std::string> *> params;
+    params.reserve(queryMap.size());
+
+    for (const auto &param : queryMap)
+        params.push_back(&param);
+
+    std::sort(params.begin(), params.end(), [](const auto *left, const auto *right)
+              { return left->first < right->first; });
+
     std::ostringstream oss;
     bool first = true;
 
-    for (const auto &[key, value] : queryMap)
+    for (const auto *param : params)
     {
         if (!first)
         {
             oss << "&";
         }
 
-        oss << key << "=" << value;
+        oss << param->first << "=" << param->second;
         first = false;
     }
 
@@ -43,6 +56,22 @@ HttpRequestCacheKey HttpRequestCacheKey::FromRequest(const appguard::AppGuardHtt
 
 bool HttpRequestCacheKey::operator<(const HttpRequestCacheKey &other) const noexcept
 {
-    return std::tie(this->method, this->query, this->sourceIp, this->url, this->userAgent) ==
+    return std::tie(this->method, this->query, this->sourceIp, this->url, this->userAgent) <
            std::tie(other.method, other.query, other.sourceIp, other.url, other.userAgent);
+}
+
+std::string HttpRequestCacheKey::Serialize() const
+{
+    std::string serialized;
+    serialized.reserve(
+        this->method.size() + this->query.size() + this->sourceIp.size() + this->url.size() + this->userAgent.size() + 5);
+
+    // Fields are terminated by NUL, which none of them can contain.
+    for (const auto *field : {&this->method, &this->query, &this->sourceIp, &this->url, &this->userAgent})
+    {
+        serialized.append(*field);
+        serialized.push_back('\0');
+    }
+
+    return serialized;
 }
\ No newline at end of file
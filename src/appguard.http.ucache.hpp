@@ -1,10 +1,13 @@
 #pragma once
 
+#include <list>
 #include <mutex>
 #include <map>
+#include <memory>
 #include <optional>
 #include "generated/commands.pb.h"
 #include "generated/appguard.pb.h"
+#include "appguard.shared.cache.hpp"
 
 template <typename T>
 class AppguardHttpCache
@@ -18,23 +21,64 @@ public:
         return instance;
     }
 
+    // Number of entries kept in the worker-local cache when a shared zone backs it.
+    static constexpr std::size_t LocalCapacity = 1024;
+
     void Put(T &&key, value_type value)
     {
-        std::lock_guard lock(this->mutex);
+        std::unique_lock lock(this->mutex);
         if (!this->enabled)
             return;
 
-        this->cache.insert({std::move(key), std::move(value)});
+        if (this->shared)
+        {
+            auto serialized = key.Serialize();
+
+            this->Validate();
+            this->Insert(std::move(key), value);
+            lock.unlock();
+
+            this->shared->Put(serialized, value);
+            return;
+        }
+
+        if (this->cache.find(key) == this->cache.end())
+            this->Insert(std::move(key), value);
     }
 
     std::optional<value_type> Get(const T &key) const
     {
-        std::lock_guard lock(this->mutex);
+        std::unique_lock lock(this->mutex);
         if (!this->enabled)
             return std::nullopt;
 
-        auto iterator = this->cache.find(key);
-        return iterator == this->cache.end() ? std::nullopt : std::make_optional(iterator->second);
+        if (this->shared)
+            this->Validate();
+
+        if (auto iterator = this->cache.find(key); iterator != this->cache.end())
+        {
+            this->recent.splice(this->recent.begin(), this->recent, iterator->second.recent);
+            return iterator->second.value;
+        }
+
+        if (!this->shared)
+            return std::nullopt;
+
+        auto generation = this->generation;
+        lock.unlock();
+
+        auto value = this->shared->Get(key.Serialize());
+        if (!value.has_value())
+            return std::nullopt;
+
+        // Hot keys are served from the worker-local cache on the next lookup, unless the
+        // zone changed meanwhile and the verdict may already be stale.
+        lock.lock();
+
+        if (this->generation == generation)
+            this->Insert(T(key), value.value());
+
+        return value;
     }
 
     void Clear()
@@ -44,6 +88,44 @@ public:
             return;
 
         this->cache.clear();
+        this->recent.clear();
+    }
+
+    /**
+     * @brief Applies new firewall defaults pushed by the server.
+     *
+     * Clears the worker-local cache, and the shared zone if the defaults changed.
+     *
+     * @param enable Whether verdicts are cached.
+     * @param defaults The serialized firewall defaults.
+     */
+    void ApplyDefaults(bool enable, std::string_view defaults)
+    {
+        std::lock_guard lock(this->mutex);
+
+        this->enabled = enable;
+        this->cache.clear();
+        this->recent.clear();
+
+        if (this->shared && enable)
+            this->shared->ApplyDefaults(defaults);
+    }
+
+    /**
+     * @brief Backs the cache with a zone shared by all workers (`appguard_cache_zone`).
+     *
+     * The worker-local cache then only keeps the `LocalCapacity` entries used last, and is
+     * dropped whenever a worker changes a verdict in the zone. Must be called before any lookup.
+     *
+     * @param shared The shared cache.
+     */
+    void Attach(std::unique_ptr<AppGuardSharedCache> shared)
+    {
+        std::lock_guard lock(this->mutex);
+        this->shared = std::move(shared);
+        this->cache.clear();
+        this->recent.clear();
+        this->generation = this->shared->Generation();
     }
 
     void Enable(bool enable)
@@ -59,12 +141,64 @@ public:
     }
 
 private:
+    struct Entry
+    {
+        value_type value;
+        // Position of the key in `recent`.
+        typename std::list<const T *>::iterator recent;
+    };
+
     AppguardHttpCache() = default;
 
+    /**
+     * @brief Drops the worker-local cache if a verdict changed in the shared zone; the lock must be held.
+     */
+    void Validate() const
+    {
+        if (auto generation = this->shared->Generation(); generation != this->generation)
+        {
+            this->cache.clear();
+            this->recent.clear();
+            this->generation = generation;
+        }
+    }
+
+    /**
+     * @brief Inserts into the worker-local cache; the lock must be held.
+     *
+     * With a shared zone the cache is bounded: the least recently used entry makes room,
+     * and is found again in the zone.
+     */
+    void Insert(T &&key, value_type value) const
+    {
+        if (auto iterator = this->cache.find(key); iterator != this->cache.end())
+        {
+            iterator->second.value = value;
+            this->recent.splice(this->recent.begin(), this->recent, iterator->second.recent);
+            return;
+        }
+
+        if (this->shared && this->cache.size() >= LocalCapacity)
+        {
+            this->cache.erase(*this->recent.back());
+            this->recent.pop_back();
+        }
+
+        auto [iterator, inserted] = this->cache.emplace(std::move(key), Entry{value, {}});
+        this->recent.push_front(&iterator->first);
+        iterator->second.recent = this->recent.begin();
+    }
+
 private:
     mutable std::mutex mutex{};
     bool enabled{false};
-    std::map<T, value_type> cache{};
+    mutable std::map<T, Entry> cache{};
+    // Keys of `cache`, most recently used first.
+    mutable std::list<const T *> recent{};
+    // Zone shared by all workers, or nullptr if there is none.
+    std::unique_ptr<AppGuardSharedCache> shared{};
+    // Generation of the zone that the worker-local cache matches.
+    mutable ngx_atomic_uint_t generation{0};
 };
 
 struct HttpRequestCacheKey
@@ -72,6 +206,8 @@ struct HttpRequestCacheKey
 public:
     static HttpRequestCacheKey FromRequest(const appguard::AppGuardHttpRequest &request);
     bool operator<(const HttpRequestCacheKey &other) const noexcept;
+    // Flattens the key into the byte string used by the shared cache.
+    std::string Serialize() const;
 
     HttpRequestCacheKey() = default;
     HttpRequestCacheKey(const HttpRequestCacheKey &) = default;
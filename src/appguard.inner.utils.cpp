@@ -46,10 +46,8 @@ namespace appguard::inner_utils
         return false;
     }
 
-    static std::unordered_map<std::string, std::string> NgxParseHeadersList(ngx_list_t *headers)
+    static void NgxParseHeadersList(ngx_list_t *headers, google::protobuf::Map<std::string, std::string> *retval)
     {
-        std::unordered_map<std::string, std::string> retval;
-
         ngx_list_part_t *part = &headers->part;
         ngx_table_elt_t *header = static_cast<ngx_table_elt_t *>(part->elts);
 
@@ -64,22 +62,10 @@ namespace appguard::inner_utils
                 i = 0;
             }
 
-            retval.try_emplace(
-                NgxStringToStdString(&header[i].key),
-                NgxStringToStdString(&header[i].value));
+            // The first occurrence of a repeated header wins.
+            retval->insert({NgxStringToStdString(&header[i].key),
+                            NgxStringToStdString(&header[i].value)});
         }
-
-        return retval;
-    }
-
-    static std::unordered_map<std::string, std::string> NgxParseResponseHeaders(ngx_http_request_t *request)
-    {
-        return NgxParseHeadersList(&request->headers_out.headers);
-    }
-
-    static std::unordered_map<std::string, std::string> NgxParseRequestHeaders(ngx_http_request_t *request)
-    {
-        return NgxParseHeadersList(&request->headers_in.headers);
     }
 
     static std::unordered_map<std::string, std::string> ParseQueryParameters(const std::string &uri)
@@ -125,7 +111,12 @@ namespace appguard::inner_utils
     appguard::AppGuardTcpConnection ExtractTcpConnectionInfo(ngx_http_request_t *request)
     {
         appguard::AppGuardTcpConnection tcp_connection;
+        ExtractTcpConnectionInfo(request, tcp_connection);
+        return tcp_connection;
+    }
 
+    void ExtractTcpConnectionInfo(ngx_http_request_t *request, appguard::AppGuardTcpConnection &tcp_connection)
+    {
         std::string ip_address{};
         uint16_t port{};
 
@@ -141,13 +132,34 @@ namespace appguard::inner_utils
             tcp_connection.set_destination_port(port);
         }
 
-        auto protocol = NgxStringToStdString(&request->http_protocol);
-        tcp_connection.set_protocol(protocol);
-
-        return tcp_connection;
+        tcp_connection.set_protocol(NgxStringToStdString(&request->http_protocol));
     }
 
     appguard::AppGuardHttpRequest ExtractHttpRequestInfo(ngx_http_request_t *request)
+    {
+        appguard::AppGuardHttpRequest http_request;
+        ExtractHttpRequestInfo(request, http_request);
+        return http_request;
+    }
+
+    void ExtractHttpRequestInfo(ngx_http_request_t *request, appguard::AppGuardHttpRequest &http_request)
+    {
+        std::string uri(reinterpret_cast<char *>(request->uri.data), request->uri.len);
+
+        auto query_params = ParseQueryParameters(uri);
+        for (const auto &[key, value] : query_params)
+        {
+            http_request.mutable_query()->insert({key, value});
+        }
+
+        http_request.set_original_url(uri);
+
+        NgxParseHeadersList(&request->headers_in.headers, http_request.mutable_headers());
+
+        http_request.set_method(NgxStringToStdString(&request->method_name));
+    }
+
+    appguard::AppGuardHttpRequest ExtractHttpRequestKeyInfo(ngx_http_request_t *request)
     {
         appguard::AppGuardHttpRequest http_request;
 
@@ -161,35 +173,85 @@ namespace appguard::inner_utils
 
         http_request.set_original_url(uri);
 
-        auto headers = NgxParseRequestHeaders(request);
-        for (const auto &[key, value] : headers)
+        if (ngx_table_elt_t *user_agent = request->headers_in.user_agent; user_agent)
         {
-            http_request.mutable_headers()->insert({key, value});
+            http_request.mutable_headers()->insert({NgxStringToStdString(&user_agent->key),
+                                                    NgxStringToStdString(&user_agent->value)});
         }
 
-        std::string method = NgxStringToStdString(&request->method_name);
+        http_request.set_method(NgxStringToStdString(&request->method_name));
 
-        http_request.set_method(method);
+        std::string ip_address{};
+        uint16_t port{};
+
+        if (ParseSocketAddr(request->connection->sockaddr, ip_address, port))
+        {
+            http_request.mutable_tcp_info()->mutable_connection()->set_source_ip(ip_address);
+        }
 
         return http_request;
     }
 
-    appguard::AppGuardHttpResponse ExtractHttpResponseInfo(ngx_http_request_t *request)
+    off_t RequestBodySize(ngx_http_request_t *request)
     {
-        appguard::AppGuardHttpResponse http_response;
+        if (!request->request_body)
+            return 0;
+
+        off_t size = 0;
 
-        auto headers = NgxParseResponseHeaders(request);
+        for (ngx_chain_t *cl = request->request_body->bufs; cl; cl = cl->next)
+            size += ngx_buf_size(cl->buf);
 
-        for (const auto &[key, value] : headers)
+        return size;
+    }
+
+    bool ExtractRequestBody(ngx_http_request_t *request, std::string &body)
+    {
+        body.resize(static_cast<size_t>(RequestBodySize(request)));
+
+        if (body.empty())
+            return true;
+
+        auto *out = reinterpret_cast<u_char *>(body.data());
+
+        for (ngx_chain_t *cl = request->request_body->bufs; cl; cl = cl->next)
         {
-            http_response.mutable_headers()->insert({key, value});
+            ngx_buf_t *buf = cl->buf;
+
+            if (ngx_buf_in_memory(buf))
+            {
+                out = ngx_cpymem(out, buf->pos, buf->last - buf->pos);
+                continue;
+            }
+
+            if (!buf->in_file)
+                continue;
+
+            auto size = static_cast<size_t>(buf->file_last - buf->file_pos);
+
+            if (ngx_read_file(buf->file, out, size, buf->file_pos) != static_cast<ssize_t>(size))
+                return false;
+
+            out += size;
         }
 
-        http_response.set_code(request->headers_out.status);
+        return true;
+    }
 
+    appguard::AppGuardHttpResponse ExtractHttpResponseInfo(ngx_http_request_t *request)
+    {
+        appguard::AppGuardHttpResponse http_response;
+        ExtractHttpResponseInfo(request, http_response);
         return http_response;
     }
 
+    void ExtractHttpResponseInfo(ngx_http_request_t *request, appguard::AppGuardHttpResponse &http_response)
+    {
+        NgxParseHeadersList(&request->headers_out.headers, http_response.mutable_headers());
+
+        http_response.set_code(request->headers_out.status);
+    }
+
     appguard_commands::FirewallPolicy StringToFirewallPolicy(const std::string &str)
     {
         auto lowercase = str;
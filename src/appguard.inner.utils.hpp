@@ -38,6 +38,14 @@ namespace appguard::inner_utils
      */
     appguard::AppGuardTcpConnection ExtractTcpConnectionInfo(ngx_http_request_t *request);
 
+    /**
+     * @brief Fills TCP connection information into a message, which may live on an arena.
+     *
+     * @param request Pointer to the NGINX HTTP request.
+     * @param tcp_connection Receives the connection details.
+     */
+    void ExtractTcpConnectionInfo(ngx_http_request_t *request, appguard::AppGuardTcpConnection &tcp_connection);
+
     /**
      * @brief Extracts HTTP request information from an NGINX request.
      *
@@ -48,6 +56,45 @@ namespace appguard::inner_utils
      */
     appguard::AppGuardHttpRequest ExtractHttpRequestInfo(ngx_http_request_t *request);
 
+    /**
+     * @brief Fills HTTP request information into a message, which may live on an arena.
+     *
+     * @param request Pointer to the NGINX HTTP request.
+     * @param http_request Receives the request details.
+     */
+    void ExtractHttpRequestInfo(ngx_http_request_t *request, appguard::AppGuardHttpRequest &http_request);
+
+    /**
+     * @brief Extracts only the HTTP request fields that make up its verdict cache key.
+     *
+     * A cheaper alternative to `ExtractHttpRequestInfo` for cache lookups that don't
+     * send the request: method, URI, query, `User-Agent` and the client address.
+     *
+     * @param request Pointer to the NGINX HTTP request.
+     * @return A partially populated `AppGuardHttpRequest` object.
+     */
+    appguard::AppGuardHttpRequest ExtractHttpRequestKeyInfo(ngx_http_request_t *request);
+
+    /**
+     * @brief Returns the size of the request body read so far.
+     *
+     * @param request Pointer to the NGINX HTTP request.
+     * @return The number of body bytes held in memory and temporary file buffers.
+     */
+    off_t RequestBodySize(ngx_http_request_t *request);
+
+    /**
+     * @brief Copies the request body read by `ngx_http_read_client_request_body`.
+     *
+     * In-memory buffers are appended as is; buffers spilled to the temporary file are
+     * read straight into the result without an intermediate buffer.
+     *
+     * @param request Pointer to the NGINX HTTP request.
+     * @param body Receives the body.
+     * @return True on success; false if the temporary file could not be read.
+     */
+    bool ExtractRequestBody(ngx_http_request_t *request, std::string &body);
+
     /**
      * @brief Extracts HTTP response information from an NGINX request.
      *
@@ -58,6 +105,14 @@ namespace appguard::inner_utils
      */
     appguard::AppGuardHttpResponse ExtractHttpResponseInfo(ngx_http_request_t *request);
 
+    /**
+     * @brief Fills HTTP response information into a message, which may live on an arena.
+     *
+     * @param request Pointer to the NGINX HTTP request.
+     * @param http_response Receives the response details.
+     */
+    void ExtractHttpResponseInfo(ngx_http_request_t *request, appguard::AppGuardHttpResponse &http_response);
+
     /**
      * @brief Converts a string to the corresponding FirewallPolicy enum value.
      *
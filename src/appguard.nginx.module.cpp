@@ -4,9 +4,20 @@
 #include "appguard.uclient.exception.hpp"
 #include "appguard.uclient.info.hpp"
 #include "appguard.tcp.ucache.hpp"
+#include "appguard.http.ucache.hpp"
 #include "appguard.storage.hpp"
+#include "appguard.event.notifier.hpp"
+#include "appguard.report.queue.hpp"
+#include "appguard.bypass.matcher.hpp"
+#include "appguard.shared.cache.hpp"
+#include "appguard.agent.hpp"
+#include "appguard.error.log.hpp"
+
+#define NGX_HTTP_APPGUARD_BUFFERED 0x08
 
 static ngx_http_output_header_filter_pt next_header_filter;
+static ngx_http_output_body_filter_pt next_body_filter;
+static ngx_http_request_body_filter_pt next_request_body_filter;
 
 extern "C"
 {
@@ -20,78 +31,292 @@ extern "C"
         return AppGuardNginxModule::ResponseHandler(r);
     }
 
+    static ngx_int_t ngx_http_appguard_log_handler(ngx_http_request_t *r)
+    {
+        return AppGuardNginxModule::LogHandler(r);
+    }
+
+    static ngx_int_t ngx_http_appguard_response_body_handler(ngx_http_request_t *r, ngx_chain_t *in)
+    {
+        return AppGuardNginxModule::ResponseBodyHandler(r, in);
+    }
+
+    static ngx_int_t ngx_http_appguard_request_body_filter(ngx_http_request_t *r, ngx_chain_t *in)
+    {
+        return AppGuardNginxModule::RequestBodyFilter(r, in);
+    }
+
+    static ngx_int_t ngx_http_appguard_add_variables(ngx_conf_t *cf)
+    {
+        return AppGuardNginxModule::AddVariables(cf);
+    }
+
     static ngx_int_t ngx_http_appguard_init(ngx_conf_t *cf)
     {
         return AppGuardNginxModule::Initialize(cf);
     }
 
-    static void *ngx_http_appguard_create_srv_conf(ngx_conf_t *cf)
+    static void *ngx_http_appguard_create_loc_conf(ngx_conf_t *cf)
+    {
+        return AppGuardNginxModule::CreateLocConfig(cf);
+    }
+
+    static char *ngx_http_appguard_merge_loc_conf(ngx_conf_t *cf, void *parent, void *child)
+    {
+        return AppGuardNginxModule::MergeLocConfig(cf, parent, child);
+    }
+
+    static char *ngx_http_appguard_set_bypass(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
+    {
+        return AppGuardNginxModule::SetBypass(cf, cmd, conf);
+    }
+
+    static char *ngx_http_appguard_set_sample_rate(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
+    {
+        return AppGuardNginxModule::SetSampleRate(cf, cmd, conf);
+    }
+
+    static char *ngx_http_appguard_set_server_addr(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
+    {
+        return AppGuardNginxModule::SetServerAddr(cf, cmd, conf);
+    }
+
+    static char *ngx_http_appguard_set_agent(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
+    {
+        return AppGuardNginxModule::SetAgent(cf, cmd, conf);
+    }
+
+    static char *ngx_http_appguard_set_cache_zone(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
+    {
+        return AppGuardNginxModule::SetCacheZone(cf, cmd, conf);
+    }
+
+    static char *ngx_http_appguard_set_batch(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
+    {
+        return AppGuardNginxModule::SetBatch(cf, cmd, conf);
+    }
+
+    static ngx_int_t ngx_http_appguard_init_process(ngx_cycle_t *cycle)
     {
-        return AppGuardNginxModule::CreateSrvConfig(cf);
+        return AppGuardNginxModule::InitProcess(cycle);
     }
 
-    static char *ngx_http_appguard_merge_srv_conf(ngx_conf_t *cf, void *parent, void *child)
+    static void ngx_http_appguard_exit_process(ngx_cycle_t *cycle)
     {
-        return AppGuardNginxModule::MergeSrvConfig(cf, parent, child);
+        AppGuardNginxModule::ExitProcess(cycle);
     }
 
+    static ngx_conf_bitmask_t appguard_body_methods[] = {
+        {ngx_string("GET"), NGX_HTTP_GET},
+        {ngx_string("POST"), NGX_HTTP_POST},
+        {ngx_string("PUT"), NGX_HTTP_PUT},
+        {ngx_string("PATCH"), NGX_HTTP_PATCH},
+        {ngx_string("DELETE"), NGX_HTTP_DELETE},
+        {ngx_string("OPTIONS"), NGX_HTTP_OPTIONS},
+        {ngx_null_string, 0}};
+
+    static ngx_conf_enum_t appguard_modes[] = {
+        {ngx_string("enforce"), AppGuardNginxModule::MODE_ENFORCE},
+        {ngx_string("monitor"), AppGuardNginxModule::MODE_MONITOR},
+        {ngx_null_string, 0}};
+
+    static ngx_conf_enum_t appguard_response_check_modes[] = {
+        {ngx_string("sync"), AppGuardNginxModule::RESPONSE_CHECK_SYNC},
+        {ngx_string("deferred"), AppGuardNginxModule::RESPONSE_CHECK_DEFERRED},
+        {ngx_string("log"), AppGuardNginxModule::RESPONSE_CHECK_LOG},
+        {ngx_null_string, 0}};
+
+    static ngx_conf_enum_t appguard_startup_modes[] = {
+        {ngx_string("default_policy"), AppGuardNginxModule::STARTUP_DEFAULT_POLICY},
+        {ngx_string("queue"), AppGuardNginxModule::STARTUP_QUEUE},
+        {ngx_null_string, 0}};
+
+    static ngx_conf_num_bounds_t appguard_channels_bounds = {
+        ngx_conf_check_num_bounds, 1, 64};
+
     static ngx_command_t appguard_nginx_module_commands[] = {
         {ngx_string("appguard_enabled"),
-         NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_CONF_FLAG,
+         NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_CONF_FLAG,
          ngx_conf_set_flag_slot,
-         NGX_HTTP_SRV_CONF_OFFSET,
+         NGX_HTTP_LOC_CONF_OFFSET,
          offsetof(AppGuardNginxModule::Config, enabled),
          nullptr},
 
         {ngx_string("appguard_tls"),
-         NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_CONF_FLAG,
+         NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_CONF_FLAG,
          ngx_conf_set_flag_slot,
-         NGX_HTTP_SRV_CONF_OFFSET,
+         NGX_HTTP_LOC_CONF_OFFSET,
          offsetof(AppGuardNginxModule::Config, tls),
          nullptr},
 
         {ngx_string("appguard_server_addr"),
-         NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_CONF_TAKE1,
-         ngx_conf_set_str_slot,
-         NGX_HTTP_SRV_CONF_OFFSET,
-         offsetof(AppGuardNginxModule::Config, server_addr),
+         NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_CONF_1MORE,
+         ngx_http_appguard_set_server_addr,
+         NGX_HTTP_LOC_CONF_OFFSET,
+         0,
          nullptr},
 
         {ngx_string("appguard_installation_code"),
-         NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_CONF_TAKE1,
+         NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_CONF_TAKE1,
          ngx_conf_set_str_slot,
-         NGX_HTTP_SRV_CONF_OFFSET,
+         NGX_HTTP_LOC_CONF_OFFSET,
          offsetof(AppGuardNginxModule::Config, installation_code),
          nullptr},
 
         {ngx_string("appguard_default_policy"),
-         NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_CONF_TAKE1,
+         NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_CONF_TAKE1,
          ngx_conf_set_str_slot,
-         NGX_HTTP_SRV_CONF_OFFSET,
+         NGX_HTTP_LOC_CONF_OFFSET,
          offsetof(AppGuardNginxModule::Config, default_policy),
          nullptr},
 
         {ngx_string("appguard_server_cert_path"),
-         NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_CONF_TAKE1,
+         NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_CONF_TAKE1,
          ngx_conf_set_str_slot,
-         NGX_HTTP_SRV_CONF_OFFSET,
+         NGX_HTTP_LOC_CONF_OFFSET,
          offsetof(AppGuardNginxModule::Config, server_cert_path),
          nullptr},
 
+        {ngx_string("appguard_mode"),
+         NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_CONF_TAKE1,
+         ngx_conf_set_enum_slot,
+         NGX_HTTP_LOC_CONF_OFFSET,
+         offsetof(AppGuardNginxModule::Config, mode),
+         &appguard_modes},
+
+        {ngx_string("appguard_bypass"),
+         NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_CONF_1MORE,
+         ngx_http_appguard_set_bypass,
+         NGX_HTTP_LOC_CONF_OFFSET,
+         0,
+         nullptr},
+
+        {ngx_string("appguard_sample_rate"),
+         NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_CONF_TAKE12,
+         ngx_http_appguard_set_sample_rate,
+         NGX_HTTP_LOC_CONF_OFFSET,
+         0,
+         nullptr},
+
+        {ngx_string("appguard_timeout"),
+         NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_CONF_TAKE1,
+         ngx_conf_set_msec_slot,
+         NGX_HTTP_LOC_CONF_OFFSET,
+         offsetof(AppGuardNginxModule::Config, timeout),
+         nullptr},
+
+        {ngx_string("appguard_async"),
+         NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_CONF_FLAG,
+         ngx_conf_set_flag_slot,
+         NGX_HTTP_LOC_CONF_OFFSET,
+         offsetof(AppGuardNginxModule::Config, async),
+         nullptr},
+
+        {ngx_string("appguard_tcp_correlation"),
+         NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_CONF_FLAG,
+         ngx_conf_set_flag_slot,
+         NGX_HTTP_LOC_CONF_OFFSET,
+         offsetof(AppGuardNginxModule::Config, tcp_correlation),
+         nullptr},
+
+        {ngx_string("appguard_body_inspection"),
+         NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_CONF_FLAG,
+         ngx_conf_set_flag_slot,
+         NGX_HTTP_LOC_CONF_OFFSET,
+         offsetof(AppGuardNginxModule::Config, body_inspection),
+         nullptr},
+
+        {ngx_string("appguard_body_max_size"),
+         NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_CONF_TAKE1,
+         ngx_conf_set_size_slot,
+         NGX_HTTP_LOC_CONF_OFFSET,
+         offsetof(AppGuardNginxModule::Config, body_max_size),
+         nullptr},
+
+        {ngx_string("appguard_body_methods"),
+         NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_CONF_1MORE,
+         ngx_conf_set_bitmask_slot,
+         NGX_HTTP_LOC_CONF_OFFSET,
+         offsetof(AppGuardNginxModule::Config, body_methods),
+         &appguard_body_methods},
+
+        {ngx_string("appguard_body_types"),
+         NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_CONF_1MORE,
+         ngx_conf_set_str_array_slot,
+         NGX_HTTP_LOC_CONF_OFFSET,
+         offsetof(AppGuardNginxModule::Config, body_types),
+         nullptr},
+
+        {ngx_string("appguard_response_check"),
+         NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_CONF_TAKE1,
+         ngx_conf_set_enum_slot,
+         NGX_HTTP_LOC_CONF_OFFSET,
+         offsetof(AppGuardNginxModule::Config, response_check),
+         &appguard_response_check_modes},
+
+        {ngx_string("appguard_agent"),
+         NGX_HTTP_MAIN_CONF | NGX_CONF_FLAG,
+         ngx_http_appguard_set_agent,
+         NGX_HTTP_LOC_CONF_OFFSET,
+         0,
+         nullptr},
+
+        {ngx_string("appguard_cache_zone"),
+         NGX_HTTP_MAIN_CONF | NGX_CONF_TAKE1,
+         ngx_http_appguard_set_cache_zone,
+         NGX_HTTP_LOC_CONF_OFFSET,
+         0,
+         nullptr},
+
+        {ngx_string("appguard_batch"),
+         NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_CONF_TAKE12,
+         ngx_http_appguard_set_batch,
+         NGX_HTTP_LOC_CONF_OFFSET,
+         0,
+         nullptr},
+
+        {ngx_string("appguard_decision_stream"),
+         NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_CONF_FLAG,
+         ngx_conf_set_flag_slot,
+         NGX_HTTP_LOC_CONF_OFFSET,
+         offsetof(AppGuardNginxModule::Config, decision_stream),
+         nullptr},
+
+        {ngx_string("appguard_channels"),
+         NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_CONF_TAKE1,
+         ngx_conf_set_num_slot,
+         NGX_HTTP_LOC_CONF_OFFSET,
+         offsetof(AppGuardNginxModule::Config, channels),
+         &appguard_channels_bounds},
+
+        {ngx_string("appguard_startup"),
+         NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_CONF_TAKE1,
+         ngx_conf_set_enum_slot,
+         NGX_HTTP_LOC_CONF_OFFSET,
+         offsetof(AppGuardNginxModule::Config, startup),
+         &appguard_startup_modes},
+
+        {ngx_string("appguard_error_log_interval"),
+         NGX_HTTP_MAIN_CONF | NGX_HTTP_SRV_CONF | NGX_HTTP_LOC_CONF | NGX_CONF_TAKE1,
+         ngx_conf_set_msec_slot,
+         NGX_HTTP_LOC_CONF_OFFSET,
+         offsetof(AppGuardNginxModule::Config, error_log_interval),
+         nullptr},
+
         ngx_null_command};
 
     static ngx_http_module_t appguard_nginx_module_ctx = {
-        nullptr,
+        ngx_http_appguard_add_variables,
         ngx_http_appguard_init,
 
         nullptr,
         nullptr,
 
-        ngx_http_appguard_create_srv_conf,
-        ngx_http_appguard_merge_srv_conf,
-
         nullptr,
-        nullptr};
+        nullptr,
+
+        ngx_http_appguard_create_loc_conf,
+        ngx_http_appguard_merge_loc_conf};
 
     ngx_module_t appguard_nginx_module = {
         NGX_MODULE_V1,
@@ -100,10 +325,10 @@ extern "C"
         NGX_HTTP_MODULE,
         nullptr,
         nullptr,
+        ngx_http_appguard_init_process,
         nullptr,
         nullptr,
-        nullptr,
-        nullptr,
+        ngx_http_appguard_exit_process,
         nullptr,
         NGX_MODULE_V1_PADDING};
 }
@@ -121,182 +346,1624 @@ static ngx_int_t ActOnPolicy(appguard_commands::FirewallPolicy policy, appguard_
     }
 }
 
-ngx_int_t AppGuardNginxModule::Initialize(ngx_conf_t *cf)
+static inline appguard_commands::FirewallPolicy DefaultPolicy(const AppGuardNginxModule::Config *conf)
 {
-    try
+    return static_cast<appguard_commands::FirewallPolicy>(conf->policy);
+}
+
+namespace
+{
+    /**
+     * @brief Outcome of request body inspection, exposed as `$appguard_request_body`.
+     */
+    enum BodyState
     {
-        Storage::Initialize();
-    }
-    catch (...)
+        // The request has no body, or body inspection is off.
+        BODY_UNCHECKED,
+        // The body is being read from the client.
+        BODY_READING,
+        // The body has been read and is sent to AppGuard.
+        BODY_INSPECTED,
+        // The body exceeds `appguard_body_max_size` and is not sent.
+        BODY_TOO_LARGE,
+        // The method or content type isn't selected for body inspection.
+        BODY_NOT_MATCHED
+    };
+
+    /**
+     * @brief Random sampling decision of a request.
+     */
+    enum SampleState
     {
-        ngx_log_error(
-            NGX_LOG_ERR,
-            cf->log,
-            0,
-            "AppGuard: Failed to initialize persistent storage");
-        return NGX_ERROR;
-    }
+        SAMPLE_UNDECIDED,
+        SAMPLE_IN,
+        SAMPLE_OUT
+    };
 
-    auto *cmcf = static_cast<ngx_http_core_main_conf_t *>(
-        ngx_http_conf_get_module_main_conf(cf, ngx_http_core_module));
+    /**
+     * @brief Per-request state of an asynchronous verdict.
+     *
+     * Shared between the request and the pending gRPC completions; the request pointer
+     * is cleared when the request pool is destroyed so late completions are dropped.
+     */
+    struct RequestContext : std::enable_shared_from_this<RequestContext>
+    {
+        // The suspended request, or nullptr once it has been freed.
+        ngx_http_request_t *request = nullptr;
+        // Indicates that a request verdict has been asked for.
+        bool requested = false;
+        // Indicates that the verdict is still being computed.
+        bool pending = false;
+        // Number of calls the suspended request is still waiting for.
+        unsigned outstanding = 0;
+        // Verdict to act upon once the request is resumed.
+        appguard_commands::FirewallPolicy policy = appguard_commands::FirewallPolicy::UNKNOWN;
+        // Indicates that response headers are held until the response verdict arrives.
+        bool response_pending = false;
+        // Indicates that the response verdict has been applied.
+        bool response_checked = false;
+        // Body buffers received while the response headers are held.
+        ngx_chain_t *out = nullptr;
+        // Outcome of request body inspection.
+        BodyState body = BODY_UNCHECKED;
+        // Bytes of the request body received so far while it is read for inspection.
+        off_t body_received = 0;
+        // Random sampling decision, rolled once so every phase of the request agrees.
+        SampleState sampled = SAMPLE_UNDECIDED;
+    };
 
-    auto *h = static_cast<ngx_http_handler_pt *>(
-        ngx_array_push(&cmcf->phases[NGX_HTTP_POST_READ_PHASE].handlers));
+    using RequestContextPtr = std::shared_ptr<RequestContext>;
+}
 
-    if (h == nullptr)
-        return NGX_ERROR;
+static void CleanupRequestContext(void *data)
+{
+    auto *ctx = static_cast<RequestContextPtr *>(data);
 
-    *h = ngx_http_appguard_request_handler;
+    (*ctx)->request = nullptr;
+    ctx->~RequestContextPtr();
+}
 
-    next_header_filter = ngx_http_top_header_filter;
-    ngx_http_top_header_filter = ngx_http_appguard_response_handler;
+static RequestContextPtr GetRequestContext(ngx_http_request_t *request)
+{
+    if (auto *current = static_cast<RequestContext *>(ngx_http_get_module_ctx(request, appguard_nginx_module)); current)
+        return current->shared_from_this();
 
-    return NGX_OK;
+    ngx_pool_cleanup_t *cln = ngx_pool_cleanup_add(request->pool, sizeof(RequestContextPtr));
+    if (cln == nullptr)
+        return nullptr;
+
+    auto *ctx = new (cln->data) RequestContextPtr(std::make_shared<RequestContext>());
+    (*ctx)->request = request;
+
+    cln->handler = CleanupRequestContext;
+    ngx_http_set_ctx(request, ctx->get(), appguard_nginx_module);
+
+    return *ctx;
 }
 
-void *AppGuardNginxModule::CreateSrvConfig(ngx_conf_t *cf)
+// Size of the first block of a request arena, carved from the request pool.
+static constexpr size_t REQUEST_ARENA_BLOCK_SIZE = 4096;
+
+/**
+ * @brief Options of an arena for the messages of a call made while the request waits.
+ *
+ * The first block comes from the request pool and is freed with it, so most requests
+ * build their messages without a heap allocation per message; larger ones spill into
+ * blocks the arena allocates and frees itself. The arena must not outlive the request.
+ */
+static google::protobuf::ArenaOptions RequestArenaOptions(ngx_http_request_t *request)
 {
-    void *memory = ngx_pcalloc(cf->pool, sizeof(Config));
+    google::protobuf::ArenaOptions options;
 
-    if (!memory)
-        return nullptr;
+    if (auto *block = static_cast<char *>(ngx_palloc(request->pool, REQUEST_ARENA_BLOCK_SIZE)); block)
+    {
+        options.initial_block = block;
+        options.initial_block_size = REQUEST_ARENA_BLOCK_SIZE;
+    }
 
-    return new (memory) Config();
+    return options;
 }
 
-char *AppGuardNginxModule::MergeSrvConfig(ngx_conf_t *cf, void *parent, void *child)
+/**
+ * @brief Attaches the cached TCP info of the connection to a message.
+ *
+ * Messages on an arena borrow it instead of copying its strings: arena messages never
+ * delete their fields, and the cache entry outlives a call made while the request waits.
+ */
+template <typename Message>
+static void AttachTcpInfo(Message &message, const appguard::AppGuardTcpInfo &tcp_info)
 {
-    auto *prev = static_cast<AppGuardNginxModule::Config *>(parent);
-    auto *conf = static_cast<AppGuardNginxModule::Config *>(child);
+    if (message.GetArena())
+        message.unsafe_arena_set_allocated_tcp_info(const_cast<appguard::AppGuardTcpInfo *>(&tcp_info));
+    else
+        *message.mutable_tcp_info() = tcp_info;
+}
 
-    ngx_conf_merge_value(conf->enabled, prev->enabled, 0);
-    ngx_conf_merge_value(conf->tls, prev->tls, 0);
+static void BuildHttpRequest(ngx_http_request_t *request, appguard::AppGuardHttpRequest &http_request)
+{
+    appguard::inner_utils::ExtractHttpRequestInfo(request, http_request);
 
-    ngx_conf_merge_str_value(conf->server_addr, prev->server_addr, "");
-    ngx_conf_merge_str_value(conf->installation_code, prev->installation_code, "");
+    auto *ctx = static_cast<RequestContext *>(ngx_http_get_module_ctx(request, appguard_nginx_module));
+    if (!ctx || ctx->body != BODY_INSPECTED)
+        return;
 
-    ngx_conf_merge_str_value(conf->default_policy, prev->default_policy, "");
-    ngx_conf_merge_str_value(conf->server_cert_path, prev->server_cert_path, "");
+    if (std::string body; appguard::inner_utils::ExtractRequestBody(request, body))
+    {
+        http_request.set_body(std::move(body));
+    }
+    else
+    {
+        ngx_log_error(NGX_LOG_ERR, request->connection->log, 0, "AppGuard: Failed to read the request body");
+    }
+}
 
-    return NGX_CONF_OK;
+static appguard::AppGuardHttpRequest BuildHttpRequest(ngx_http_request_t *request)
+{
+    appguard::AppGuardHttpRequest http_request;
+    BuildHttpRequest(request, http_request);
+    return http_request;
 }
 
-ngx_int_t AppGuardNginxModule::RequestHandler(ngx_http_request_t *request)
+/**
+ * @brief Builds the messages of a response check.
+ *
+ * The request carries the TCP info too, as its client address is part of the cache key.
+ */
+static void BuildHttpResponse(
+    ngx_http_request_t *request,
+    appguard::AppGuardHttpRequest &http_request,
+    appguard::AppGuardHttpResponse &http_response)
 {
-    auto *conf = static_cast<AppGuardNginxModule::Config *>(ngx_http_get_module_srv_conf(request, appguard_nginx_module));
-    if (!conf || !conf->enabled)
-        return NGX_DECLINED;
+    appguard::inner_utils::ExtractHttpRequestInfo(request, http_request);
+    appguard::inner_utils::ExtractHttpResponseInfo(request, http_response);
+
+    if (const auto *tcp_info = AppguardTcpInfoCache::Get(request); tcp_info)
+    {
+        AttachTcpInfo(http_request, *tcp_info);
+        AttachTcpInfo(http_response, *tcp_info);
+    }
+}
+
+static void LogClientFailure(ngx_http_request_t *request, const char *reason)
+{
+    auto *conf = static_cast<AppGuardNginxModule::Config *>(ngx_http_get_module_loc_conf(request, appguard_nginx_module));
 
-    auto default_policy_str = appguard::inner_utils::NgxStringToStdString(&conf->default_policy);
-    auto default_policy = appguard::inner_utils::StringToFirewallPolicy(default_policy_str);
-    auto installation_code = appguard::inner_utils::NgxStringToStdString(&conf->installation_code);
-    auto server_addr = appguard::inner_utils::NgxStringToStdString(&conf->server_addr);
-    auto server_cert_path = appguard::inner_utils::NgxStringToStdString(&conf->server_cert_path);
+    AppGuardErrorLog::Instance().Failure(request, conf->error_log_interval, reason, &conf->default_policy);
+}
 
-    if (installation_code.empty())
+/**
+ * @brief Logs a failed call made while the request waits, and returns the fallback of the location.
+ *
+ * @return `NGX_DECLINED` in monitor mode, the outcome of the default policy otherwise.
+ */
+static ngx_int_t FallBack(ngx_http_request_t *request, AppGuardNginxModule::Config *conf, const char *reason)
+{
+    if (conf->mode == AppGuardNginxModule::MODE_MONITOR)
     {
-        ngx_log_error(
-            NGX_LOG_ERR,
-            request->connection->log,
-            0,
-            "AppGuard: Installation Code hasn't been set; falling back to default policy '%s'",
-            default_policy_str.data());
+        AppGuardErrorLog::Instance().Failure(request, conf->error_log_interval, reason, nullptr);
+        return NGX_DECLINED;
+    }
 
-        return ActOnPolicy(appguard_commands::FirewallPolicy::UNKNOWN, default_policy);
+    LogClientFailure(request, reason);
+
+    return ActOnPolicy(appguard_commands::FirewallPolicy::UNKNOWN, DefaultPolicy(conf));
+}
+
+static void ResumeRequest(const RequestContextPtr &ctx)
+{
+    ngx_http_request_t *request = ctx->request;
+    ngx_connection_t *connection = request->connection;
+
+    ctx->pending = false;
+    request->main->count--;
+
+    ngx_http_core_run_phases(request);
+    ngx_http_run_posted_requests(connection);
+}
+
+static void CompleteCall(const RequestContextPtr &ctx)
+{
+    if (--ctx->outstanding == 0)
+        ResumeRequest(ctx);
+}
+
+static void OnHttpRequestHandled(const RequestContextPtr &ctx, const grpc::Status &status, appguard_commands::FirewallPolicy policy)
+{
+    if (!ctx->request)
+        return;
+
+    if (!status.ok())
+    {
+        LogClientFailure(ctx->request, AppGuardError::FromGrpcStatus(status).what);
+        policy = appguard_commands::FirewallPolicy::UNKNOWN;
     }
 
-    try
+    ctx->policy = policy;
+    CompleteCall(ctx);
+}
+
+static void SendHttpRequest(const RequestContextPtr &ctx, AppGuardWrapper &client, appguard::AppGuardHttpRequest http_request)
+{
+    client.HandleHttpRequestAsync(
+        std::move(http_request),
+        [ctx](const grpc::Status &status, appguard_commands::FirewallPolicy policy)
+        {
+            AppGuardEventNotifier::Instance().Post(
+                [ctx, status, policy]()
+                { OnHttpRequestHandled(ctx, status, policy); });
+        });
+}
+
+static void RequestHttpVerdict(const RequestContextPtr &ctx, AppGuardWrapper &client, const appguard::AppGuardTcpInfo &tcp_info)
+{
+    auto http_request = BuildHttpRequest(ctx->request);
+    *http_request.mutable_tcp_info() = tcp_info;
+
+    SendHttpRequest(ctx, client, std::move(http_request));
+}
+
+static void OnTcpConnectionHandled(const RequestContextPtr &ctx, AppGuardWrapper &client, const grpc::Status &status, appguard::AppGuardTcpResponse &response)
+{
+    ngx_http_request_t *request = ctx->request;
+    if (!request)
+        return;
+
+    if (!status.ok())
     {
-        AppGaurdClientInfo client_info{
-            .installation_code = installation_code,
-            .server_addr = server_addr,
-            .server_cert_path = server_cert_path,
-            .tls = !!conf->tls};
+        LogClientFailure(request, AppGuardError::FromGrpcStatus(status).what);
+        CompleteCall(ctx);
+        return;
+    }
 
-        auto client = AppGuardWrapper::CreateClient(client_info);
+    const auto *tcp_info = AppguardTcpInfoCache::Put(request, response.tcp_info());
+    if (!tcp_info)
+        tcp_info = &response.tcp_info();
 
-        auto connection = appguard::inner_utils::ExtractTcpConnectionInfo(request);
-        auto tcp_response = client.HandleTcpConnection(connection);
+    RequestHttpVerdict(ctx, client, *tcp_info);
+}
 
-        auto http_request = appguard::inner_utils::ExtractHttpRequestInfo(request);
-        AppguardTcpInfoCache::Instance().Put(request->connection, tcp_response.tcp_info());
-        http_request.set_allocated_tcp_info(new appguard::AppGuardTcpInfo(tcp_response.tcp_info()));
+static void OnCorrelatedTcpConnectionHandled(const RequestContextPtr &ctx, const grpc::Status &status, appguard::AppGuardTcpResponse &response)
+{
+    ngx_http_request_t *request = ctx->request;
+    if (!request)
+        return;
 
-        auto policy = client.HandleHttpRequest(http_request);
-        return ActOnPolicy(policy, default_policy);
+    // The verdict comes from the concurrent HTTP call; a failure here only means
+    // the next request on this connection retries the TCP call.
+    if (status.ok())
+    {
+        AppguardTcpInfoCache::Put(request, response.tcp_info());
     }
-    catch (AppGuardClientException &ex)
+    else
     {
-        ngx_log_error(
-            NGX_LOG_ERR,
-            request->connection->log,
-            0,
-            "AppGuardClientException: %s; falling back to default policy '%s'",
-            ex.what(),
-            default_policy_str.data());
+        auto *conf = static_cast<AppGuardNginxModule::Config *>(ngx_http_get_module_loc_conf(request, appguard_nginx_module));
 
-        return ActOnPolicy(appguard_commands::FirewallPolicy::UNKNOWN, default_policy);
+        AppGuardErrorLog::Instance().Failure(request, conf->error_log_interval, AppGuardError::FromGrpcStatus(status).what, nullptr);
     }
+
+    CompleteCall(ctx);
 }
 
-ngx_int_t AppGuardNginxModule::ResponseHandler(ngx_http_request_t *request)
+static ngx_int_t SuspendRequest(ngx_http_request_t *request, AppGuardNginxModule::Config *conf, AppGuardWrapper &client)
 {
-    auto *conf = static_cast<AppGuardNginxModule::Config *>(ngx_http_get_module_srv_conf(request, appguard_nginx_module));
-    if (!conf || !conf->enabled)
-        return next_header_filter(request);
+    auto ctx = GetRequestContext(request);
+    if (!ctx)
+        return NGX_HTTP_INTERNAL_SERVER_ERROR;
 
-    auto default_policy_str = appguard::inner_utils::NgxStringToStdString(&conf->default_policy);
-    auto default_policy = appguard::inner_utils::StringToFirewallPolicy(default_policy_str);
-    auto installation_code = appguard::inner_utils::NgxStringToStdString(&conf->installation_code);
-    auto server_addr = appguard::inner_utils::NgxStringToStdString(&conf->server_addr);
-    auto server_cert_path = appguard::inner_utils::NgxStringToStdString(&conf->server_cert_path);
+    ctx->requested = true;
 
-    if (installation_code.empty())
+    if (const auto *tcp_info = AppguardTcpInfoCache::Get(request); tcp_info)
     {
-        ngx_log_error(
-            NGX_LOG_ERR,
-            request->connection->log,
-            0,
-            "AppGuard: Installation code hasn't been set; falling back to default policy '%s'",
-            default_policy_str.data());
+        ctx->outstanding = 1;
+        RequestHttpVerdict(ctx, client, *tcp_info);
+    }
+    else if (conf->tcp_correlation)
+    {
+        // Both calls are started at once; the HTTP request carries the connection
+        // tuple the server uses to correlate it with the TCP call.
+        auto connection = appguard::inner_utils::ExtractTcpConnectionInfo(request);
+        auto http_request = BuildHttpRequest(request);
+        *http_request.mutable_tcp_info()->mutable_connection() = connection;
 
-        ngx_int_t code = ActOnPolicy(appguard_commands::FirewallPolicy::UNKNOWN, default_policy);
-        return code == NGX_DECLINED ? next_header_filter(request) : code;
+        ctx->outstanding = 2;
+
+        client.HandleTcpConnectionAsync(
+            std::move(connection),
+            [ctx](const grpc::Status &status, appguard::AppGuardTcpResponse &response)
+            {
+                AppGuardEventNotifier::Instance().Post(
+                    [ctx, status, response = std::move(response)]() mutable
+                    { OnCorrelatedTcpConnectionHandled(ctx, status, response); });
+            });
+
+        SendHttpRequest(ctx, client, std::move(http_request));
     }
+    else
+    {
+        ctx->outstanding = 1;
 
-    try
+        client.HandleTcpConnectionAsync(
+            appguard::inner_utils::ExtractTcpConnectionInfo(request),
+            [ctx, client](const grpc::Status &status, appguard::AppGuardTcpResponse &response)
+            {
+                AppGuardEventNotifier::Instance().Post(
+                    [ctx, client, status, response = std::move(response)]() mutable
+                    { OnTcpConnectionHandled(ctx, client, status, response); });
+            });
+    }
+
+    ctx->pending = true;
+    request->main->count++;
+
+    return NGX_DONE;
+}
+
+static void OnHttpResponseHandled(const RequestContextPtr &ctx, const grpc::Status &status, appguard_commands::FirewallPolicy policy)
+{
+    ngx_http_request_t *request = ctx->request;
+    if (!request)
+        return;
+
+    if (!status.ok())
     {
-        AppGaurdClientInfo client_info{
-            .installation_code = installation_code,
-            .server_addr = server_addr,
-            .server_cert_path = server_cert_path,
-            .tls = !!conf->tls};
+        LogClientFailure(request, AppGuardError::FromGrpcStatus(status).what);
+        policy = appguard_commands::FirewallPolicy::UNKNOWN;
+    }
 
-        auto client = AppGuardWrapper::CreateClient(client_info);
+    auto *conf = static_cast<AppGuardNginxModule::Config *>(ngx_http_get_module_loc_conf(request, appguard_nginx_module));
 
-        auto http_request = appguard::inner_utils::ExtractHttpRequestInfo(request);
-        auto http_response = appguard::inner_utils::ExtractHttpResponseInfo(request);
+    ngx_connection_t *connection = request->connection;
 
-        if (auto tcp_info = AppguardTcpInfoCache::Instance().Get(request->connection); tcp_info.has_value())
-        {
-            http_response.set_allocated_tcp_info(new appguard::AppGuardTcpInfo(tcp_info.value()));
-        }
+    request->main->blocked--;
+    request->buffered &= ~NGX_HTTP_APPGUARD_BUFFERED;
 
-        auto policy = client.HandleHttpResponse(http_request, http_response);
-        ngx_int_t code = ActOnPolicy(policy, default_policy);
-        return code == NGX_DECLINED ? next_header_filter(request) : code;
+    ctx->response_pending = false;
+    ctx->response_checked = true;
+
+    ngx_chain_t *out = ctx->out;
+    ctx->out = nullptr;
+
+    ngx_int_t rc = ActOnPolicy(policy, DefaultPolicy(conf));
+    if (rc == NGX_DECLINED)
+    {
+        rc = next_header_filter(request);
+        if (rc != NGX_ERROR && rc <= NGX_OK && out)
+            rc = next_body_filter(request, out);
     }
-    catch (AppGuardClientException &ex)
+    else
     {
-        ngx_log_error(
-            NGX_LOG_ERR,
-            request->connection->log,
-            0,
-            "AppGuardClientException: %s; falling back to default policy '%s'",
-            ex.what(),
-            default_policy_str.data());
+        // Headers were never sent, so the response can still be replaced; the held
+        // buffers are marked as consumed to let their producer reuse them.
+        for (ngx_chain_t *cl = out; cl; cl = cl->next)
+        {
+            cl->buf->pos = cl->buf->last;
+            cl->buf->file_pos = cl->buf->file_last;
+        }
 
-        ngx_int_t code = ActOnPolicy(appguard_commands::FirewallPolicy::UNKNOWN, default_policy);
-        return code == NGX_DECLINED ? next_header_filter(request) : code;
+        rc = ngx_http_filter_finalize_request(request, &appguard_nginx_module, rc);
     }
+
+    if (rc == NGX_ERROR || rc > NGX_OK)
+        ngx_http_finalize_request(request, rc);
+    else
+        request->write_event_handler(request);
+
+    ngx_http_run_posted_requests(connection);
 }
+
+static ngx_int_t DeferResponse(
+    ngx_http_request_t *request,
+    AppGuardWrapper &client,
+    appguard::AppGuardHttpRequest http_request,
+    appguard::AppGuardHttpResponse http_response)
+{
+    auto ctx = GetRequestContext(request);
+    if (!ctx)
+        return NGX_ERROR;
+
+    client.HandleHttpResponseAsync(
+        std::move(http_request),
+        std::move(http_response),
+        [ctx](const grpc::Status &status, appguard_commands::FirewallPolicy policy)
+        {
+            AppGuardEventNotifier::Instance().Post(
+                [ctx, status, policy]()
+                { OnHttpResponseHandled(ctx, status, policy); });
+        });
+
+    ctx->response_pending = true;
+    request->main->blocked++;
+    request->buffered |= NGX_HTTP_APPGUARD_BUFFERED;
+
+    return NGX_OK;
+}
+
+static AppGaurdClientInfo *MakeClientInfo(AppGuardNginxModule::Config *conf)
+{
+    return new AppGaurdClientInfo{
+        .installation_code = appguard::inner_utils::NgxStringToStdString(&conf->installation_code),
+        .server_addr = appguard::inner_utils::NgxStringToStdString(&conf->server_addr),
+        .server_cert_path = appguard::inner_utils::NgxStringToStdString(&conf->server_cert_path),
+        .tls = !!conf->tls,
+        .batch_window = std::chrono::microseconds(conf->batch_window),
+        .batch_size = conf->batch_size,
+        .decision_stream = !!conf->decision_stream,
+        .channels = static_cast<std::size_t>(conf->channels),
+        .queue_before_token = conf->startup == AppGuardNginxModule::STARTUP_QUEUE};
+}
+
+static void CleanupClientInfo(void *data)
+{
+    delete static_cast<AppGaurdClientInfo *>(data);
+}
+
+/**
+ * @brief Returns the client of the location; `InitProcess` creates it when the worker starts.
+ *
+ * The client lives as long as the worker; copies share the channel and streams of the
+ * client registered in `AppGuardWrapper::CreateClient`.
+ */
+static AppGuardWrapper &GetClient(AppGuardNginxModule::Config *conf)
+{
+    if (!conf->client)
+    {
+        auto client = AppGuardWrapper::CreateClient(*conf->client_info);
+        client.SetTimeout(std::chrono::milliseconds(conf->timeout));
+
+        conf->client = new AppGuardWrapper(std::move(client));
+    }
+
+    return *conf->client;
+}
+
+static bool IsBodyTypeSelected(ngx_http_request_t *request, AppGuardNginxModule::Config *conf)
+{
+    ngx_table_elt_t *content_type = request->headers_in.content_type;
+    if (!content_type)
+        return false;
+
+    // Parameters such as the charset or the multipart boundary don't take part in matching.
+    size_t length = 0;
+    while (length < content_type->value.len && content_type->value.data[length] != ';' && content_type->value.data[length] != ' ')
+        length++;
+
+    auto *types = static_cast<ngx_str_t *>(conf->body_types->elts);
+
+    for (ngx_uint_t i = 0; i < conf->body_types->nelts; i++)
+    {
+        ngx_str_t &type = types[i];
+
+        if (type.len == 1 && type.data[0] == '*')
+            return true;
+
+        // `type/*` selects every subtype.
+        if (type.len > 2 && type.data[type.len - 1] == '*' && type.data[type.len - 2] == '/')
+        {
+            if (length >= type.len - 1 && ngx_strncasecmp(content_type->value.data, type.data, type.len - 1) == 0)
+                return true;
+
+            continue;
+        }
+
+        if (length == type.len && ngx_strncasecmp(content_type->value.data, type.data, length) == 0)
+            return true;
+    }
+
+    return false;
+}
+
+static void RequestBodyHandler(ngx_http_request_t *request)
+{
+    auto *ctx = static_cast<RequestContext *>(ngx_http_get_module_ctx(request, appguard_nginx_module));
+
+    // `RequestBodyFilter` has already flagged bodies that went over the cap.
+    if (ctx->body == BODY_READING)
+        ctx->body = BODY_INSPECTED;
+
+    request->write_event_handler = ngx_http_core_run_phases;
+    ngx_http_core_run_phases(request);
+}
+
+/**
+ * @brief Tells whether a request without content-length or chunked encoding still has a body.
+ *
+ * HTTP/2 clients may send DATA frames without announcing a length; the stream then stays
+ * open after the headers.
+ */
+static bool HasUnannouncedBody(ngx_http_request_t *request)
+{
+#if (NGX_HTTP_V2)
+    if (request->stream)
+        return !request->stream->in_closed;
+#endif
+
+    return false;
+}
+
+static ngx_int_t ReadRequestBody(ngx_http_request_t *request, AppGuardNginxModule::Config *conf)
+{
+    if (!conf->body_inspection)
+        return NGX_DECLINED;
+
+    if (request->headers_in.content_length_n <= 0 && !request->headers_in.chunked && !HasUnannouncedBody(request))
+        return NGX_DECLINED;
+
+    auto ctx = GetRequestContext(request);
+    if (!ctx)
+        return NGX_HTTP_INTERNAL_SERVER_ERROR;
+
+    if (!(request->method & conf->body_methods) || !IsBodyTypeSelected(request, conf))
+    {
+        ctx->body = BODY_NOT_MATCHED;
+        return NGX_DECLINED;
+    }
+
+    // Announced bodies over the cap are never read here; the request is inspected without it.
+    if (request->headers_in.content_length_n > static_cast<off_t>(conf->body_max_size))
+    {
+        ctx->body = BODY_TOO_LARGE;
+        return NGX_DECLINED;
+    }
+
+    ctx->body = BODY_READING;
+
+    ngx_int_t rc = ngx_http_read_client_request_body(request, RequestBodyHandler);
+    if (rc >= NGX_HTTP_SPECIAL_RESPONSE)
+        return rc;
+
+    ngx_http_finalize_request(request, NGX_DONE);
+    return NGX_DONE;
+}
+
+static ngx_int_t GetRequestBodyVariable(ngx_http_request_t *request, ngx_http_variable_value_t *value, uintptr_t data)
+{
+    static ngx_str_t states[] = {
+        ngx_null_string,
+        ngx_string("reading"),
+        ngx_string("inspected"),
+        ngx_string("too_large"),
+        ngx_string("not_matched")};
+
+    auto *ctx = static_cast<RequestContext *>(ngx_http_get_module_ctx(request, appguard_nginx_module));
+
+    if (!ctx || ctx->body == BODY_UNCHECKED)
+    {
+        value->not_found = 1;
+        return NGX_OK;
+    }
+
+    value->len = states[ctx->body].len;
+    value->data = states[ctx->body].data;
+    value->valid = 1;
+    value->no_cacheable = 0;
+    value->not_found = 0;
+
+    return NGX_OK;
+}
+
+static bool IsSampled(ngx_http_request_t *request, AppGuardNginxModule::Config *conf)
+{
+    if (conf->sample_rate >= AppGuardNginxModule::SAMPLE_RATE_SCALE)
+        return true;
+
+    if (conf->sample_rate == 0)
+        return false;
+
+    if (conf->sample_by == AppGuardNginxModule::SAMPLE_BY_SOURCE_IP)
+    {
+        ngx_str_t *addr = &request->connection->addr_text;
+        return ngx_crc32_short(addr->data, addr->len) % AppGuardNginxModule::SAMPLE_RATE_SCALE < conf->sample_rate;
+    }
+
+    // A random roll is kept on the request, so the access, header filter and log
+    // phases inspect the same requests.
+    auto ctx = GetRequestContext(request);
+    if (ctx && ctx->sampled != SAMPLE_UNDECIDED)
+        return ctx->sampled == SAMPLE_IN;
+
+    bool sampled = static_cast<ngx_uint_t>(ngx_random()) % AppGuardNginxModule::SAMPLE_RATE_SCALE < conf->sample_rate;
+
+    if (ctx)
+        ctx->sampled = sampled ? SAMPLE_IN : SAMPLE_OUT;
+
+    return sampled;
+}
+
+static appguard_commands::FirewallPolicy LookupCachedVerdict(ngx_http_request_t *request)
+{
+    auto &cache = AppguardHttpCache<HttpRequestCacheKey>::GetInstance();
+    if (!cache.IsEnabled())
+        return appguard_commands::FirewallPolicy::UNKNOWN;
+
+    auto key = HttpRequestCacheKey::FromRequest(appguard::inner_utils::ExtractHttpRequestKeyInfo(request));
+    return cache.Get(key).value_or(appguard_commands::FirewallPolicy::UNKNOWN);
+}
+
+static void LogMonitorVerdict(const std::string &subject, const grpc::Status &status, appguard_commands::FirewallPolicy policy)
+{
+    if (!status.ok())
+    {
+        AppGuardReportQueue::Instance().Failed();
+        return;
+    }
+
+    if (policy == appguard_commands::FirewallPolicy::DENY)
+    {
+        ngx_log_error(
+            NGX_LOG_WARN,
+            ngx_cycle->log,
+            0,
+            "AppGuard (monitor): would deny %s",
+            subject.c_str());
+    }
+}
+
+static void MonitorRequest(ngx_http_request_t *request, AppGuardWrapper &client)
+{
+    auto http_request = BuildHttpRequest(request);
+    auto subject = "request \"" + http_request.method() + " " + http_request.original_url() + "\"";
+
+    AppGuardReportQueue::Task task;
+
+    if (const auto *tcp_info = AppguardTcpInfoCache::Get(request); tcp_info)
+    {
+        *http_request.mutable_tcp_info() = *tcp_info;
+
+        task = [client, http_request = std::move(http_request), subject = std::move(subject)](AppGuardReportQueue::Done done) mutable
+        {
+            client.HandleHttpRequestAsync(
+                std::move(http_request),
+                [subject = std::move(subject), done = std::move(done)](const grpc::Status &status, appguard_commands::FirewallPolicy policy)
+                {
+                    LogMonitorVerdict(subject, status, policy);
+                    done();
+                });
+        };
+    }
+    else
+    {
+        auto connection = appguard::inner_utils::ExtractTcpConnectionInfo(request);
+
+        // Only a real AppGuardTcpInfo is cached: the enforcing phases trust whatever
+        // is stored on the connection, and a failed or dropped report must not leave
+        // a tuple without tcp_id behind for them.
+        ngx_connection_t *c = AppguardTcpInfoCache::ClientConnection(request);
+        ngx_atomic_uint_t number = c->number;
+
+        task = [client, connection = std::move(connection), http_request = std::move(http_request), subject = std::move(subject), c, number](AppGuardReportQueue::Done done) mutable
+        {
+            client.HandleTcpConnectionAsync(
+                std::move(connection),
+                [client, http_request = std::move(http_request), subject = std::move(subject), c, number, done = std::move(done)](const grpc::Status &status, appguard::AppGuardTcpResponse &response) mutable
+                {
+                    if (status.ok())
+                    {
+                        *http_request.mutable_tcp_info() = response.tcp_info();
+
+                        // The connection slot may have been reused by the time this runs.
+                        AppGuardEventNotifier::Instance().Post(
+                            [c, number, tcp_info = response.tcp_info()]()
+                            {
+                                if (c->number == number && c->fd != (ngx_socket_t)-1)
+                                    AppguardTcpInfoCache::Put(c, tcp_info);
+                            });
+                    }
+
+                    client.HandleHttpRequestAsync(
+                        std::move(http_request),
+                        [subject = std::move(subject), done](const grpc::Status &status, appguard_commands::FirewallPolicy policy)
+                        {
+                            LogMonitorVerdict(subject, status, policy);
+                            done();
+                        });
+                });
+        };
+    }
+
+    AppGuardReportQueue::Instance().Submit(std::move(task), request->connection->log);
+}
+
+static void MonitorResponse(
+    ngx_http_request_t *request,
+    AppGuardWrapper &client,
+    appguard::AppGuardHttpRequest http_request,
+    appguard::AppGuardHttpResponse http_response)
+{
+    auto subject = "response " + std::to_string(http_response.code()) +
+                   " to \"" + http_request.method() + " " + http_request.original_url() + "\"";
+
+    AppGuardReportQueue::Task task =
+        [client, http_request = std::move(http_request), http_response = std::move(http_response), subject = std::move(subject)](AppGuardReportQueue::Done done) mutable
+    {
+        client.HandleHttpResponseAsync(
+            std::move(http_request),
+            std::move(http_response),
+            [subject = std::move(subject), done = std::move(done)](const grpc::Status &status, appguard_commands::FirewallPolicy policy)
+            {
+                LogMonitorVerdict(subject, status, policy);
+                done();
+            });
+    };
+
+    AppGuardReportQueue::Instance().Submit(std::move(task), request->connection->log);
+}
+
+namespace
+{
+    /**
+     * @brief A completed request whose response is reported from the log phase.
+     */
+    struct ResponseReport
+    {
+        // Client of the location; lives as long as the worker.
+        AppGuardWrapper *client;
+        appguard::AppGuardHttpRequest request;
+        appguard::AppGuardHttpResponse response;
+    };
+}
+
+// Maximum number of responses reported by a single queue task.
+static constexpr size_t RESPONSE_REPORTS_PER_TASK = 64;
+
+// Responses of the requests completed in the current event loop iteration.
+static std::vector<ResponseReport> response_reports;
+// Posted event flushing `response_reports` once the current iteration is over.
+static ngx_event_t response_reports_event;
+
+/**
+ * @brief Submits the responses collected in this event loop iteration as one queue task.
+ *
+ * The responses of each client are sent as one `HandleHttpResponseBatch` call; the
+ * wrapper caches every verdict of the batch when the reply arrives.
+ */
+static void FlushResponseReports(ngx_event_t *event)
+{
+    if (response_reports.empty())
+        return;
+
+    auto reports = std::make_shared<std::vector<ResponseReport>>(std::move(response_reports));
+    response_reports.clear();
+
+    size_t count = reports->size();
+
+    AppGuardReportQueue::Task task = [reports](AppGuardReportQueue::Done done)
+    {
+        // Locations usually share a client, so there are seldom more than a few groups.
+        std::vector<AppGuardWrapper *> clients;
+
+        for (const auto &report : *reports)
+        {
+            if (std::find(clients.begin(), clients.end(), report.client) == clients.end())
+                clients.push_back(report.client);
+        }
+
+        auto remaining = std::make_shared<std::atomic_size_t>(clients.size());
+
+        for (auto *client : clients)
+        {
+            std::vector<appguard::AppGuardHttpRequest> requests;
+            std::vector<appguard::AppGuardHttpResponse> responses;
+
+            for (auto &report : *reports)
+            {
+                if (report.client != client)
+                    continue;
+
+                requests.push_back(std::move(report.request));
+                responses.push_back(std::move(report.response));
+            }
+
+            size_t size = responses.size();
+
+            client->HandleHttpResponseBatchAsync(
+                std::move(requests),
+                std::move(responses),
+                [remaining, done, size](const grpc::Status &status, const std::vector<appguard_commands::FirewallPolicy> &)
+                {
+                    if (!status.ok())
+                        AppGuardReportQueue::Instance().Failed(size);
+
+                    if (--*remaining == 0)
+                        done();
+                });
+        }
+    };
+
+    AppGuardReportQueue::Instance().Submit(std::move(task), event->log, count);
+}
+
+static void ReportResponse(ResponseReport report)
+{
+    response_reports.push_back(std::move(report));
+
+    if (response_reports.size() >= RESPONSE_REPORTS_PER_TASK)
+    {
+        FlushResponseReports(&response_reports_event);
+        return;
+    }
+
+    if (!response_reports_event.posted)
+        ngx_post_event(&response_reports_event, &ngx_posted_events);
+}
+
+ngx_int_t AppGuardNginxModule::AddVariables(ngx_conf_t *cf)
+{
+    static ngx_str_t name = ngx_string("appguard_request_body");
+
+    ngx_http_variable_t *variable = ngx_http_add_variable(cf, &name, NGX_HTTP_VAR_NOCACHEABLE);
+    if (variable == nullptr)
+        return NGX_ERROR;
+
+    variable->get_handler = GetRequestBodyVariable;
+
+    return NGX_OK;
+}
+
+ngx_int_t AppGuardNginxModule::Initialize(ngx_conf_t *cf)
+{
+    try
+    {
+        Storage::Initialize();
+    }
+    catch (...)
+    {
+        ngx_log_error(
+            NGX_LOG_ERR,
+            cf->log,
+            0,
+            "AppGuard: Failed to initialize persistent storage");
+        return NGX_ERROR;
+    }
+
+    auto *cmcf = static_cast<ngx_http_core_main_conf_t *>(
+        ngx_http_conf_get_module_main_conf(cf, ngx_http_core_module));
+
+    auto *h = static_cast<ngx_http_handler_pt *>(
+        ngx_array_push(&cmcf->phases[NGX_HTTP_PREACCESS_PHASE].handlers));
+
+    if (h == nullptr)
+        return NGX_ERROR;
+
+    *h = ngx_http_appguard_request_handler;
+
+    h = static_cast<ngx_http_handler_pt *>(
+        ngx_array_push(&cmcf->phases[NGX_HTTP_LOG_PHASE].handlers));
+
+    if (h == nullptr)
+        return NGX_ERROR;
+
+    *h = ngx_http_appguard_log_handler;
+
+    next_header_filter = ngx_http_top_header_filter;
+    ngx_http_top_header_filter = ngx_http_appguard_response_handler;
+
+    next_body_filter = ngx_http_top_body_filter;
+    ngx_http_top_body_filter = ngx_http_appguard_response_body_handler;
+
+    next_request_body_filter = ngx_http_top_request_body_filter;
+    ngx_http_top_request_body_filter = ngx_http_appguard_request_body_filter;
+
+    return NGX_OK;
+}
+
+void *AppGuardNginxModule::CreateLocConfig(ngx_conf_t *cf)
+{
+    void *memory = ngx_pcalloc(cf->pool, sizeof(Config));
+
+    if (!memory)
+        return nullptr;
+
+    return new (memory) Config();
+}
+
+char *AppGuardNginxModule::MergeLocConfig(ngx_conf_t *cf, void *parent, void *child)
+{
+    auto *prev = static_cast<AppGuardNginxModule::Config *>(parent);
+    auto *conf = static_cast<AppGuardNginxModule::Config *>(child);
+
+    ngx_conf_merge_value(conf->enabled, prev->enabled, 0);
+    ngx_conf_merge_value(conf->tls, prev->tls, 0);
+
+    ngx_conf_merge_str_value(conf->server_addr, prev->server_addr, "");
+    ngx_conf_merge_str_value(conf->installation_code, prev->installation_code, "");
+
+    ngx_conf_merge_str_value(conf->default_policy, prev->default_policy, "");
+    ngx_conf_merge_str_value(conf->server_cert_path, prev->server_cert_path, "");
+
+    conf->policy = appguard::inner_utils::StringToFirewallPolicy(
+        appguard::inner_utils::NgxStringToStdString(&conf->default_policy));
+
+    ngx_conf_merge_uint_value(conf->mode, prev->mode, MODE_ENFORCE);
+    ngx_conf_merge_uint_value(conf->sample_rate, prev->sample_rate, SAMPLE_RATE_SCALE);
+    ngx_conf_merge_uint_value(conf->sample_by, prev->sample_by, SAMPLE_BY_RANDOM);
+    ngx_conf_merge_msec_value(conf->timeout, prev->timeout, 0);
+    ngx_conf_merge_value(conf->async, prev->async, 0);
+    ngx_conf_merge_value(conf->tcp_correlation, prev->tcp_correlation, 0);
+    ngx_conf_merge_uint_value(conf->response_check, prev->response_check, RESPONSE_CHECK_SYNC);
+
+    ngx_conf_merge_value(conf->body_inspection, prev->body_inspection, 0);
+    ngx_conf_merge_size_value(conf->body_max_size, prev->body_max_size, 64 * 1024);
+    ngx_conf_merge_bitmask_value(
+        conf->body_methods,
+        prev->body_methods,
+        NGX_CONF_BITMASK_SET | NGX_HTTP_POST | NGX_HTTP_PUT | NGX_HTTP_PATCH);
+
+    if (conf->body_types == NGX_CONF_UNSET_PTR)
+    {
+        if (prev->body_types == NGX_CONF_UNSET_PTR)
+        {
+            static ngx_str_t default_types[] = {
+                ngx_string("application/x-www-form-urlencoded"),
+                ngx_string("application/json"),
+                ngx_string("application/xml"),
+                ngx_string("text/plain")};
+
+            prev->body_types = ngx_array_create(cf->pool, 4, sizeof(ngx_str_t));
+            if (prev->body_types == nullptr)
+                return static_cast<char *>(NGX_CONF_ERROR);
+
+            for (ngx_str_t &type : default_types)
+            {
+                auto *entry = static_cast<ngx_str_t *>(ngx_array_push(prev->body_types));
+                if (entry == nullptr)
+                    return static_cast<char *>(NGX_CONF_ERROR);
+
+                *entry = type;
+            }
+        }
+
+        conf->body_types = prev->body_types;
+    }
+
+    ngx_conf_merge_ptr_value(conf->bypass, prev->bypass, nullptr);
+
+    ngx_conf_merge_uint_value(conf->batch_window, prev->batch_window, 0);
+    ngx_conf_merge_uint_value(conf->batch_size, prev->batch_size, 64);
+    ngx_conf_merge_value(conf->decision_stream, prev->decision_stream, 0);
+    ngx_conf_merge_value(conf->channels, prev->channels, 1);
+    ngx_conf_merge_uint_value(conf->startup, prev->startup, STARTUP_DEFAULT_POLICY);
+    ngx_conf_merge_msec_value(conf->error_log_interval, prev->error_log_interval, 10000);
+    ngx_conf_merge_ptr_value(conf->agent_zone, prev->agent_zone, nullptr);
+    ngx_conf_merge_ptr_value(conf->cache_zone, prev->cache_zone, nullptr);
+
+    // Requests only read the client settings; they are resolved once here.
+    if (conf->installation_code.len > 0)
+    {
+        ngx_pool_cleanup_t *cln = ngx_pool_cleanup_add(cf->pool, 0);
+        if (cln == nullptr)
+            return static_cast<char *>(NGX_CONF_ERROR);
+
+        conf->client_info = MakeClientInfo(conf);
+
+        cln->data = conf->client_info;
+        cln->handler = CleanupClientInfo;
+    }
+
+    // `InitProcess` starts one client per distinct key; locations sharing a key share it,
+    // and disabled locations that merely inherit an installation code need none.
+    if (conf->enabled && conf->client_info)
+    {
+        auto *http_ctx = reinterpret_cast<ngx_http_conf_ctx_t *>(ngx_get_conf(cf->cycle->conf_ctx, ngx_http_module));
+        auto *http_conf = static_cast<AppGuardNginxModule::Config *>(http_ctx->loc_conf[appguard_nginx_module.ctx_index]);
+
+        if (http_conf->clients == nullptr)
+        {
+            http_conf->clients = ngx_array_create(cf->pool, 4, sizeof(AppGuardNginxModule::Config *));
+            if (http_conf->clients == nullptr)
+                return static_cast<char *>(NGX_CONF_ERROR);
+        }
+
+        auto **confs = static_cast<AppGuardNginxModule::Config **>(http_conf->clients->elts);
+        bool registered = false;
+
+        for (ngx_uint_t i = 0; i < http_conf->clients->nelts && !registered; i++)
+            registered = *confs[i]->client_info == *conf->client_info;
+
+        if (!registered)
+        {
+            auto **slot = static_cast<AppGuardNginxModule::Config **>(ngx_array_push(http_conf->clients));
+            if (slot == nullptr)
+                return static_cast<char *>(NGX_CONF_ERROR);
+
+            *slot = conf;
+        }
+    }
+
+    // Inherited matchers are shared with the parent and compiled only once.
+    if (std::string error; conf->bypass && !conf->bypass->Compile(error))
+    {
+        ngx_conf_log_error(NGX_LOG_EMERG, cf, 0, "appguard_bypass: %s", error.c_str());
+        return static_cast<char *>(NGX_CONF_ERROR);
+    }
+
+    return NGX_CONF_OK;
+}
+
+ngx_int_t AppGuardNginxModule::InitProcess(ngx_cycle_t *cycle)
+{
+    if (ngx_process != NGX_PROCESS_WORKER && ngx_process != NGX_PROCESS_SINGLE)
+        return NGX_OK;
+
+    if (AppGuardEventNotifier::Instance().Initialize(cycle) != NGX_OK)
+    {
+        ngx_log_error(
+            NGX_LOG_ERR,
+            cycle->log,
+            0,
+            "AppGuard: Failed to initialize event notifier; asynchronous mode is disabled");
+    }
+
+    AppGuardReportQueue::Instance().Start();
+
+    if (auto *http_ctx = reinterpret_cast<ngx_http_conf_ctx_t *>(ngx_get_conf(cycle->conf_ctx, ngx_http_module)); http_ctx)
+    {
+        auto *conf = static_cast<AppGuardNginxModule::Config *>(http_ctx->loc_conf[appguard_nginx_module.ctx_index]);
+
+        if (conf->cache_zone && conf->cache_zone != NGX_CONF_UNSET_PTR)
+        {
+            AppguardHttpCache<HttpRequestCacheKey>::GetInstance().Attach(
+                std::make_unique<AppGuardSharedCache>(conf->cache_zone));
+        }
+
+        if (conf->agent_zone && conf->agent_zone != NGX_CONF_UNSET_PTR)
+        {
+            AppGuardAgent::Instance().Attach(conf->agent_zone);
+        }
+
+        // Clients connect and authenticate in the background from now on, so that the first
+        // requests of the worker find them ready.
+        if (conf->clients)
+        {
+            auto **confs = static_cast<AppGuardNginxModule::Config **>(conf->clients->elts);
+
+            for (ngx_uint_t i = 0; i < conf->clients->nelts; i++)
+            {
+                try
+                {
+                    GetClient(confs[i]);
+                }
+                catch (const AppGuardClientException &ex)
+                {
+                    ngx_log_error(NGX_LOG_ERR, cycle->log, 0, "AppGuard: Failed to create client: %s", ex.what());
+                }
+            }
+        }
+    }
+
+    response_reports_event.handler = FlushResponseReports;
+    response_reports_event.log = cycle->log;
+
+    AppGuardErrorLog::Instance().Start(cycle->log);
+
+    return NGX_OK;
+}
+
+void AppGuardNginxModule::ExitProcess(ngx_cycle_t *cycle)
+{
+    response_reports.clear();
+
+    AppGuardReportQueue::Instance().Stop();
+    AppGuardReportQueue::Instance().LogStatistics(cycle->log);
+
+    AppGuardErrorLog::Instance().Stop();
+
+    AppGuardEventNotifier::Instance().Shutdown();
+}
+
+static void CleanupBypassMatcher(void *data)
+{
+    delete static_cast<AppGuardBypassMatcher *>(data);
+}
+
+char *AppGuardNginxModule::SetBypass(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
+{
+    auto *config = static_cast<AppGuardNginxModule::Config *>(conf);
+
+    if (config->bypass == NGX_CONF_UNSET_PTR)
+    {
+        ngx_pool_cleanup_t *cln = ngx_pool_cleanup_add(cf->pool, 0);
+        if (cln == nullptr)
+            return static_cast<char *>(NGX_CONF_ERROR);
+
+        config->bypass = new AppGuardBypassMatcher();
+
+        cln->data = config->bypass;
+        cln->handler = CleanupBypassMatcher;
+    }
+
+    auto *value = static_cast<ngx_str_t *>(cf->args->elts);
+
+    for (ngx_uint_t i = 1; i < cf->args->nelts; i++)
+    {
+        std::string_view pattern(reinterpret_cast<const char *>(value[i].data), value[i].len);
+
+        if (std::string error; !config->bypass->Add(pattern, error))
+        {
+            ngx_conf_log_error(NGX_LOG_EMERG, cf, 0, "invalid bypass pattern \"%V\": %s", &value[i], error.c_str());
+            return static_cast<char *>(NGX_CONF_ERROR);
+        }
+    }
+
+    return NGX_CONF_OK;
+}
+
+char *AppGuardNginxModule::SetSampleRate(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
+{
+    auto *config = static_cast<AppGuardNginxModule::Config *>(conf);
+
+    if (config->sample_rate != NGX_CONF_UNSET_UINT)
+        return const_cast<char *>("is duplicate");
+
+    auto *value = static_cast<ngx_str_t *>(cf->args->elts);
+    ngx_str_t rate = value[1];
+    ngx_int_t scaled;
+
+    if (rate.len > 0 && rate.data[rate.len - 1] == '%')
+    {
+        // Hundredths of a percent are units of 1/10000.
+        scaled = ngx_atofp(rate.data, rate.len - 1, 2);
+    }
+    else
+    {
+        scaled = ngx_atofp(rate.data, rate.len, 4);
+    }
+
+    if (scaled == NGX_ERROR || static_cast<ngx_uint_t>(scaled) > SAMPLE_RATE_SCALE)
+    {
+        ngx_conf_log_error(NGX_LOG_EMERG, cf, 0, "invalid sample rate \"%V\"", &rate);
+        return static_cast<char *>(NGX_CONF_ERROR);
+    }
+
+    config->sample_rate = static_cast<ngx_uint_t>(scaled);
+    config->sample_by = SAMPLE_BY_RANDOM;
+
+    if (cf->args->nelts == 3)
+    {
+        if (ngx_strcmp(value[2].data, "source_ip") == 0)
+        {
+            config->sample_by = SAMPLE_BY_SOURCE_IP;
+        }
+        else if (ngx_strcmp(value[2].data, "random") != 0)
+        {
+            ngx_conf_log_error(NGX_LOG_EMERG, cf, 0, "invalid sampling method \"%V\"", &value[2]);
+            return static_cast<char *>(NGX_CONF_ERROR);
+        }
+    }
+
+    return NGX_CONF_OK;
+}
+
+char *AppGuardNginxModule::SetServerAddr(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
+{
+    auto *config = static_cast<AppGuardNginxModule::Config *>(conf);
+
+    if (config->server_addr.data)
+        return const_cast<char *>("is duplicate");
+
+    auto *value = static_cast<ngx_str_t *>(cf->args->elts);
+    size_t len = 0;
+
+    for (ngx_uint_t i = 1; i < cf->args->nelts; i++)
+    {
+        if (value[i].len == 0 || ngx_strlchr(value[i].data, value[i].data + value[i].len, ',') != nullptr)
+        {
+            ngx_conf_log_error(NGX_LOG_EMERG, cf, 0, "invalid address \"%V\"", &value[i]);
+            return static_cast<char *>(NGX_CONF_ERROR);
+        }
+
+        len += value[i].len + 1;
+    }
+
+    u_char *p = static_cast<u_char *>(ngx_pnalloc(cf->pool, len));
+    if (p == nullptr)
+        return static_cast<char *>(NGX_CONF_ERROR);
+
+    config->server_addr.data = p;
+    config->server_addr.len = len - 1;
+
+    for (ngx_uint_t i = 1; i < cf->args->nelts; i++)
+    {
+        if (i > 1)
+            *p++ = ',';
+
+        p = ngx_cpymem(p, value[i].data, value[i].len);
+    }
+
+    return NGX_CONF_OK;
+}
+
+char *AppGuardNginxModule::SetAgent(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
+{
+    auto *config = static_cast<AppGuardNginxModule::Config *>(conf);
+
+    if (config->agent_zone != NGX_CONF_UNSET_PTR)
+        return const_cast<char *>("is duplicate");
+
+    auto *value = static_cast<ngx_str_t *>(cf->args->elts);
+
+    if (ngx_strcmp(value[1].data, "off") == 0)
+    {
+        config->agent_zone = nullptr;
+        return NGX_CONF_OK;
+    }
+
+    if (ngx_strcmp(value[1].data, "on") != 0)
+    {
+        ngx_conf_log_error(NGX_LOG_EMERG, cf, 0, "invalid value \"%V\", it must be \"on\" or \"off\"", &value[1]);
+        return static_cast<char *>(NGX_CONF_ERROR);
+    }
+
+    config->agent_zone = AppGuardAgent::AddZone(cf, &appguard_nginx_module);
+    if (config->agent_zone == nullptr)
+        return static_cast<char *>(NGX_CONF_ERROR);
+
+    return NGX_CONF_OK;
+}
+
+char *AppGuardNginxModule::SetCacheZone(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
+{
+    auto *config = static_cast<AppGuardNginxModule::Config *>(conf);
+
+    if (config->cache_zone != NGX_CONF_UNSET_PTR)
+        return const_cast<char *>("is duplicate");
+
+    auto *value = static_cast<ngx_str_t *>(cf->args->elts);
+
+    u_char *colon = ngx_strlchr(value[1].data, value[1].data + value[1].len, ':');
+    if (colon == nullptr || colon == value[1].data)
+    {
+        ngx_conf_log_error(NGX_LOG_EMERG, cf, 0, "invalid zone \"%V\", expected <name>:<size>", &value[1]);
+        return static_cast<char *>(NGX_CONF_ERROR);
+    }
+
+    ngx_str_t name{static_cast<size_t>(colon - value[1].data), value[1].data};
+    ngx_str_t size_str{static_cast<size_t>(value[1].data + value[1].len - colon - 1), colon + 1};
+
+    ssize_t size = ngx_parse_size(&size_str);
+
+    if (size == NGX_ERROR || size < static_cast<ssize_t>(8 * ngx_pagesize))
+    {
+        ngx_conf_log_error(NGX_LOG_EMERG, cf, 0, "invalid zone size \"%V\"", &size_str);
+        return static_cast<char *>(NGX_CONF_ERROR);
+    }
+
+    config->cache_zone = AppGuardSharedCache::AddZone(cf, &name, static_cast<size_t>(size), &appguard_nginx_module);
+    if (config->cache_zone == nullptr)
+        return static_cast<char *>(NGX_CONF_ERROR);
+
+    return NGX_CONF_OK;
+}
+
+char *AppGuardNginxModule::SetBatch(ngx_conf_t *cf, ngx_command_t *cmd, void *conf)
+{
+    auto *config = static_cast<AppGuardNginxModule::Config *>(conf);
+
+    if (config->batch_window != NGX_CONF_UNSET_UINT)
+        return const_cast<char *>("is duplicate");
+
+    auto *value = static_cast<ngx_str_t *>(cf->args->elts);
+
+    if (ngx_strcmp(value[1].data, "off") == 0)
+    {
+        if (cf->args->nelts == 3)
+            return const_cast<char *>("takes no batch size when off");
+
+        config->batch_window = 0;
+        return NGX_CONF_OK;
+    }
+
+    ngx_str_t window = value[1];
+    ngx_int_t micros;
+
+    if (window.len > 2 && ngx_strncmp(window.data + window.len - 2, "us", 2) == 0)
+    {
+        micros = ngx_atoi(window.data, window.len - 2);
+    }
+    else
+    {
+        micros = ngx_parse_time(&window, 0);
+        if (micros != NGX_ERROR)
+            micros *= 1000;
+    }
+
+    if (micros == NGX_ERROR || micros == 0)
+    {
+        ngx_conf_log_error(NGX_LOG_EMERG, cf, 0, "invalid batch window \"%V\"", &window);
+        return static_cast<char *>(NGX_CONF_ERROR);
+    }
+
+    config->batch_window = static_cast<ngx_uint_t>(micros);
+
+    if (cf->args->nelts == 3)
+    {
+        ngx_int_t size = ngx_atoi(value[2].data, value[2].len);
+        if (size == NGX_ERROR || size == 0)
+        {
+            ngx_conf_log_error(NGX_LOG_EMERG, cf, 0, "invalid batch size \"%V\"", &value[2]);
+            return static_cast<char *>(NGX_CONF_ERROR);
+        }
+
+        config->batch_size = static_cast<ngx_uint_t>(size);
+    }
+
+    return NGX_CONF_OK;
+}
+
+ngx_int_t AppGuardNginxModule::RequestHandler(ngx_http_request_t *request)
+{
+    // Subrequests and internal redirects were already inspected as part of the original request.
+    if (request != request->main || request->internal)
+        return NGX_DECLINED;
+
+    auto *conf = static_cast<AppGuardNginxModule::Config *>(ngx_http_get_module_loc_conf(request, appguard_nginx_module));
+    if (!conf || !conf->enabled)
+        return NGX_DECLINED;
+
+    if (conf->bypass && conf->bypass->Matches(request->uri))
+        return NGX_DECLINED;
+
+    auto default_policy = DefaultPolicy(conf);
+
+    auto *ctx = static_cast<RequestContext *>(ngx_http_get_module_ctx(request, appguard_nginx_module));
+
+    if (ctx && ctx->requested)
+    {
+        if (ctx->pending)
+            return NGX_DONE;
+
+        return ActOnPolicy(ctx->policy, default_policy);
+    }
+
+    // Skipped requests only cost a cache lookup. A request re-entering after its body
+    // has been read gets the decision it was sampled with.
+    if (!IsSampled(request, conf))
+    {
+        if (conf->mode == MODE_MONITOR)
+            return NGX_DECLINED;
+
+        return ActOnPolicy(LookupCachedVerdict(request), default_policy);
+    }
+
+    // The handler is re-entered once the body has been read.
+    if (!ctx || ctx->body == BODY_UNCHECKED)
+    {
+        if (ngx_int_t rc = ReadRequestBody(request, conf); rc != NGX_DECLINED)
+            return rc;
+    }
+
+    if (!conf->client_info)
+    {
+        if (conf->mode == MODE_MONITOR)
+            return NGX_DECLINED;
+
+        ngx_log_error(
+            NGX_LOG_ERR,
+            request->connection->log,
+            0,
+            "AppGuard: Installation Code hasn't been set; falling back to default policy '%V'",
+            &conf->default_policy);
+
+        return ActOnPolicy(appguard_commands::FirewallPolicy::UNKNOWN, default_policy);
+    }
+
+    try
+    {
+        auto &client = GetClient(conf);
+
+        if (conf->mode == MODE_MONITOR)
+        {
+            MonitorRequest(request, client);
+            return NGX_DECLINED;
+        }
+
+        if (conf->async && AppGuardEventNotifier::Instance().Active())
+            return SuspendRequest(request, conf, client);
+
+        // The messages of the calls live on an arena backed by the request pool.
+        google::protobuf::Arena arena(RequestArenaOptions(request));
+
+        // The TCP verdict is fetched once per client connection and shared by
+        // every request on it.
+        appguard::AppGuardTcpResponse tcp_response;
+        const auto *tcp_info = AppguardTcpInfoCache::Get(request);
+
+        if (!tcp_info && conf->tcp_correlation)
+        {
+            auto *http_request = google::protobuf::Arena::CreateMessage<appguard::AppGuardHttpRequest>(&arena);
+            BuildHttpRequest(request, *http_request);
+
+            auto policy = client.TryHandleTcpConnectionAndHttpRequest(
+                appguard::inner_utils::ExtractTcpConnectionInfo(request),
+                *http_request,
+                tcp_response);
+
+            if (tcp_response.has_tcp_info())
+                AppguardTcpInfoCache::Put(request, tcp_response.tcp_info());
+
+            if (!policy)
+                return FallBack(request, conf, policy.Error().what);
+
+            return ActOnPolicy(*policy, default_policy);
+        }
+
+        if (!tcp_info)
+        {
+            auto *connection = google::protobuf::Arena::CreateMessage<appguard::AppGuardTcpConnection>(&arena);
+            appguard::inner_utils::ExtractTcpConnectionInfo(request, *connection);
+
+            auto result = client.TryHandleTcpConnection(*connection);
+            if (!result)
+                return FallBack(request, conf, result.Error().what);
+
+            tcp_response = std::move(*result);
+
+            tcp_info = AppguardTcpInfoCache::Put(request, tcp_response.tcp_info());
+            if (!tcp_info)
+                tcp_info = &tcp_response.tcp_info();
+        }
+
+        auto *http_request = google::protobuf::Arena::CreateMessage<appguard::AppGuardHttpRequest>(&arena);
+        BuildHttpRequest(request, *http_request);
+        AttachTcpInfo(*http_request, *tcp_info);
+
+        auto policy = client.TryHandleHttpRequest(*http_request);
+        if (!policy)
+            return FallBack(request, conf, policy.Error().what);
+
+        return ActOnPolicy(*policy, default_policy);
+    }
+    catch (AppGuardClientException &ex)
+    {
+        // Only creating the client throws; calls report their failures in their results.
+        return FallBack(request, conf, ex.what());
+    }
+}
+
+ngx_int_t AppGuardNginxModule::ResponseHandler(ngx_http_request_t *request)
+{
+    auto *conf = static_cast<AppGuardNginxModule::Config *>(ngx_http_get_module_loc_conf(request, appguard_nginx_module));
+    if (!conf || !conf->enabled)
+        return next_header_filter(request);
+
+    if (conf->response_check == RESPONSE_CHECK_LOG)
+        return next_header_filter(request);
+
+    if (conf->bypass && conf->bypass->Matches(request->uri))
+        return next_header_filter(request);
+
+    if (auto *ctx = static_cast<RequestContext *>(ngx_http_get_module_ctx(request, appguard_nginx_module));
+        ctx && ctx->response_checked)
+        return next_header_filter(request);
+
+    if (!IsSampled(request, conf))
+        return next_header_filter(request);
+
+    auto default_policy = DefaultPolicy(conf);
+
+    if (!conf->client_info)
+    {
+        if (conf->mode == MODE_MONITOR)
+            return next_header_filter(request);
+
+        ngx_log_error(
+            NGX_LOG_ERR,
+            request->connection->log,
+            0,
+            "AppGuard: Installation code hasn't been set; falling back to default policy '%V'",
+            &conf->default_policy);
+
+        ngx_int_t code = ActOnPolicy(appguard_commands::FirewallPolicy::UNKNOWN, default_policy);
+        return code == NGX_DECLINED ? next_header_filter(request) : code;
+    }
+
+    try
+    {
+        auto &client = GetClient(conf);
+
+        // Subrequest output is interleaved by the postpone filter, so only the main
+        // request is held back.
+        bool deferred = conf->response_check == RESPONSE_CHECK_DEFERRED &&
+                        request == request->main &&
+                        AppGuardEventNotifier::Instance().Active();
+
+        // Calls outliving the handler own their messages.
+        if (conf->mode == MODE_MONITOR || deferred)
+        {
+            appguard::AppGuardHttpRequest http_request;
+            appguard::AppGuardHttpResponse http_response;
+            BuildHttpResponse(request, http_request, http_response);
+
+            if (deferred && conf->mode != MODE_MONITOR)
+                return DeferResponse(request, client, std::move(http_request), std::move(http_response));
+
+            MonitorResponse(request, client, std::move(http_request), std::move(http_response));
+            return next_header_filter(request);
+        }
+
+        google::protobuf::Arena arena(RequestArenaOptions(request));
+
+        auto *http_request = google::protobuf::Arena::CreateMessage<appguard::AppGuardHttpRequest>(&arena);
+        auto *http_response = google::protobuf::Arena::CreateMessage<appguard::AppGuardHttpResponse>(&arena);
+        BuildHttpResponse(request, *http_request, *http_response);
+
+        auto policy = client.TryHandleHttpResponse(*http_request, *http_response);
+        ngx_int_t code = policy ? ActOnPolicy(*policy, default_policy) : FallBack(request, conf, policy.Error().what);
+        return code == NGX_DECLINED ? next_header_filter(request) : code;
+    }
+    catch (AppGuardClientException &ex)
+    {
+        ngx_int_t code = FallBack(request, conf, ex.what());
+        return code == NGX_DECLINED ? next_header_filter(request) : code;
+    }
+}
+
+ngx_int_t AppGuardNginxModule::LogHandler(ngx_http_request_t *request)
+{
+    auto *conf = static_cast<AppGuardNginxModule::Config *>(ngx_http_get_module_loc_conf(request, appguard_nginx_module));
+    if (!conf || !conf->enabled || conf->response_check != RESPONSE_CHECK_LOG)
+        return NGX_OK;
+
+    if (conf->bypass && conf->bypass->Matches(request->uri))
+        return NGX_OK;
+
+    if (!IsSampled(request, conf))
+        return NGX_OK;
+
+    if (!conf->client_info)
+        return NGX_OK;
+
+    try
+    {
+        auto &client = GetClient(conf);
+
+        appguard::AppGuardHttpRequest http_request;
+        appguard::AppGuardHttpResponse http_response;
+        BuildHttpResponse(request, http_request, http_response);
+
+        ReportResponse({&client, std::move(http_request), std::move(http_response)});
+    }
+    catch (AppGuardClientException &ex)
+    {
+        ngx_log_error(NGX_LOG_ERR, request->connection->log, 0, "AppGuardClientException: %s", ex.what());
+    }
+
+    return NGX_OK;
+}
+
+ngx_int_t AppGuardNginxModule::RequestBodyFilter(ngx_http_request_t *request, ngx_chain_t *chain)
+{
+    auto *ctx = static_cast<RequestContext *>(ngx_http_get_module_ctx(request, appguard_nginx_module));
+    if (!ctx || ctx->body != BODY_READING)
+        return next_request_body_filter(request, chain);
+
+    for (ngx_chain_t *cl = chain; cl; cl = cl->next)
+        ctx->body_received += ngx_buf_size(cl->buf);
+
+    // Chunked and HTTP/2 bodies have no announced length, so the cap is checked as they
+    // arrive. Past it the body is no longer inspected, and the buffers already received
+    // are handed to nginx's own body handling instead of being held for AppGuard.
+    auto *conf = static_cast<AppGuardNginxModule::Config *>(ngx_http_get_module_loc_conf(request, appguard_nginx_module));
+
+    if (ctx->body_received > static_cast<off_t>(conf->body_max_size))
+    {
+        ctx->body = BODY_TOO_LARGE;
+
+        // Flush what is buffered in memory to the temporary file; the rest of the body
+        // is read only because the content phase needs it whole.
+        request->request_body_in_file_only = 1;
+    }
+
+    return next_request_body_filter(request, chain);
+}
+
+ngx_int_t AppGuardNginxModule::ResponseBodyHandler(ngx_http_request_t *request, ngx_chain_t *chain)
+{
+    auto *ctx = static_cast<RequestContext *>(ngx_http_get_module_ctx(request, appguard_nginx_module));
+    if (!ctx || !ctx->response_pending)
+        return next_body_filter(request, chain);
+
+    if (ngx_chain_add_copy(request->pool, &ctx->out, chain) != NGX_OK)
+        return NGX_ERROR;
+
+    return NGX_OK;
+}
\ No newline at end of file
@@ -9,6 +9,10 @@ extern "C"
 
 #include <string>
 
+class AppGuardBypassMatcher;
+class AppGuardWrapper;
+struct AppGaurdClientInfo;
+
 /**
  * @brief NGINX module integration for AppGuard.
  *
@@ -18,6 +22,55 @@ extern "C"
 class AppGuardNginxModule
 {
 public:
+    /**
+     * @brief Whether AppGuard verdicts are enforced or only reported (`appguard_mode`).
+     */
+    enum Mode : ngx_uint_t
+    {
+        // Verdicts are applied to requests and responses.
+        MODE_ENFORCE,
+        // Requests and responses are reported off the request path; verdicts are only logged.
+        MODE_MONITOR
+    };
+
+    /**
+     * @brief How requests are picked for inspection (`appguard_sample_rate`).
+     */
+    enum SampleBy : ngx_uint_t
+    {
+        // Every request is sampled independently.
+        SAMPLE_BY_RANDOM,
+        // Clients are sampled by a hash of their address, so a client is consistently in or out.
+        SAMPLE_BY_SOURCE_IP
+    };
+
+    /// Sampling rates are expressed in units of 1/`SAMPLE_RATE_SCALE`.
+    static constexpr ngx_uint_t SAMPLE_RATE_SCALE = 10'000;
+
+    /**
+     * @brief How response headers are inspected (`appguard_response_check`).
+     */
+    enum ResponseCheck : ngx_uint_t
+    {
+        // Block inside the header filter until the verdict arrives.
+        RESPONSE_CHECK_SYNC,
+        // Hold the headers and body, resume the filter chain once the verdict arrives.
+        RESPONSE_CHECK_DEFERRED,
+        // Don't hold the response; report it from the log phase to feed the server and the cache.
+        RESPONSE_CHECK_LOG
+    };
+
+    /**
+     * @brief What happens to calls made before the client has its first token (`appguard_startup`).
+     */
+    enum Startup : ngx_uint_t
+    {
+        // The calls fail at once and the default policy applies.
+        STARTUP_DEFAULT_POLICY,
+        // The calls wait for the token, up to their timeout; asynchronous calls don't block the worker.
+        STARTUP_QUEUE
+    };
+
     /**
      * @brief Configuration structure for the AppGuard NGINX module.
      */
@@ -33,10 +86,66 @@ public:
         ngx_str_t installation_code = ngx_null_string;
         // Default policy to apply when AppGuard is unreachable or misconfigured.
         ngx_str_t default_policy = ngx_null_string;
+        // `default_policy` parsed into an `appguard_commands::FirewallPolicy`.
+        ngx_uint_t policy = NGX_CONF_UNSET_UINT;
         // Path to server's certificate file.
         ngx_str_t server_cert_path = ngx_null_string;
+        // Fraction of requests that is inspected, in units of 1/`SAMPLE_RATE_SCALE`.
+        ngx_uint_t sample_rate = NGX_CONF_UNSET_UINT;
+        // How requests are sampled, see `SampleBy`.
+        ngx_uint_t sample_by = NGX_CONF_UNSET_UINT;
+        // Latency budget of each AppGuard call; zero defers to the server default.
+        ngx_msec_t timeout = NGX_CONF_UNSET_MSEC;
+        // Enforcement mode, see `Mode`.
+        ngx_uint_t mode = NGX_CONF_UNSET_UINT;
+        // Suspends requests while AppGuard decides instead of blocking the worker.
+        ngx_flag_t async = NGX_CONF_UNSET;
+        // Sends the first HTTP request of a connection alongside its TCP call.
+        ngx_flag_t tcp_correlation = NGX_CONF_UNSET;
+        // Response inspection mode, see `ResponseCheck`.
+        ngx_uint_t response_check = NGX_CONF_UNSET_UINT;
+        // Sends the request body to AppGuard.
+        ngx_flag_t body_inspection = NGX_CONF_UNSET;
+        // Largest body that is sent; larger bodies are skipped.
+        size_t body_max_size = NGX_CONF_UNSET_SIZE;
+        // Methods whose body is sent, as `NGX_HTTP_*` bits.
+        ngx_uint_t body_methods = 0;
+        // Content types whose body is sent.
+        ngx_array_t *body_types = static_cast<ngx_array_t *>(NGX_CONF_UNSET_PTR);
+        // URIs that skip AppGuard, or nullptr if there are none.
+        AppGuardBypassMatcher *bypass = static_cast<AppGuardBypassMatcher *>(NGX_CONF_UNSET_PTR);
+        // Coalescing window of batched calls, in microseconds; zero disables batching.
+        ngx_uint_t batch_window = NGX_CONF_UNSET_UINT;
+        // Largest number of calls in a batch.
+        ngx_uint_t batch_size = NGX_CONF_UNSET_UINT;
+        // Multiplexes the calls over a single decision stream.
+        ngx_flag_t decision_stream = NGX_CONF_UNSET;
+        // Number of channels the calls are spread over.
+        ngx_int_t channels = NGX_CONF_UNSET;
+        // What happens to calls made before the first token, as a `Startup` value.
+        ngx_uint_t startup = NGX_CONF_UNSET_UINT;
+        // Period of the summaries of repeated call failures; zero logs every failure.
+        ngx_msec_t error_log_interval = NGX_CONF_UNSET_MSEC;
+        // Shared memory zone through which workers share control streams, or nullptr if there is none.
+        ngx_shm_zone_t *agent_zone = static_cast<ngx_shm_zone_t *>(NGX_CONF_UNSET_PTR);
+        // Shared memory zone holding the verdict cache of all workers, or nullptr if there is none.
+        ngx_shm_zone_t *cache_zone = static_cast<ngx_shm_zone_t *>(NGX_CONF_UNSET_PTR);
+        // Client settings resolved at configuration time, or nullptr without an installation code.
+        AppGaurdClientInfo *client_info = nullptr;
+        // Client of this worker, created in `InitProcess` or on first use, with the location's timeout applied.
+        AppGuardWrapper *client = nullptr;
+        // Configurations with a client, collected at the http level so that `InitProcess` creates their clients.
+        ngx_array_t *clients = nullptr;
     };
 
+    /**
+     * @brief Registers the module's variables (`$appguard_request_body`).
+     *
+     * @param cf NGINX configuration context.
+     * @return `NGX_OK` on success or `NGX_ERROR` on failure.
+     */
+    static ngx_int_t AddVariables(ngx_conf_t *cf);
+
     /**
      * @brief Initializes the AppGuard module during NGINX configuration phase.
      *
@@ -48,17 +157,35 @@ public:
     static ngx_int_t Initialize(ngx_conf_t *cf);
 
     /**
-     * @brief Creates a new server-level configuration.
+     * @brief Initializes per-worker state of the AppGuard module.
+     *
+     * Registers the event notifier used to resume requests suspended on AppGuard and
+     * attaches the verdict cache and the agent to their shared zones, if configured.
+     *
+     * @param cycle Current NGINX cycle.
+     * @return `NGX_OK` on success or `NGX_ERROR` on failure.
+     */
+    static ngx_int_t InitProcess(ngx_cycle_t *cycle);
+
+    /**
+     * @brief Releases per-worker state of the AppGuard module.
      *
-     * Called by NGINX to allocate configuration memory for a server block.
+     * @param cycle Current NGINX cycle.
+     */
+    static void ExitProcess(ngx_cycle_t *cycle);
+
+    /**
+     * @brief Creates a new location-level configuration.
+     *
+     * Called by NGINX to allocate configuration memory for an http, server or location block.
      *
      * @param cf NGINX configuration context.
      * @return A pointer to the new configuration structure.
      */
-    static void *CreateSrvConfig(ngx_conf_t *cf);
+    static void *CreateLocConfig(ngx_conf_t *cf);
 
     /**
-     * @brief Merges parent and child server-level configurations.
+     * @brief Merges parent and child location-level configurations.
      *
      * Ensures that the child inherits unspecified values from the parent.
      *
@@ -67,13 +194,78 @@ public:
      * @param child  Pointer to the child configuration.
      * @return `NGX_CONF_OK` on success, or a pointer to an error string on failure.
      */
-    static char *MergeSrvConfig(ngx_conf_t *cf, void *parent, void *child);
+    static char *MergeLocConfig(ngx_conf_t *cf, void *parent, void *child);
+
+    /**
+     * @brief Parses `appguard_bypass <pattern>...`; repeated directives add up.
+     *
+     * @param cf   NGINX configuration context.
+     * @param cmd  The directive being parsed.
+     * @param conf The location-level configuration.
+     * @return `NGX_CONF_OK` on success, or a pointer to an error string on failure.
+     */
+    static char *SetBypass(ngx_conf_t *cf, ngx_command_t *cmd, void *conf);
+
+    /**
+     * @brief Parses `appguard_sample_rate <rate> [random | source_ip]`.
+     *
+     * The rate is either a fraction (`0.05`) or a percentage (`5%`).
+     *
+     * @param cf   NGINX configuration context.
+     * @param cmd  The directive being parsed.
+     * @param conf The location-level configuration.
+     * @return `NGX_CONF_OK` on success, or a pointer to an error string on failure.
+     */
+    static char *SetSampleRate(ngx_conf_t *cf, ngx_command_t *cmd, void *conf);
+
+    /**
+     * @brief Parses `appguard_server_addr <address> ...`, storing the addresses comma-separated.
+     *
+     * @param cf   NGINX configuration context.
+     * @param cmd  The directive being parsed.
+     * @param conf The location-level configuration.
+     * @return `NGX_CONF_OK` on success, or a pointer to an error string on failure.
+     */
+    static char *SetServerAddr(ngx_conf_t *cf, ngx_command_t *cmd, void *conf);
+
+    /**
+     * @brief Parses `appguard_agent on | off`.
+     *
+     * @param cf   NGINX configuration context.
+     * @param cmd  The directive being parsed.
+     * @param conf The location-level configuration.
+     * @return `NGX_CONF_OK` on success, or a pointer to an error string on failure.
+     */
+    static char *SetAgent(ngx_conf_t *cf, ngx_command_t *cmd, void *conf);
+
+    /**
+     * @brief Parses `appguard_cache_zone <name>:<size>`.
+     *
+     * @param cf   NGINX configuration context.
+     * @param cmd  The directive being parsed.
+     * @param conf The location-level configuration.
+     * @return `NGX_CONF_OK` on success, or a pointer to an error string on failure.
+     */
+    static char *SetCacheZone(ngx_conf_t *cf, ngx_command_t *cmd, void *conf);
+
+    /**
+     * @brief Parses `appguard_batch off | <window> [<size>]`.
+     *
+     * The window is either a number of microseconds (`200us`) or an NGINX time (`1ms`).
+     *
+     * @param cf   NGINX configuration context.
+     * @param cmd  The directive being parsed.
+     * @param conf The location-level configuration.
+     * @return `NGX_CONF_OK` on success, or a pointer to an error string on failure.
+     */
+    static char *SetBatch(ngx_conf_t *cf, ngx_command_t *cmd, void *conf);
 
     /**
      * @brief Main request handler for the AppGuard module.
      *
      * Invoked during request processing to communicate with the AppGuard server
-     * and determine the response policy.
+     * and determine the response policy. With `appguard_async on` the request is
+     * suspended until the verdict arrives and the handler is re-entered to act on it.
      *
      * @param request The current NGINX HTTP request.
      * @return An appropriate NGINX status code.
@@ -90,4 +282,41 @@ public:
      * @return An appropriate NGINX status code, e.g., `NGX_OK` to continue, `NGX_ABORT` to drop response.
      */
     static ngx_int_t ResponseHandler(ngx_http_request_t *request);
+
+    /**
+     * @brief Log phase handler for the AppGuard module.
+     *
+     * With `appguard_response_check log`, queues the completed response to be reported
+     * to AppGuard in one `HandleHttpResponseBatch` call with the other responses of its
+     * client completed in the same event loop iteration. The verdicts only update the
+     * cache; they are never applied to the response.
+     *
+     * @param request The current NGINX HTTP request.
+     * @return `NGX_OK`.
+     */
+    static ngx_int_t LogHandler(ngx_http_request_t *request);
+
+    /**
+     * @brief HTTP request body filter for the AppGuard module.
+     *
+     * Counts the body bytes received while a body is read for inspection and
+     * marks it too large as soon as `appguard_body_max_size` is crossed.
+     *
+     * @param request The current NGINX HTTP request.
+     * @param chain   The body buffers received so far.
+     * @return An appropriate NGINX status code.
+     */
+    static ngx_int_t RequestBodyFilter(ngx_http_request_t *request, ngx_chain_t *chain);
+
+    /**
+     * @brief HTTP response body filter for the AppGuard module.
+     *
+     * Holds body buffers while a deferred response verdict is pending and passes
+     * them through otherwise.
+     *
+     * @param request The current NGINX HTTP request.
+     * @param chain   The body buffers produced so far.
+     * @return An appropriate NGINX status code.
+     */
+    static ngx_int_t ResponseBodyHandler(ngx_http_request_t *request, ngx_chain_t *chain);
 };
@@ -0,0 +1,131 @@
+#include "appguard.report.queue.hpp"
+
+AppGuardReportQueue &AppGuardReportQueue::Instance()
+{
+    static AppGuardReportQueue instance;
+    return instance;
+}
+
+void AppGuardReportQueue::Start()
+{
+    std::lock_guard lock(this->mutex);
+
+    if (this->running)
+        return;
+
+    this->running = true;
+    this->thread = std::thread([this]()
+                               { this->Run(); });
+}
+
+void AppGuardReportQueue::Stop()
+{
+    {
+        std::lock_guard lock(this->mutex);
+
+        if (!this->running)
+            return;
+
+        this->running = false;
+
+        for (const auto &[_, reports] : this->tasks)
+            this->outstanding -= reports;
+
+        this->tasks.clear();
+    }
+
+    this->cv.notify_all();
+
+    if (this->thread.joinable())
+        this->thread.join();
+}
+
+bool AppGuardReportQueue::Submit(Task task, ngx_log_t *log, std::size_t reports)
+{
+    {
+        std::lock_guard lock(this->mutex);
+
+        if (this->running && this->outstanding + reports <= Capacity)
+        {
+            this->outstanding += reports;
+            this->tasks.emplace_back(std::move(task), reports);
+            this->submitted += reports;
+        }
+        else
+        {
+            task = nullptr;
+        }
+    }
+
+    if (task)
+    {
+        this->cv.notify_one();
+        return true;
+    }
+
+    auto dropped = this->dropped += reports;
+
+    if (this->last_drop_log != ngx_time())
+    {
+        this->last_drop_log = ngx_time();
+
+        ngx_log_error(
+            NGX_LOG_WARN,
+            log,
+            0,
+            "AppGuard: report queue is full; %uL reports dropped so far",
+            dropped);
+    }
+
+    return false;
+}
+
+void AppGuardReportQueue::LogStatistics(ngx_log_t *log) const
+{
+    ngx_log_error(
+        NGX_LOG_NOTICE,
+        log,
+        0,
+        "AppGuard: reports submitted: %uL, dropped: %uL, failed: %uL",
+        this->submitted.load(),
+        this->dropped.load(),
+        this->failed.load());
+}
+
+void AppGuardReportQueue::Run()
+{
+    std::unique_lock lock(this->mutex);
+
+    while (true)
+    {
+        this->cv.wait(lock, [this]
+                      { return !this->running || !this->tasks.empty(); });
+
+        if (!this->running)
+            return;
+
+        auto [task, reports] = std::move(this->tasks.front());
+        this->tasks.pop_front();
+
+        lock.unlock();
+
+        try
+        {
+            task([this, reports = reports]()
+                 { this->Release(reports); });
+        }
+        catch (...)
+        {
+            this->failed += reports;
+            this->Release(reports);
+        }
+
+        lock.lock();
+    }
+}
+
+void AppGuardReportQueue::Release(std::size_t reports)
+{
+    std::lock_guard lock(this->mutex);
+    this->outstanding -= reports;
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+extern "C"
+{
+#include <ngx_config.h>
+#include <ngx_core.h>
+}
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+/**
+ * @brief Bounded background queue for reports whose verdicts are not waited for.
+ *
+ * Workers serialize the report on the event loop and submit a task; a background thread
+ * runs the task, which starts the gRPC call and signals completion through the supplied
+ * callback. A report occupies a slot from submission until its call completes, so a slow
+ * backend fills the queue and further reports are dropped instead of piling up in memory.
+ */
+class AppGuardReportQueue
+{
+public:
+    /// Signals that the call started by a task has completed; must be called exactly once.
+    using Done = std::function<void()>;
+    /// Starts a report on the background thread; may throw only before the call is started.
+    using Task = std::function<void(Done)>;
+
+    /// Maximum number of reports queued or in flight at once.
+    static constexpr std::size_t Capacity = 4096;
+
+    /**
+     * @brief Returns the per-process queue instance.
+     */
+    static AppGuardReportQueue &Instance();
+
+    /**
+     * @brief Starts the background thread.
+     *
+     * Must be called from the worker process (init_process hook).
+     */
+    void Start();
+
+    /**
+     * @brief Stops the background thread, dropping reports that haven't been started.
+     */
+    void Stop();
+
+    /**
+     * @brief Queues a task unless the queue is full.
+     *
+     * Called from the event loop. A task may start several reports at once; they occupy
+     * their slots until the task signals completion.
+     *
+     * @param task The task starting the reports.
+     * @param log Log used to report drops.
+     * @param reports Number of reports started by the task.
+     * @return True if the task was queued; false if its reports were dropped.
+     */
+    bool Submit(Task task, ngx_log_t *log, std::size_t reports = 1);
+
+    /**
+     * @brief Counts reports whose call failed.
+     *
+     * @param reports Number of reports carried by the call.
+     */
+    inline void Failed(std::size_t reports = 1) noexcept { this->failed += reports; }
+
+    /**
+     * @brief Logs the counters of this process.
+     * @param log The log to write to.
+     */
+    void LogStatistics(ngx_log_t *log) const;
+
+private:
+    AppGuardReportQueue() = default;
+
+    /**
+     * @brief Body of the background thread.
+     */
+    void Run();
+
+    /**
+     * @brief Releases the slots of completed reports.
+     */
+    void Release(std::size_t reports);
+
+private:
+    // Protects the queue and the slot count.
+    std::mutex mutex;
+    // Signals the background thread about new tasks or shutdown.
+    std::condition_variable cv;
+    // Tasks waiting to be started, with the number of reports each of them starts.
+    std::deque<std::pair<Task, std::size_t>> tasks;
+    // Reports queued or in flight.
+    std::size_t outstanding = 0;
+    // Indicates that the background thread should keep running.
+    bool running = false;
+    // Background thread starting the reports.
+    std::thread thread;
+    // Number of reports accepted.
+    std::atomic_uint64_t submitted{0};
+    // Number of reports dropped because the queue was full.
+    std::atomic_uint64_t dropped{0};
+    // Number of reports whose call failed.
+    std::atomic_uint64_t failed{0};
+    // Second in which a drop was last logged, to log at most once per second.
+    time_t last_drop_log = 0;
+};
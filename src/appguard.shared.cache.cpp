@@ -0,0 +1,261 @@
+#include "appguard.shared.cache.hpp"
+
+/**
+ * @brief Root of the cache, allocated at the start of the zone.
+ */
+struct AppGuardSharedCache::Shared
+{
+    ngx_rbtree_t rbtree;
+    ngx_rbtree_node_t sentinel;
+    // Entries, most recently used first.
+    ngx_queue_t queue;
+    // CRC32 of the firewall defaults the entries were stored under.
+    uint32_t defaults;
+    // Bumped when a verdict is replaced by a different one or the entries are cleared.
+    ngx_atomic_t generation;
+};
+
+namespace
+{
+    /**
+     * @brief A cached verdict; `node.key` is the CRC32 of the serialized cache key.
+     */
+    struct Entry
+    {
+        ngx_rbtree_node_t node;
+        ngx_queue_t queue;
+        ngx_uint_t policy;
+        size_t len;
+        u_char data[1];
+    };
+}
+
+static void InsertEntry(ngx_rbtree_node_t *temp, ngx_rbtree_node_t *node, ngx_rbtree_node_t *sentinel)
+{
+    ngx_rbtree_node_t **p;
+
+    for (;;)
+    {
+        if (node->key != temp->key)
+        {
+            p = (node->key < temp->key) ? &temp->left : &temp->right;
+        }
+        else
+        {
+            auto *entry = reinterpret_cast<Entry *>(node);
+            auto *other = reinterpret_cast<Entry *>(temp);
+
+            p = (ngx_memn2cmp(entry->data, other->data, entry->len, other->len) < 0) ? &temp->left : &temp->right;
+        }
+
+        if (*p == sentinel)
+            break;
+
+        temp = *p;
+    }
+
+    *p = node;
+    node->parent = temp;
+    node->left = sentinel;
+    node->right = sentinel;
+    ngx_rbt_red(node);
+}
+
+static Entry *FindEntry(ngx_rbtree_t *rbtree, std::string_view key, uint32_t hash)
+{
+    ngx_rbtree_node_t *node = rbtree->root;
+    ngx_rbtree_node_t *sentinel = rbtree->sentinel;
+
+    while (node != sentinel)
+    {
+        if (hash != node->key)
+        {
+            node = (hash < node->key) ? node->left : node->right;
+            continue;
+        }
+
+        auto *entry = reinterpret_cast<Entry *>(node);
+        ngx_int_t rc = ngx_memn2cmp(
+            reinterpret_cast<u_char *>(const_cast<char *>(key.data())),
+            entry->data,
+            key.size(),
+            entry->len);
+
+        if (rc == 0)
+            return entry;
+
+        node = (rc < 0) ? node->left : node->right;
+    }
+
+    return nullptr;
+}
+
+static void RemoveEntry(ngx_slab_pool_t *pool, ngx_rbtree_t *rbtree, Entry *entry)
+{
+    ngx_queue_remove(&entry->queue);
+    ngx_rbtree_delete(rbtree, &entry->node);
+    ngx_slab_free_locked(pool, entry);
+}
+
+ngx_shm_zone_t *AppGuardSharedCache::AddZone(ngx_conf_t *cf, ngx_str_t *name, size_t size, void *tag)
+{
+    ngx_shm_zone_t *zone = ngx_shared_memory_add(cf, name, size, tag);
+    if (zone == nullptr)
+        return nullptr;
+
+    if (zone->data)
+    {
+        ngx_conf_log_error(NGX_LOG_EMERG, cf, 0, "duplicate zone \"%V\"", name);
+        return nullptr;
+    }
+
+    zone->init = AppGuardSharedCache::InitZone;
+    zone->data = zone;
+
+    return zone;
+}
+
+ngx_int_t AppGuardSharedCache::InitZone(ngx_shm_zone_t *zone, void *data)
+{
+    // A zone kept across a reload already holds the cache.
+    if (data)
+    {
+        zone->data = data;
+        return NGX_OK;
+    }
+
+    auto *pool = reinterpret_cast<ngx_slab_pool_t *>(zone->shm.addr);
+
+    if (zone->shm.exists)
+    {
+        zone->data = pool->data;
+        return NGX_OK;
+    }
+
+    auto *shared = static_cast<Shared *>(ngx_slab_alloc(pool, sizeof(Shared)));
+    if (shared == nullptr)
+        return NGX_ERROR;
+
+    ngx_rbtree_init(&shared->rbtree, &shared->sentinel, InsertEntry);
+    ngx_queue_init(&shared->queue);
+    shared->defaults = 0;
+    shared->generation = 0;
+
+    pool->data = shared;
+    zone->data = shared;
+
+    static constexpr char log_ctx[] = " in AppGuard cache zone \"\"";
+
+    pool->log_ctx = static_cast<u_char *>(ngx_slab_alloc(pool, sizeof(log_ctx) + zone->shm.name.len));
+    if (pool->log_ctx == nullptr)
+        return NGX_ERROR;
+
+    ngx_sprintf(pool->log_ctx, " in AppGuard cache zone \"%V\"%Z", &zone->shm.name);
+
+    // Running out of memory is expected: the least recently used entries are evicted.
+    pool->log_nomem = 0;
+
+    return NGX_OK;
+}
+
+AppGuardSharedCache::AppGuardSharedCache(ngx_shm_zone_t *zone) noexcept
+    : pool(reinterpret_cast<ngx_slab_pool_t *>(zone->shm.addr)),
+      shared(static_cast<Shared *>(zone->data))
+{
+}
+
+std::optional<AppGuardSharedCache::value_type> AppGuardSharedCache::Get(std::string_view key) const
+{
+    uint32_t hash = ngx_crc32_long(reinterpret_cast<u_char *>(const_cast<char *>(key.data())), key.size());
+    std::optional<value_type> value;
+
+    ngx_shmtx_lock(&this->pool->mutex);
+
+    if (auto *entry = FindEntry(&this->shared->rbtree, key, hash); entry)
+    {
+        ngx_queue_remove(&entry->queue);
+        ngx_queue_insert_head(&this->shared->queue, &entry->queue);
+
+        value = static_cast<value_type>(entry->policy);
+    }
+
+    ngx_shmtx_unlock(&this->pool->mutex);
+
+    return value;
+}
+
+void AppGuardSharedCache::Put(std::string_view key, value_type value)
+{
+    uint32_t hash = ngx_crc32_long(reinterpret_cast<u_char *>(const_cast<char *>(key.data())), key.size());
+
+    ngx_shmtx_lock(&this->pool->mutex);
+
+    auto *entry = FindEntry(&this->shared->rbtree, key, hash);
+
+    if (entry)
+    {
+        ngx_queue_remove(&entry->queue);
+
+        // Workers may hold the previous verdict in their local caches.
+        if (entry->policy != static_cast<ngx_uint_t>(value))
+            this->shared->generation++;
+    }
+    else
+    {
+        size_t size = offsetof(Entry, data) + key.size();
+
+        entry = static_cast<Entry *>(ngx_slab_alloc_locked(this->pool, size));
+
+        // Evict the least recently used entries until the new one fits.
+        while (entry == nullptr && !ngx_queue_empty(&this->shared->queue))
+        {
+            auto *last = ngx_queue_data(ngx_queue_last(&this->shared->queue), Entry, queue);
+            RemoveEntry(this->pool, &this->shared->rbtree, last);
+
+            entry = static_cast<Entry *>(ngx_slab_alloc_locked(this->pool, size));
+        }
+
+        if (entry == nullptr)
+        {
+            ngx_shmtx_unlock(&this->pool->mutex);
+            return;
+        }
+
+        entry->node.key = hash;
+        entry->len = key.size();
+        ngx_memcpy(entry->data, key.data(), key.size());
+
+        ngx_rbtree_insert(&this->shared->rbtree, &entry->node);
+    }
+
+    entry->policy = static_cast<ngx_uint_t>(value);
+    ngx_queue_insert_head(&this->shared->queue, &entry->queue);
+
+    ngx_shmtx_unlock(&this->pool->mutex);
+}
+
+ngx_atomic_uint_t AppGuardSharedCache::Generation() const noexcept
+{
+    return this->shared->generation;
+}
+
+void AppGuardSharedCache::ApplyDefaults(std::string_view defaults)
+{
+    uint32_t hash = ngx_crc32_long(reinterpret_cast<u_char *>(const_cast<char *>(defaults.data())), defaults.size());
+
+    ngx_shmtx_lock(&this->pool->mutex);
+
+    if (this->shared->defaults != hash)
+    {
+        while (!ngx_queue_empty(&this->shared->queue))
+        {
+            auto *entry = ngx_queue_data(ngx_queue_head(&this->shared->queue), Entry, queue);
+            RemoveEntry(this->pool, &this->shared->rbtree, entry);
+        }
+
+        this->shared->defaults = hash;
+        this->shared->generation++;
+    }
+
+    ngx_shmtx_unlock(&this->pool->mutex);
+}
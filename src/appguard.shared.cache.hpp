@@ -0,0 +1,92 @@
+#pragma once
+
+extern "C"
+{
+#include <ngx_config.h>
+#include <ngx_core.h>
+}
+
+#include "generated/commands.pb.h"
+
+#include <optional>
+#include <string_view>
+
+/**
+ * @brief Verdict cache shared by all workers through an NGINX shared memory zone.
+ *
+ * The zone holds a red-black tree of verdicts keyed by the hash of the serialized cache key,
+ * allocated from the zone's slab pool. The least recently used verdicts are evicted when the
+ * zone is full. NGINX keeps zones across reloads, so the verdicts survive them as well.
+ *
+ * The zone's mutex serializes access from every worker and every thread, so it is safe to
+ * use from gRPC completion threads.
+ */
+class AppGuardSharedCache
+{
+public:
+    using value_type = appguard_commands::FirewallPolicy;
+
+    /**
+     * @brief Registers the shared memory zone of the cache (`appguard_cache_zone`).
+     *
+     * @param cf NGINX configuration context.
+     * @param name Name of the zone.
+     * @param size Size of the zone.
+     * @param tag Tag of the owning module; zones of other modules can't share the name.
+     * @return The zone, or nullptr on failure.
+     */
+    static ngx_shm_zone_t *AddZone(ngx_conf_t *cf, ngx_str_t *name, size_t size, void *tag);
+
+    /**
+     * @brief Opens the cache in an initialized zone.
+     *
+     * @param zone The zone returned by `AddZone`.
+     */
+    explicit AppGuardSharedCache(ngx_shm_zone_t *zone) noexcept;
+
+    /**
+     * @brief Looks a verdict up.
+     *
+     * @param key The serialized cache key.
+     * @return The verdict, or nothing if it isn't cached.
+     */
+    std::optional<value_type> Get(std::string_view key) const;
+
+    /**
+     * @brief Stores a verdict, replacing the previous one for the same key.
+     *
+     * @param key The serialized cache key.
+     * @param value The verdict.
+     */
+    void Put(std::string_view key, value_type value);
+
+    /**
+     * @brief Returns a number that changes whenever a cached verdict is changed or removed.
+     *
+     * Read without locking; copies of verdicts kept outside the zone are stale once it moves.
+     */
+    ngx_atomic_uint_t Generation() const noexcept;
+
+    /**
+     * @brief Removes every verdict if the firewall defaults changed since the last call.
+     *
+     * Workers receive the firewall defaults independently, including after a reload, so the
+     * zone is only emptied when the defaults actually differ from the ones it was filled under.
+     *
+     * @param defaults The serialized firewall defaults.
+     */
+    void ApplyDefaults(std::string_view defaults);
+
+private:
+    struct Shared;
+
+    /**
+     * @brief Initializes the zone, or takes over the zone of the previous cycle.
+     */
+    static ngx_int_t InitZone(ngx_shm_zone_t *zone, void *data);
+
+    // Slab pool of the zone.
+    ngx_slab_pool_t *pool;
+    // Tree and LRU queue at the start of the zone.
+    Shared *shared;
+};
@@ -4,6 +4,8 @@
 #include "appguard.uclient.exception.hpp"
 #include "appguard.http.ucache.hpp"
 
+#include <random>
+
 #define CLIENT_CATEGORY "AppGuard Client"
 #define CLIENT_TYPE "NGINX"
 #define MAKE_APP_ID_STORAGE_KEY(code) "app_id:" + code
@@ -14,7 +16,16 @@ namespace internal
     using CM = appguard_commands::ClientMessage;
     using SM = appguard_commands::ServerMessage;
 
-    static bool PerformAuthorization(
+    enum AuthorizationResult
+    {
+        AUTHORIZED,
+        // The server explicitly rejected the installation code.
+        REJECTED,
+        // The stream broke before a verdict; worth retrying.
+        UNANSWERED,
+    };
+
+    static AuthorizationResult PerformAuthorization(
         const AppGuardStream *stream,
         grpc::ClientReaderWriter<CM, SM> *rw_stream,
         const std::string &installation_code,
@@ -36,7 +47,7 @@ namespace internal
                 ngx_cycle->log,
                 0,
                 "AppGuard: Failed to send authorization request");
-            return false;
+            return UNANSWERED;
         }
 
         SM response;
@@ -58,7 +69,7 @@ namespace internal
                     Storage::GetInstance().Set(key, data.app_secret());
                 }
 
-                return true;
+                return AUTHORIZED;
             }
 
             if (response.has_authorization_rejected())
@@ -68,7 +79,7 @@ namespace internal
                     ngx_cycle->log,
                     0,
                     "AppGuard Server Rejected Authorization");
-                return false;
+                return REJECTED;
             }
         }
 
@@ -78,7 +89,7 @@ namespace internal
             0,
             "AppGuard Server Authorization failed");
 
-        return false;
+        return UNANSWERED;
     }
 
     static bool PerformAuthentication(
@@ -122,12 +133,15 @@ namespace internal
 }
 
 AppGuardStream::AppGuardStream(
-    std::shared_ptr<grpc::Channel> channel,
-    const std::string &installation_code)
+    std::shared_ptr<AppGuardChannelPool> channels,
+    const std::string &installation_code,
+    AppGuardAgent::Slot *slot)
     : installation_code(installation_code),
-      token({}),
       running(false),
-      channel(channel)
+      last_heard(0),
+      default_timeout(0),
+      channels(channels),
+      slot(slot)
 {
     this->Start();
 }
@@ -135,6 +149,7 @@ AppGuardStream::AppGuardStream(
 AppGuardStream::~AppGuardStream()
 {
     this->Stop();
+    this->StopWaiters();
 }
 
 void AppGuardStream::Start()
@@ -149,37 +164,91 @@ void AppGuardStream::Start()
          uuid = std::move(device_uuid),
          os = std::move(target_os)]()
         {
+        std::minstd_rand random(std::random_device{}());
+        std::uint32_t attempt = 0;
+
         while (this->running) {
-            { 
+            // Only the leader of the agent slot talks to the server.
+            if (this->slot && !AppGuardAgent::Instance().TryLead(this->slot)) {
+                this->Follow();
+                continue;
+            }
+
+            {
                 std::lock_guard lock(this->context_mutex);
                 this->context = std::make_unique<grpc::ClientContext>();
             }
 
-            auto stub = appguard::AppGuard::NewStub(this->channel);
+            // Indicates that this stream has heard from the server.
+            bool heard = false;
+
+            // The watchdog measures the silence from the start of each stream.
+            this->last_heard = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                   std::chrono::steady_clock::now().time_since_epoch())
+                                   .count();
+
+            auto channel = this->channels->StreamChannel();
+            auto stub = appguard::AppGuard::NewStub(channel);
             auto rw_stream = stub->ControlChannel(this->context.get());
 
-            // Step 1: Send Authorization request and await for the verdict
-            if (!internal::PerformAuthorization(this, rw_stream.get(), installation_code, os, uuid)) {
+            // Only an explicit verdict of the server stops the client; every other failure
+            // goes through the reconnect below and keeps the token meanwhile.
+            auto stop = [this, &rw_stream]()
+            {
+                this->SetToken("");
+
+                if (this->slot)
+                    AppGuardAgent::Instance().PublishStopped(this->slot);
+
                 this->running = false;
+                this->context->TryCancel();
+                rw_stream->Finish();
+
                 std::lock_guard lock(this->context_mutex);
                 this->context.reset();
+            };
+
+            // Step 1: Send Authorization request and await for the verdict
+            auto authorization = internal::PerformAuthorization(this, rw_stream.get(), installation_code, os, uuid);
+
+            if (authorization == internal::REJECTED) {
+                stop();
                 return;
             }
 
             // Step 2: Collect credentials and send authentication
-            if (!internal::PerformAuthentication(this, rw_stream.get(), installation_code)) {
-                this->running = false;
-                std::lock_guard lock(this->context_mutex);
-                this->context.reset();
-                return;
-            }
+            bool authenticated = authorization == internal::AUTHORIZED &&
+                                 internal::PerformAuthentication(this, rw_stream.get(), installation_code);
+
+            // The server may still be waiting on this side; cancel so that `Finish` returns.
+            if (!authenticated)
+                this->context->TryCancel();
 
             // Step 3: Accept messages from the server
             internal::SM message;
-            while (this->Running() && rw_stream->Read(&message)) {
+            while (authenticated && this->Running() && rw_stream->Read(&message)) {
+                this->Heard();
+
+                if (!heard) {
+                    heard = true;
+
+                    ngx_log_error(
+                        NGX_LOG_NOTICE,
+                        ngx_cycle->log,
+                        0,
+                        "AppGuard: Control stream is up");
+                }
+
+                if (message.has_heartbeat())
+                    continue;
+
                 if (const auto& token = message.update_token_command(); !token.empty())
                 {
                     this->SetToken(token);
+
+                    if (this->slot)
+                        AppGuardAgent::Instance().PublishToken(this->slot, token);
+
                     continue;
                 }
 
@@ -194,43 +263,82 @@ void AppGuardStream::Start()
                         0,
                         "AppGuard: Server sent de-authorization");
 
-                    this->running = false;
-                    std::lock_guard lock(this->context_mutex);
-                    this->context.reset();
+                    stop();
                     return;
                 }
 
                 if (message.has_set_firewall_defaults())
                 {
                     const auto command = message.set_firewall_defaults();
-                    auto& instance = AppguardHttpCache<HttpRequestCacheKey>::GetInstance();
-                    
-                    instance.Clear();
-                    instance.Enable(command.cache());
+                    this->ApplyFirewallDefaults(command);
+
+                    if (this->slot)
+                        AppGuardAgent::Instance().PublishDefaults(this->slot, command.SerializeAsString());
+
                     continue;
                 }
             }
 
             auto status = rw_stream->Finish();
-            if (!status.ok() && this->running) {
-                this->SetToken("");
-                this->running = false;
-                std::chrono::seconds timeout(5);
-                std::this_thread::sleep_for(timeout);
-                this->running = true;
+
+            // A stream that got as far as hearing from the server starts the backoff over.
+            if (heard)
+                attempt = 0;
+
+            {
+                std::lock_guard lock(this->context_mutex);
+                this->context.reset();
             }
 
-            this->context.reset();
+            if (!this->running)
+                break;
+
+            // Another process took the slot over while this one was stalled; follow it.
+            if (this->slot && !AppGuardAgent::Instance().TryLead(this->slot))
+                continue;
+
+            // The token is kept until the server replaces or revokes it, so calls carry on
+            // with it while the stream reconnects instead of waiting for a new one.
+            if (!status.ok() && this->channels->StreamFailed(channel)) {
+                ngx_log_error(
+                    NGX_LOG_WARN,
+                    ngx_cycle->log,
+                    0,
+                    "AppGuard: Control stream failed (%d: %s); moving to another backend",
+                    static_cast<int>(status.error_code()),
+                    status.error_message().c_str());
+                continue;
+            }
+
+            auto delay = Backoff(attempt++, random);
+
+            ngx_log_error(
+                NGX_LOG_WARN,
+                ngx_cycle->log,
+                0,
+                "AppGuard: Control stream ended (%d: %s); reconnecting in %d ms",
+                static_cast<int>(status.error_code()),
+                status.error_message().c_str(),
+                static_cast<int>(delay.count()));
+
+            std::unique_lock lock(this->stop_mutex);
+            this->stop_cv.wait_for(lock, delay, [this]
+                                   { return !this->running; });
         } 
         this->running = false; });
+
+    this->watcher = std::thread([this]()
+                                { this->Watch(); });
 }
 
 void AppGuardStream::Stop()
 {
-    if (!this->running)
-        return;
+    {
+        std::lock_guard lock(this->stop_mutex);
+        this->running = false;
+    }
 
-    this->running = false;
+    this->stop_cv.notify_all();
 
     {
         std::lock_guard lock(this->context_mutex);
@@ -240,29 +348,249 @@ void AppGuardStream::Stop()
         }
     }
 
+    // The control thread may have stopped on its own after a rejection; it is still joined.
     if (this->thread.joinable())
         this->thread.join();
+
+    if (this->watcher.joinable())
+        this->watcher.join();
+
+    if (this->slot)
+        AppGuardAgent::Instance().Resign(this->slot);
+}
+
+void AppGuardStream::Follow()
+{
+    auto &agent = AppGuardAgent::Instance();
+    AppGuardAgent::State state;
+    ngx_uint_t applied = 0;
+    std::string token;
+
+    while (this->running)
+    {
+        agent.Read(this->slot, state);
+
+        if (state.stopped)
+        {
+            this->SetToken("");
+            this->running = false;
+            return;
+        }
+
+        // The leader keeps its token while it reconnects; an empty slot only means that a
+        // new leader hasn't authenticated yet, so the last token stays in use meanwhile.
+        if (!state.token.empty() && state.token != token)
+        {
+            token = state.token;
+            this->SetToken(token);
+        }
+
+        if (state.defaults_version != applied)
+        {
+            applied = state.defaults_version;
+
+            appguard_commands::FirewallDefaults defaults;
+            if (defaults.ParseFromString(state.defaults))
+                this->ApplyFirewallDefaults(defaults);
+        }
+
+        // The previous leader exited; this process runs the control stream from now on.
+        if (agent.TryLead(this->slot))
+            return;
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+}
+
+void AppGuardStream::Watch()
+{
+    auto &agent = AppGuardAgent::Instance();
+    std::unique_lock lock(this->stop_mutex);
+
+    while (!this->stop_cv.wait_for(lock, WatchInterval, [this]
+                                   { return !this->running; }))
+    {
+        std::lock_guard context_lock(this->context_mutex);
+
+        // Followers have no stream to watch.
+        if (!this->context)
+            continue;
+
+        // A server that went silent, or a connection that died without the transport
+        // noticing, would block the control thread in `Read` indefinitely; cancelling
+        // makes it reconnect. A server in good health sends heartbeats well within the timeout.
+        if (this->Silence() >= HeartbeatTimeout)
+        {
+            ngx_log_error(
+                NGX_LOG_WARN,
+                ngx_cycle->log,
+                0,
+                "AppGuard: No message from the server in %d s; reconnecting the control stream",
+                static_cast<int>(HeartbeatTimeout.count()));
+
+            this->context->TryCancel();
+            continue;
+        }
+
+        // Only a leader has a lease to keep. If it was lost, another process leads the
+        // slot by now; dropping the stream makes this one follow it.
+        if (this->slot && !agent.Renew(this->slot))
+            this->context->TryCancel();
+    }
+}
+
+std::chrono::steady_clock::duration AppGuardStream::Silence() const noexcept
+{
+    return std::chrono::steady_clock::now().time_since_epoch() - std::chrono::nanoseconds(this->last_heard.load());
+}
+
+void AppGuardStream::Heard() noexcept
+{
+    this->last_heard = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           std::chrono::steady_clock::now().time_since_epoch())
+                           .count();
+}
+
+std::chrono::milliseconds AppGuardStream::Backoff(std::uint32_t attempt, std::minstd_rand &random)
+{
+    // Full jitter: a uniform delay up to the exponential bound, so that the workers of a
+    // fleet that lost the same server spread their reconnects instead of retrying in step.
+    auto bound = ReconnectCap.count();
+
+    if (attempt < 16)
+        bound = std::min<std::int64_t>(bound, ReconnectBase.count() << attempt);
+
+    std::uniform_int_distribution<std::int64_t> delay(ReconnectBase.count(), std::max<std::int64_t>(bound, ReconnectBase.count()));
+    return std::chrono::milliseconds(delay(random));
+}
+
+void AppGuardStream::ApplyFirewallDefaults(const appguard_commands::FirewallDefaults &defaults)
+{
+    auto &instance = AppguardHttpCache<HttpRequestCacheKey>::GetInstance();
+
+    instance.ApplyDefaults(defaults.cache(), defaults.SerializeAsString());
+
+    this->default_timeout = defaults.timeout();
 }
 
 void AppGuardStream::SetToken(const std::string &token)
 {
+    if (token.empty())
+    {
+        std::atomic_store_explicit(&this->token, Token(), std::memory_order_release);
+        return;
+    }
+
+    // Readers holding the previous token keep it alive; the last of them frees it. The
+    // mutex only orders the publication with waiters in `WaitForToken`.
+    auto published = std::make_shared<const std::string>(token);
+
     {
         std::lock_guard lock(this->token_mutex);
-        this->token = token;
+        std::atomic_store_explicit(&this->token, std::move(published), std::memory_order_release);
     }
 
     this->token_cv.notify_all();
 }
 
-std::string AppGuardStream::WaitForToken(std::chrono::milliseconds timeout)
+void AppGuardStream::WhenToken(std::chrono::system_clock::time_point deadline, TokenCallback callback)
 {
-    std::unique_lock<std::mutex> lock(this->token_mutex);
+    if (auto token = this->PeekToken(); token)
+    {
+        callback(token.get());
+        return;
+    }
+
+    bool queued = false;
+
+    {
+        std::lock_guard lock(this->token_mutex);
+
+        if (!this->waiters_stopped)
+        {
+            this->waiters.emplace(deadline, std::move(callback));
+            queued = true;
 
-    if (!this->token.empty())
-        return this->token;
+            if (!this->waiter_thread.joinable())
+                this->waiter_thread = std::thread([this]()
+                                                  { this->RunWaiters(); });
+        }
+    }
+
+    if (!queued)
+    {
+        callback(nullptr);
+        return;
+    }
+
+    this->token_cv.notify_all();
+}
+
+void AppGuardStream::RunWaiters()
+{
+    std::unique_lock lock(this->token_mutex);
+
+    for (;;)
+    {
+        if (this->waiters.empty())
+        {
+            if (this->waiters_stopped)
+                return;
+
+            this->token_cv.wait(lock);
+        }
+        else if (!this->PeekToken() && !this->waiters_stopped)
+        {
+            this->token_cv.wait_until(lock, this->waiters.begin()->first);
+        }
+
+        auto token = this->waiters_stopped ? nullptr : this->PeekToken();
+        auto now = std::chrono::system_clock::now();
+        std::vector<TokenCallback> ready;
+
+        for (auto it = this->waiters.begin(); it != this->waiters.end();)
+        {
+            if (!token && !this->waiters_stopped && it->first > now)
+                break;
+
+            ready.push_back(std::move(it->second));
+            it = this->waiters.erase(it);
+        }
+
+        if (ready.empty())
+            continue;
+
+        lock.unlock();
+
+        for (auto &callback : ready)
+            callback(token.get());
+
+        lock.lock();
+    }
+}
+
+void AppGuardStream::StopWaiters()
+{
+    {
+        std::lock_guard lock(this->token_mutex);
+        this->waiters_stopped = true;
+    }
+
+    this->token_cv.notify_all();
+
+    if (this->waiter_thread.joinable())
+        this->waiter_thread.join();
+}
+
+AppGuardStream::Token AppGuardStream::WaitForToken(std::chrono::milliseconds timeout)
+{
+    if (auto token = this->PeekToken(); token)
+        return token;
+
+    std::unique_lock<std::mutex> lock(this->token_mutex);
 
     token_cv.wait_for(lock, timeout, [this]
-                      { return !this->token.empty(); });
+                      { return this->PeekToken() != nullptr; });
 
-    return this->token;
-}
\ No newline at end of file
+    return this->PeekToken();
+}
@@ -4,9 +4,16 @@
 #include "generated/appguard.grpc.pb.h"
 #include "generated/commands.pb.h"
 #include "generated/commands.grpc.pb.h"
+#include "appguard.agent.hpp"
+#include "appguard.channel.pool.hpp"
 
 #include <thread>
+#include <array>
 #include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <random>
 #include <condition_variable>
 #include <grpcpp/grpcpp.h>
 
@@ -17,18 +24,31 @@
  * This class establishes and maintains a heartbeat stream with the AppGuard server,
  * handling token updates and device status changes. It supports automatic reconnection
  * and thread-safe access to shared resources.
+ *
+ * The token is kept while the stream reconnects, until the server replaces or revokes it,
+ * so calls never wait on a reconnect. Reconnects back off exponentially with jitter.
+ *
+ * With an agent slot, only the worker leading the slot runs the control stream; the
+ * other workers follow the token and firewall defaults it publishes.
  */
 class AppGuardStream
 {
 public:
+    /// A published token; replaced tokens stay alive for as long as a reader holds them.
+    using Token = std::shared_ptr<const std::string>;
+    /// Receives the token, or nullptr if none arrived in time; it is valid during the call.
+    using TokenCallback = std::function<void(const std::string *)>;
+
     /**
      * @brief Constructs an AppGuardStream and starts the heartbeat stream.
-     * @param channel Shared pointer to the gRPC channel.
+     * @param channels The channels to the AppGuard backends; the stream moves to a healthy backend when its own fails.
      * @param installation_code NullNet installation code.
+     * @param slot Agent slot shared with the other workers, or nullptr to run a control stream of its own.
      */
     AppGuardStream(
-        std::shared_ptr<grpc::Channel> channel,
-        const std::string &installation_code);
+        std::shared_ptr<AppGuardChannelPool> channels,
+        const std::string &installation_code,
+        AppGuardAgent::Slot *slot = nullptr);
 
     /**
      * @brief Destructor that stops the heartbeat stream.
@@ -36,17 +56,47 @@ public:
     ~AppGuardStream();
 
     /**
-     * @brief Checks if the heartbeat stream is currently running.
+     * @brief Checks if the heartbeat stream is running; it stays running while it reconnects.
      * @return True if running; otherwise, false.
      */
     inline auto Running() const noexcept { return this->running.load(); }
 
+    /**
+     * @brief Returns the current token without waiting.
+     *
+     * The token is swapped atomically when the server replaces it, and stays valid for as
+     * long as the caller holds on to it.
+     *
+     * @return The token, or nullptr if there is none.
+     */
+    inline Token PeekToken() const noexcept { return std::atomic_load_explicit(&this->token, std::memory_order_acquire); }
+
     /**
      * @brief Waits for the token to become available until the specified timeout duration.
+     *
+     * Only blocks while there is no token.
+     *
      * @param timeout The maximum duration to wait for the token.
-     * @return The token string if available before the timeout; empty string otherwise.
+     * @return The token if available before the timeout; nullptr otherwise.
      */
-    std::string WaitForToken(std::chrono::milliseconds timeout = std::chrono::milliseconds(5'000));
+    Token WaitForToken(std::chrono::milliseconds timeout = std::chrono::milliseconds(5'000));
+
+    /**
+     * @brief Invokes a callback with the token once it is available, without blocking.
+     *
+     * The callback runs inline if there is a token. Otherwise it runs on an internal thread
+     * once the token arrives, or with nullptr once the deadline passes or the stream is destroyed.
+     *
+     * @param deadline Gives up waiting for the token past this point.
+     * @param callback Receives the token.
+     */
+    void WhenToken(std::chrono::system_clock::time_point deadline, TokenCallback callback);
+
+    /**
+     * @brief Returns the call timeout pushed by the server in `FirewallDefaults`.
+     * @return The timeout, or zero if the server hasn't sent one.
+     */
+    inline auto DefaultTimeout() const noexcept { return std::chrono::milliseconds(this->default_timeout.load()); }
 
 private:
     /**
@@ -59,6 +109,54 @@ private:
      */
     void Stop();
 
+    /**
+     * @brief Body of the thread handing the token to the callbacks of `WhenToken`.
+     */
+    void RunWaiters();
+
+    /**
+     * @brief Fails the callbacks still waiting for the token and joins their thread.
+     */
+    void StopWaiters();
+
+    /**
+     * @brief Mirrors the token and firewall defaults published by the slot's leader.
+     *
+     * Returns once this process takes the lead or the stream stops.
+     */
+    void Follow();
+
+    /**
+     * @brief Body of the watchdog thread.
+     *
+     * Cancels the stream once the server has been silent for `HeartbeatTimeout`, and
+     * renews the lease on the agent slot while leading it.
+     */
+    void Watch();
+
+    /**
+     * @brief Returns how long ago the server was last heard from, or the current stream started.
+     */
+    std::chrono::steady_clock::duration Silence() const noexcept;
+
+    /**
+     * @brief Records that a message arrived from the server.
+     */
+    void Heard() noexcept;
+
+    /**
+     * @brief Returns how long to wait before the given reconnect attempt.
+     * @param attempt Number of reconnects since the server was last heard from.
+     * @param random Source of the jitter.
+     */
+    static std::chrono::milliseconds Backoff(std::uint32_t attempt, std::minstd_rand &random);
+
+    /**
+     * @brief Applies firewall defaults sent by the server.
+     * @param defaults The firewall defaults.
+     */
+    void ApplyFirewallDefaults(const appguard_commands::FirewallDefaults &defaults);
+
     /**
      * @brief Sets the authentication token in a thread-safe manner.
      * @param token The new token string to set.
@@ -66,22 +164,49 @@ private:
     void SetToken(const std::string &token);
 
 private:
+    // Delay before the first reconnect.
+    static constexpr std::chrono::milliseconds ReconnectBase{250};
+    // Longest delay between reconnects.
+    static constexpr std::chrono::milliseconds ReconnectCap{30'000};
+    // Interval between checks of the watchdog; also renews the lease on the agent slot.
+    static constexpr std::chrono::seconds WatchInterval{AppGuardAgent::LeaseDuration / 3};
+    // Silence after which the watchdog reconnects the control stream.
+    static constexpr std::chrono::seconds HeartbeatTimeout{30};
+
     // Installation code.
     std::string installation_code;
-    // Authentication token received from the server.
-    std::string token;
-    // Mutex to protect access to the token.
+    // Authentication token received from the server, or nullptr if there is none; only
+    // accessed through the atomic shared_ptr functions.
+    Token token;
+    // Mutex for waiting on the token; readers of a published token never take it.
     mutable std::mutex token_mutex;
     // Condition variable to wait for token availability.
     std::condition_variable token_cv;
+    // Callbacks waiting for the token, by deadline; protected by `token_mutex`.
+    std::multimap<std::chrono::system_clock::time_point, TokenCallback> waiters;
+    // Indicates that the callbacks waiting for the token should be failed; protected by `token_mutex`.
+    bool waiters_stopped = false;
+    // Thread handing the token to the waiting callbacks, started by the first of them.
+    std::thread waiter_thread;
     // Thread handling the control channel.
     std::thread thread;
+    // Watchdog thread of the control stream.
+    std::thread watcher;
     // Flag indicating if the control channel is running.
     std::atomic_bool running;
-    // gRPC channel to the server.
-    std::shared_ptr<grpc::Channel> channel;
+    // Mutex and condition variable to wake the control thread from its backoff on stop.
+    std::mutex stop_mutex;
+    std::condition_variable stop_cv;
+    // Time of the last server message or of the start of the stream, in nanoseconds of the steady clock.
+    std::atomic<std::int64_t> last_heard;
+    // Call timeout in milliseconds from the latest `FirewallDefaults`.
+    std::atomic_uint32_t default_timeout;
+    // gRPC channels to the backends.
+    std::shared_ptr<AppGuardChannelPool> channels;
     // Mutex to protect access to the gRPC context.
     std::mutex context_mutex;
     // gRPC client context for the control channel.
     std::unique_ptr<grpc::ClientContext> context;
+    // Agent slot shared with the other workers, or nullptr.
+    AppGuardAgent::Slot *slot;
 };
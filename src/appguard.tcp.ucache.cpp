@@ -1,76 +1,59 @@
 #include "appguard.tcp.ucache.hpp"
-#include <sstream>
 
-static size_t CACHE_MAX_SIZE = 1024;
-
-static AppguardTcpInfoCache::Key MakeKey(ngx_connection_t *conn)
+static void CleanupTcpInfo(void *data)
 {
-    std::stringstream ss;
-
-    sockaddr_in *src = reinterpret_cast<sockaddr_in *>(conn->sockaddr);
-    sockaddr_in *dst = reinterpret_cast<sockaddr_in *>(conn->local_sockaddr);
-
-    char src_ip[INET_ADDRSTRLEN] = {0};
-    char dst_ip[INET_ADDRSTRLEN] = {0};
-
-    inet_ntop(AF_INET, &(src->sin_addr), src_ip, INET_ADDRSTRLEN);
-    inet_ntop(AF_INET, &(dst->sin_addr), dst_ip, INET_ADDRSTRLEN);
+    delete static_cast<AppguardTcpInfoCache::Value *>(data);
+}
 
-    ss << src_ip << ":" << ntohs(src->sin_port)
-       << "->" << dst_ip << ":" << ntohs(dst->sin_port);
+static ngx_pool_cleanup_t *FindTcpInfo(ngx_connection_t *connection)
+{
+    for (ngx_pool_cleanup_t *cln = connection->pool->cleanup; cln; cln = cln->next)
+    {
+        if (cln->handler == CleanupTcpInfo)
+            return cln;
+    }
 
-    return ss.str();
+    return nullptr;
 }
 
-AppguardTcpInfoCache &AppguardTcpInfoCache::Instance()
+const AppguardTcpInfoCache::Value *AppguardTcpInfoCache::Put(ngx_http_request_t *request, const AppguardTcpInfoCache::Value &value)
 {
-    static AppguardTcpInfoCache instance;
-    return instance;
+    return Put(ClientConnection(request), value);
 }
 
-void AppguardTcpInfoCache::Put(ngx_connection_t *connection, const AppguardTcpInfoCache::Value &value)
+const AppguardTcpInfoCache::Value *AppguardTcpInfoCache::Put(ngx_connection_t *connection, const AppguardTcpInfoCache::Value &value)
 {
-    std::lock_guard<std::mutex> lock(this->mutex);
-
-    AppguardTcpInfoCache::Key key = MakeKey(connection);
-
-    auto iterator = this->map.find(key);
-    if (iterator != this->map.end())
+    if (ngx_pool_cleanup_t *cln = FindTcpInfo(connection); cln)
     {
-        iterator->second->second = value;
-        this->usage.splice(
-            this->usage.begin(),
-            this->usage,
-            iterator->second);
+        auto *stored = static_cast<Value *>(cln->data);
+        *stored = value;
+        return stored;
     }
 
-    this->usage.emplace_front(key, value);
-    this->map[key] = this->usage.begin();
+    ngx_pool_cleanup_t *cln = ngx_pool_cleanup_add(connection->pool, 0);
+    if (cln == nullptr)
+        return nullptr;
 
-    if (this->map.size() > CACHE_MAX_SIZE)
-    {
-        auto last = this->usage.end();
-        --last;
+    auto *stored = new Value(value);
 
-        this->map.erase(last->first);
-        this->usage.pop_back();
-    }
+    cln->data = stored;
+    cln->handler = CleanupTcpInfo;
+
+    return stored;
 }
 
-std::optional<AppguardTcpInfoCache::Value> AppguardTcpInfoCache::Get(ngx_connection_t *connection)
+const AppguardTcpInfoCache::Value *AppguardTcpInfoCache::Get(ngx_http_request_t *request)
 {
-    std::lock_guard<std::mutex> lock(this->mutex);
-
-    AppguardTcpInfoCache::Key key = MakeKey(connection);
-
-    auto iterator = this->map.find(key);
-    if (iterator == this->map.end())
-        return std::nullopt;
+    ngx_pool_cleanup_t *cln = FindTcpInfo(ClientConnection(request));
+    return cln ? static_cast<const Value *>(cln->data) : nullptr;
+}
 
-    this->usage.splice(
-        this->usage.begin(),
-        this->usage,
-        iterator->second);
+ngx_connection_t *AppguardTcpInfoCache::ClientConnection(ngx_http_request_t *request)
+{
+#if (NGX_HTTP_V2)
+    if (request->stream)
+        return request->stream->connection->connection;
+#endif
 
-    return iterator->second->second;
-}
\ No newline at end of file
+    return request->connection;
+}
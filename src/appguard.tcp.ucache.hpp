@@ -7,63 +7,60 @@ extern "C"
 #include <ngx_http.h>
 }
 
-#include <list>
-#include <unordered_map>
-#include <optional>
-
 #include "generated/appguard.pb.h"
 
 /**
- * @brief A fixed-size LRU (Least Recently Used) cache for storing AppGuard IP info.
+ * @brief Per-connection storage for AppGuard TCP info.
  *
- * This cache uses connection-level data from ngx_connection_t (source/destination IP and port)
- * to store and retrieve information about IP addresses in association with AppGuard metadata.
+ * The `AppGuardTcpInfo` returned by `HandleTcpConnection` is attached to the client
+ * connection through a pool cleanup, so it is fetched once per TCP connection and shared
+ * by every request and response on it (keepalive requests, HTTP/2 streams). The value is
+ * released together with the connection.
  */
 class AppguardTcpInfoCache
 {
 public:
-    /// The value stored in the cache — IP metadata from AppGuard.
+    /// The value stored per connection — TCP and IP metadata from AppGuard.
     using Value = appguard::AppGuardTcpInfo;
-    /// The key type — a stringified connection descriptor (e.g., "1.2.3.4:1234->5.6.7.8:80").
-    using Key = std::string;
 
     /**
-     * @brief Returns the singleton instance of the cache.
+     * @brief Stores the TCP info for the connection of the given request.
+     *
+     * Replaces the previously stored value if there is one.
      *
-     * @return Reference to the singleton AppguardTcpInfoCache.
+     * @param request The NGINX request whose client connection the value belongs to.
+     * @param value The AppGuardTcpInfo value to store.
+     * @return A pointer to the stored value, or nullptr if it could not be stored.
      */
-    static AppguardTcpInfoCache &Instance();
+    static const Value *Put(ngx_http_request_t *request, const Value &value);
 
     /**
-     * @brief Inserts or updates an entry in the cache.
+     * @brief Stores the TCP info for the given client connection.
      *
-     * If the entry already exists, it is updated and moved to the front of the usage list.
-     * If the cache exceeds its maximum size, the least recently used entry is evicted.
+     * @param connection The client connection the value belongs to.
+     * @param value The AppGuardTcpInfo value to store.
+     * @return A pointer to the stored value, or nullptr if it could not be stored.
+     */
+    static const Value *Put(ngx_connection_t *connection, const Value &value);
+
+    /**
+     * @brief Retrieves the TCP info stored for the connection of the given request.
      *
-     * @param conn The NGINX connection object used to generate the key.
-     * @param value The AppGuardIpInfo value to store.
+     * @param request The NGINX request whose client connection is looked up.
+     * @return A pointer to the stored value (valid for the connection lifetime), or nullptr.
      */
-    void Put(ngx_connection_t *conn, const Value &value);
+    static const Value *Get(ngx_http_request_t *request);
 
     /**
-     * @brief Retrieves an entry from the cache if it exists.
+     * @brief Returns the client connection of a request, i.e. the one the value is attached to.
      *
-     * Accessing an entry moves it to the front of the usage list.
+     * For HTTP/2 streams this is the connection carrying the stream.
      *
-     * @param conn The NGINX connection object used to generate the key.
-     * @return An optional containing the value if present, or std::nullopt.
+     * @param request The NGINX request.
+     * @return The client connection.
      */
-    std::optional<Value> Get(ngx_connection_t *conn);
-
-private:
-    /// Private constructor to enforce singleton pattern.
-    AppguardTcpInfoCache() = default;
+    static ngx_connection_t *ClientConnection(ngx_http_request_t *request);
 
 private:
-    /// Mutex to protect access to the cache in multithreaded environments.
-    std::mutex mutex;
-    /// List of key-value pairs ordered by usage (front = most recently used).
-    std::list<std::pair<Key, Value>> usage;
-    /// Hash map to quickly access list nodes by key.
-    std::unordered_map<Key, decltype(usage.begin())> map;
+    AppguardTcpInfoCache() = delete;
 };
@@ -1,64 +1,54 @@
 #include "appguard.uclient.exception.hpp"
-#include <sstream>
 
-static inline std::string GrpcStatusCodeToStr(grpc::StatusCode code)
+#include <iterator>
+
+// Descriptors of the gRPC status codes, indexed by code.
+static const AppGuardError GrpcErrors[] = {
+    {"gRPC error code OK"},
+    {"gRPC error code CANCELLED"},
+    {"gRPC error code UNKNOWN"},
+    {"gRPC error code INVALID_ARGUMENT"},
+    {"gRPC error code DEADLINE_EXCEEDED"},
+    {"gRPC error code NOT_FOUND"},
+    {"gRPC error code ALREADY_EXISTS"},
+    {"gRPC error code PERMISSION_DENIED"},
+    {"gRPC error code RESOURCE_EXHAUSTED"},
+    {"gRPC error code FAILED_PRECONDITION"},
+    {"gRPC error code ABORTED"},
+    {"gRPC error code OUT_OF_RANGE"},
+    {"gRPC error code UNIMPLEMENTED"},
+    {"gRPC error code INTERNAL"},
+    {"gRPC error code UNAVAILABLE"},
+    {"gRPC error code DATA_LOSS"},
+    {"gRPC error code UNAUTHENTICATED"},
+};
+
+// Descriptors of the AppGuard status codes, in the order of `AppGuardStatusCode`.
+static const AppGuardError CustomErrors[] = {
+    {"AppGuardStatusCode status code APPGUARD_AUTH_STREAM_NOT_RUNNING"},
+    {"AppGuardStatusCode status code APPGUARD_FAILED_TO_ACQUIRE_TOKEN"},
+    {"AppGuardStatusCode status code APPGUARD_FAILED_TO_SAVE_CLIENT"},
+    {"AppGuardStatusCode status code APPGUARD_CONNECTION_TIMEOUT"},
+    {"AppGuardStatusCode status code APPGUARD_CERTIFICATE_NOT_FOUND"},
+    {"AppGuardStatusCode status code APPGUARD_FAILED_TO_OBTAIN_UUID"},
+    {"AppGuardStatusCode status code APPGUARD_STORAGE_OPERATION_FAILURE"},
+    {"AppGuardStatusCode status code APPGUARD_CIRCUIT_OPEN"},
+};
+
+static const AppGuardError UnknownError{"AppGuardStatusCode status code UNKNOWN"};
+
+const AppGuardError &AppGuardError::FromGrpcStatus(const grpc::Status &status) noexcept
 {
-    switch (code)
-    {
-    case grpc::StatusCode::CANCELLED:
-        return "CANCELLED";
-    case grpc::StatusCode::INVALID_ARGUMENT:
-        return "INVALID_ARGUMENT";
-    case grpc::StatusCode::DEADLINE_EXCEEDED:
-        return "DEADLINE_EXCEEDED";
-    case grpc::StatusCode::NOT_FOUND:
-        return "NOT_FOUND";
-    case grpc::StatusCode::ALREADY_EXISTS:
-        return "ALREADY_EXISTS";
-    case grpc::StatusCode::PERMISSION_DENIED:
-        return "PERMISSION_DENIED";
-    case grpc::StatusCode::UNAUTHENTICATED:
-        return "UNAUTHENTICATED";
-    case grpc::StatusCode::RESOURCE_EXHAUSTED:
-        return "RESOURCE_EXHAUSTED";
-    case grpc::StatusCode::FAILED_PRECONDITION:
-        return "FAILED_PRECONDITION";
-    case grpc::StatusCode::OUT_OF_RANGE:
-        return "OUT_OF_RANGE";
-    case grpc::StatusCode::UNIMPLEMENTED:
-        return "UNIMPLEMENTED";
-    case grpc::StatusCode::INTERNAL:
-        return "INTERNAL";
-    case grpc::StatusCode::UNAVAILABLE:
-        return "UNAVAILABLE";
-    case grpc::StatusCode::DATA_LOSS:
-        return "DATA_LOSS";
-    default:
-        return "UNKNOWN";
-    }
+    auto code = static_cast<std::size_t>(status.error_code());
+
+    return code < std::size(GrpcErrors) ? GrpcErrors[code] : GrpcErrors[grpc::StatusCode::UNKNOWN];
 }
 
-static inline std::string AppGuardStatusCodeToStr(AppGuardStatusCode code)
+const AppGuardError &AppGuardError::FromCustomCode(AppGuardStatusCode code) noexcept
 {
-    switch (code)
-    {
-    case AppGuardStatusCode::APPGUARD_AUTH_STREAM_NOT_RUNNING:
-        return "APPGUARD_AUTH_STREAM_NOT_RUNNING";
-    case AppGuardStatusCode::APPGUARD_CONNECTION_TIMEOUT:
-        return "APPGUARD_CONNECTION_TIMEOUT";
-    case AppGuardStatusCode::APPGUARD_FAILED_TO_ACQUIRE_TOKEN:
-        return "APPGUARD_FAILED_TO_ACQUIRE_TOKEN";
-    case AppGuardStatusCode::APPGUARD_FAILED_TO_SAVE_CLIENT:
-        return "APPGUARD_FAILED_TO_SAVE_CLIENT";
-    case AppGuardStatusCode::APPGUARD_CERTIFICATE_NOT_FOUND:
-        return "APPGUARD_CERTIFICATE_NOT_FOUND";
-    case AppGuardStatusCode::APPGUARD_FAILED_TO_OBTAIN_UUID:
-        return "APPGUARD_FAILED_TO_OBTAIN_UUID";
-    case AppGuardStatusCode::APPGUARD_STORAGE_OPERATION_FAILURE:
-        return "APPGUARD_STORAGE_OPERATION_FAILURE";
-    default:
-        return "UNKNOWN";
-    }
+    auto index = static_cast<std::size_t>(code);
+
+    return index < std::size(CustomErrors) ? CustomErrors[index] : UnknownError;
 }
 
 AppGuardClientException::AppGuardClientException(const std::string &message)
@@ -68,18 +58,10 @@ AppGuardClientException::AppGuardClientException(const std::string &message)
 
 AppGuardClientException AppGuardClientException::FromGrpcStatus(const grpc::Status &status)
 {
-    std::stringstream ss;
-
-    ss << "gRPC error code " << GrpcStatusCodeToStr(status.error_code());
-
-    return AppGuardClientException(ss.str());
+    return AppGuardClientException(AppGuardError::FromGrpcStatus(status).what);
 }
 
 AppGuardClientException AppGuardClientException::FromCustomCode(AppGuardStatusCode code)
 {
-    std::stringstream ss;
-
-    ss << "AppGuardStatusCode status code " << AppGuardStatusCodeToStr(code);
-
-    return AppGuardClientException(ss.str());
-}
\ No newline at end of file
+    return AppGuardClientException(AppGuardError::FromCustomCode(code).what);
+}
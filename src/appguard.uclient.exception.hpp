@@ -22,7 +22,33 @@ enum class AppGuardStatusCode
     // Failed to obtain device UUID
     APPGUARD_FAILED_TO_OBTAIN_UUID,
     // Storage operation error
-    APPGUARD_STORAGE_OPERATION_FAILURE
+    APPGUARD_STORAGE_OPERATION_FAILURE,
+    // The circuit of every AppGuard backend is open.
+    APPGUARD_CIRCUIT_OPEN
+};
+
+/**
+ * @brief Static descriptor of an AppGuard client error.
+ *
+ * There is one descriptor per status code, with its message formatted at compile time, so
+ * reporting an error neither allocates nor formats anything.
+ */
+struct AppGuardError
+{
+    // Message of the error; has static storage duration.
+    const char *what;
+
+    /**
+     * @brief Returns the descriptor of a gRPC status code.
+     * @param status The gRPC status returned from a remote procedure call.
+     */
+    static const AppGuardError &FromGrpcStatus(const grpc::Status &status) noexcept;
+
+    /**
+     * @brief Returns the descriptor of an AppGuard-specific status code.
+     * @param code The custom AppGuard error code.
+     */
+    static const AppGuardError &FromCustomCode(AppGuardStatusCode code) noexcept;
 };
 
 /**
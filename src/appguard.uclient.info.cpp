@@ -4,12 +4,12 @@
 
 bool AppGaurdClientInfo::operator==(const AppGaurdClientInfo &other) const
 {
-    return std::tie(this->installation_code, this->server_addr, this->tls) ==
-           std::tie(other.installation_code, other.server_addr, other.tls);
+    return std::tie(this->installation_code, this->server_addr, this->tls, this->batch_window, this->batch_size, this->decision_stream, this->channels, this->queue_before_token) ==
+           std::tie(other.installation_code, other.server_addr, other.tls, other.batch_window, other.batch_size, other.decision_stream, other.channels, other.queue_before_token);
 }
 
 bool AppGaurdClientInfo::operator<(const AppGaurdClientInfo &other) const
 {
-    return std::tie(this->installation_code, this->server_addr, this->tls) <
-           std::tie(other.installation_code, other.server_addr, other.tls);
+    return std::tie(this->installation_code, this->server_addr, this->tls, this->batch_window, this->batch_size, this->decision_stream, this->channels, this->queue_before_token) <
+           std::tie(other.installation_code, other.server_addr, other.tls, other.batch_window, other.batch_size, other.decision_stream, other.channels, other.queue_before_token);
 }
\ No newline at end of file
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+#include <cstddef>
 #include <string>
 
 /**
@@ -15,6 +17,16 @@ struct AppGaurdClientInfo
     std::string server_cert_path;
     // Indicates whether to use TLS for the connection.
     bool tls;
+    // Coalescing window of batched calls; zero disables batching.
+    std::chrono::microseconds batch_window{0};
+    // Largest number of calls in a batch.
+    std::size_t batch_size = 0;
+    // Multiplexes the calls over a single decision stream.
+    bool decision_stream = false;
+    // Number of channels the calls are spread over.
+    std::size_t channels = 1;
+    // Waits for the first token instead of failing the calls made before it.
+    bool queue_before_token = false;
 
     /**
      * @brief Default constructor.
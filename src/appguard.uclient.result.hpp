@@ -0,0 +1,61 @@
+#pragma once
+
+#include "appguard.uclient.exception.hpp"
+
+#include <utility>
+
+/**
+ * @brief Outcome of an AppGuard client call: a value, or the descriptor of the error.
+ *
+ * Lets the hot path fall back on failures with a branch instead of throwing; only
+ * `Value` throws, for callers that prefer exceptions.
+ *
+ * @tparam T Type of the value; must be default-constructible.
+ */
+template <typename T>
+class AppGuardResult
+{
+public:
+    /**
+     * @brief Constructs a successful result.
+     */
+    AppGuardResult(T value) : value(std::move(value)) {}
+
+    /**
+     * @brief Constructs a failed result.
+     * @param error A static error descriptor.
+     */
+    AppGuardResult(const AppGuardError &error) : error(&error) {}
+
+    /**
+     * @brief Indicates that the result holds a value.
+     */
+    inline explicit operator bool() const noexcept { return this->error == nullptr; }
+
+    /**
+     * @brief Returns the value; the result must not be an error.
+     */
+    inline T &operator*() noexcept { return this->value; }
+    inline T *operator->() noexcept { return &this->value; }
+
+    /**
+     * @brief Returns the error; the result must be an error.
+     */
+    inline const AppGuardError &Error() const noexcept { return *this->error; }
+
+    /**
+     * @brief Returns the value, or throws an `AppGuardClientException` carrying the error.
+     */
+    T &Value()
+    {
+        if (this->error)
+            throw AppGuardClientException(this->error->what);
+
+        return this->value;
+    }
+
+private:
+    T value{};
+    // Error descriptor, or nullptr on success.
+    const AppGuardError *error = nullptr;
+};
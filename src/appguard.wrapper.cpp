@@ -3,9 +3,52 @@
 #include "appguard.http.ucache.hpp"
 
 #include <grpcpp/grpcpp.h>
+#include <algorithm>
 #include <fstream>
+#include <future>
+#include <mutex>
 #include <sstream>
 
+namespace
+{
+    /**
+     * @brief State of an in-flight asynchronous unary call; must outlive the call.
+     */
+    template <typename Request, typename Response>
+    struct AsyncCall
+    {
+        grpc::ClientContext context;
+        Request request;
+        Response response;
+        // Channel carrying the call.
+        AppGuardChannelPool::Lease lease;
+    };
+}
+
+/**
+ * @brief Status of the calls refused while the circuit of every backend is open.
+ */
+static inline grpc::Status CircuitOpen()
+{
+    return grpc::Status(grpc::StatusCode::UNAVAILABLE, "AppGuard circuit is open");
+}
+
+/**
+ * @brief Status of the batch calls that couldn't start.
+ */
+static inline grpc::Status Unavailable(const AppGuardError &error)
+{
+    return grpc::Status(grpc::StatusCode::UNAVAILABLE, error.what);
+}
+
+/**
+ * @brief Status of the calls made before the first token while they aren't queued.
+ */
+static inline grpc::Status NoToken()
+{
+    return grpc::Status(grpc::StatusCode::UNAVAILABLE, "AppGuard token isn't available yet");
+}
+
 static std::string readServerCertificate(const std::string &path)
 {
     std::ifstream file(path, std::ios::binary);
@@ -17,7 +60,7 @@ static std::string readServerCertificate(const std::string &path)
     return buffer.str();
 }
 
-static inline std::shared_ptr<grpc::Channel> OpenChannel(const std::string &addr, bool tls, const std::string &server_cert_path)
+static inline std::shared_ptr<grpc::ChannelCredentials> MakeCredentials(bool tls, const std::string &server_cert_path)
 {
     if (tls)
     {
@@ -26,22 +69,160 @@ static inline std::shared_ptr<grpc::Channel> OpenChannel(const std::string &addr
         options.pem_root_certs =
             server_cert_path.empty() ? "" : readServerCertificate(server_cert_path);
 
-        auto credentials = grpc::SslCredentials(options);
-        return grpc::CreateChannel(addr, credentials);
+        return grpc::SslCredentials(options);
     }
     else
     {
-        auto credentials = grpc::InsecureChannelCredentials();
-        return grpc::CreateChannel(addr, credentials);
+        return grpc::InsecureChannelCredentials();
     }
 }
 
-AppGuardWrapper::AppGuardWrapper(std::shared_ptr<grpc::Channel> channel, const std::string &installation_code)
-    : channel(channel), stream(new AppGuardStream(channel, installation_code))
+/**
+ * @brief Splits the comma-separated addresses of `appguard_server_addr`.
+ */
+static std::vector<std::string> SplitAddresses(const std::string &addrs)
+{
+    std::vector<std::string> result;
+    std::size_t start = 0;
+
+    for (;;)
+    {
+        auto end = addrs.find(',', start);
+        result.push_back(addrs.substr(start, end - start));
+
+        if (end == std::string::npos)
+            return result;
+
+        start = end + 1;
+    }
+}
+
+static std::string AgentKey(const AppGaurdClientInfo &client_info)
+{
+    return client_info.installation_code + '\0' + client_info.server_addr + '\0' + (client_info.tls ? '1' : '0');
+}
+
+AppGuardWrapper::AppGuardWrapper(std::shared_ptr<AppGuardChannelPool> channels, const AppGaurdClientInfo &client_info)
+    : channels(channels),
+      queue_before_token(client_info.queue_before_token),
+      stream(new AppGuardStream(
+          channels,
+          client_info.installation_code,
+          AppGuardAgent::Instance().Join(AgentKey(client_info))))
 {
+    if (client_info.decision_stream)
+        this->decisions = std::make_shared<AppGuardDecisionStream>(channels, this->stream);
+
+    if (client_info.batch_window.count() <= 0)
+        return;
+
+    // Senders run on the batcher threads and may outlive this instance's copies,
+    // so they hold the channels and stream rather than `this`.
+    auto stream = this->stream;
+    bool queue = client_info.queue_before_token;
+
+    this->tcp_batcher = std::make_shared<TcpConnectionBatcher>(
+        client_info.batch_window,
+        client_info.batch_size,
+        [channels, stream, queue](
+            std::vector<appguard::AppGuardTcpConnection> connections,
+            std::chrono::system_clock::time_point deadline,
+            TcpConnectionBatcher::BatchCallback done)
+        {
+            auto call = std::make_shared<AsyncCall<appguard::AppGuardTcpConnectionBatch, appguard::AppGuardTcpResponseBatch>>();
+
+            auto token = AcquireToken(*stream, deadline, queue);
+            if (!token)
+            {
+                std::vector<appguard::AppGuardTcpResponse> none;
+                done(Unavailable(token.Error()), none);
+                return;
+            }
+
+            call->lease = channels->Acquire();
+            if (!call->lease)
+            {
+                std::vector<appguard::AppGuardTcpResponse> none;
+                done(CircuitOpen(), none);
+                return;
+            }
+
+            call->request.set_token(**token);
+
+            for (auto &connection : connections)
+                *call->request.add_connections() = std::move(connection);
+
+            ApplyDeadline(call->context, deadline);
+
+            call->lease->experimental_async()->HandleTcpConnectionBatch(
+                &call->context,
+                &call->request,
+                &call->response,
+                [call, done = std::move(done)](grpc::Status status)
+                {
+                    call->lease.Complete(status);
+
+                    auto *responses = call->response.mutable_responses();
+                    std::vector<appguard::AppGuardTcpResponse> results(
+                        std::make_move_iterator(responses->begin()),
+                        std::make_move_iterator(responses->end()));
+
+                    done(status, results);
+                });
+        });
+
+    this->http_batcher = std::make_shared<HttpRequestBatcher>(
+        client_info.batch_window,
+        client_info.batch_size,
+        [channels, stream, queue](
+            std::vector<appguard::AppGuardHttpRequest> requests,
+            std::chrono::system_clock::time_point deadline,
+            HttpRequestBatcher::BatchCallback done)
+        {
+            auto call = std::make_shared<AsyncCall<appguard::AppGuardHttpRequestBatch, appguard::AppGuardResponseBatch>>();
+
+            auto token = AcquireToken(*stream, deadline, queue);
+            if (!token)
+            {
+                std::vector<appguard::AppGuardResponse> none;
+                done(Unavailable(token.Error()), none);
+                return;
+            }
+
+            call->lease = channels->Acquire();
+            if (!call->lease)
+            {
+                std::vector<appguard::AppGuardResponse> none;
+                done(CircuitOpen(), none);
+                return;
+            }
+
+            call->request.set_token(**token);
+
+            for (auto &request : requests)
+                *call->request.add_requests() = std::move(request);
+
+            ApplyDeadline(call->context, deadline);
+
+            call->lease->experimental_async()->HandleHttpRequestBatch(
+                &call->context,
+                &call->request,
+                &call->response,
+                [call, done = std::move(done)](grpc::Status status)
+                {
+                    call->lease.Complete(status);
+
+                    auto *responses = call->response.mutable_responses();
+                    std::vector<appguard::AppGuardResponse> results(
+                        std::make_move_iterator(responses->begin()),
+                        std::make_move_iterator(responses->end()));
+
+                    done(status, results);
+                });
+        });
 }
 
-AppGuardWrapper AppGuardWrapper::CreateClient(AppGaurdClientInfo client_info, const std::chrono::milliseconds &deadline)
+AppGuardWrapper AppGuardWrapper::CreateClient(AppGaurdClientInfo client_info)
 {
     static std::map<AppGaurdClientInfo, AppGuardWrapper> clients{};
 
@@ -50,12 +231,16 @@ AppGuardWrapper AppGuardWrapper::CreateClient(AppGaurdClientInfo client_info, co
         return iter->second;
     }
 
-    auto channel = OpenChannel(client_info.server_addr, client_info.tls, client_info.server_cert_path);
-    std::chrono::system_clock::time_point deadline_time = std::chrono::system_clock::now() + deadline;
+    auto channels = std::make_shared<AppGuardChannelPool>(
+        SplitAddresses(client_info.server_addr),
+        MakeCredentials(client_info.tls, client_info.server_cert_path),
+        client_info.channels);
 
-    THROW_IF_CUSTOM(!channel->WaitForConnected(deadline_time), AppGuardStatusCode::APPGUARD_CONNECTION_TIMEOUT);
+    // Connecting and authenticating go on in the background; calls made meanwhile either
+    // fail fast or wait for the token, as `queue_before_token` says.
+    channels->Connect();
 
-    auto client = AppGuardWrapper(channel, client_info.installation_code);
+    auto client = AppGuardWrapper(channels, client_info);
     const auto [_, success] = clients.emplace(client_info, client);
 
     THROW_IF_CUSTOM(!success, AppGuardStatusCode::APPGUARD_FAILED_TO_SAVE_CLIENT);
@@ -66,22 +251,64 @@ AppGuardWrapper AppGuardWrapper::CreateClient(AppGaurdClientInfo client_info, co
 appguard::AppGuardTcpResponse
 AppGuardWrapper::HandleTcpConnection(appguard::AppGuardTcpConnection connection)
 {
-    auto token = this->AcquireToken();
-    connection.set_token(token);
+    return std::move(this->TryHandleTcpConnection(connection).Value());
+}
+
+AppGuardResult<appguard::AppGuardTcpResponse>
+AppGuardWrapper::TryHandleTcpConnection(appguard::AppGuardTcpConnection &connection)
+{
+    auto deadline = this->CallDeadline();
+
+    if (this->UseDecisionStream())
+    {
+        appguard::AppGuardDecisionRequest request;
+        *request.mutable_tcp_connection() = connection;
+
+        auto decision = this->Decide(std::move(request), deadline);
+        if (!decision)
+            return decision.Error();
+
+        return std::move(*decision->mutable_tcp_response());
+    }
+
+    if (this->channels->Open())
+        return AppGuardError::FromCustomCode(AppGuardStatusCode::APPGUARD_CIRCUIT_OPEN);
 
-    auto stub = appguard::AppGuard::NewStub(this->channel);
+    auto token = AcquireToken(*this->stream, deadline, this->queue_before_token);
+    if (!token)
+        return token.Error();
+
+    // The lease is only taken once the token is there, so that waiting for it counts
+    // neither as an outstanding call on the channel nor in the backend's latency.
+    auto lease = this->channels->Acquire();
+    if (!lease)
+        return AppGuardError::FromCustomCode(AppGuardStatusCode::APPGUARD_CIRCUIT_OPEN);
+
+    connection.set_token(**token);
 
     grpc::ClientContext context;
+    ApplyDeadline(context, deadline);
     appguard::AppGuardTcpResponse response;
 
-    auto status = stub->HandleTcpConnection(&context, connection, &response);
-    THROW_IF_GRPC(status);
+    // Blocking callers make plain synchronous calls on the shared stub; the callback API
+    // is kept for the asynchronous paths, where the completion resumes the request.
+    auto status = lease->HandleTcpConnection(&context, connection, &response);
+    lease.Complete(status);
+
+    if (!status.ok())
+        return AppGuardError::FromGrpcStatus(status);
 
     return response;
 }
 
 appguard_commands::FirewallPolicy
 AppGuardWrapper::HandleHttpRequest(appguard::AppGuardHttpRequest &request)
+{
+    return this->TryHandleHttpRequest(request).Value();
+}
+
+AppGuardResult<appguard_commands::FirewallPolicy>
+AppGuardWrapper::TryHandleHttpRequest(appguard::AppGuardHttpRequest &request)
 {
     auto cacheKey = HttpRequestCacheKey::FromRequest(request);
     auto &cache = AppguardHttpCache<HttpRequestCacheKey>::GetInstance();
@@ -91,16 +318,49 @@ AppGuardWrapper::HandleHttpRequest(appguard::AppGuardHttpRequest &request)
         return cacheEntry.value();
     }
 
-    auto token = this->AcquireToken();
-    request.set_token(token);
+    auto deadline = this->CallDeadline();
 
-    auto stub = appguard::AppGuard::NewStub(this->channel);
+    if (this->UseDecisionStream())
+    {
+        appguard::AppGuardDecisionRequest decision;
+        *decision.mutable_http_request() = request;
+
+        auto result = this->Decide(std::move(decision), deadline);
+        if (!result)
+            return result.Error();
+
+        auto policy = result->response().policy();
+
+        if (cache.IsEnabled())
+        {
+            cache.Put(std::move(cacheKey), policy);
+        }
+
+        return policy;
+    }
+
+    if (this->channels->Open())
+        return AppGuardError::FromCustomCode(AppGuardStatusCode::APPGUARD_CIRCUIT_OPEN);
+
+    auto token = AcquireToken(*this->stream, deadline, this->queue_before_token);
+    if (!token)
+        return token.Error();
+
+    auto lease = this->channels->Acquire();
+    if (!lease)
+        return AppGuardError::FromCustomCode(AppGuardStatusCode::APPGUARD_CIRCUIT_OPEN);
+
+    request.set_token(**token);
 
     grpc::ClientContext context;
+    ApplyDeadline(context, deadline);
     appguard::AppGuardResponse response;
 
-    auto status = stub->HandleHttpRequest(&context, request, &response);
-    THROW_IF_GRPC(status);
+    auto status = lease->HandleHttpRequest(&context, request, &response);
+    lease.Complete(status);
+
+    if (!status.ok())
+        return AppGuardError::FromGrpcStatus(status);
 
     if (cache.IsEnabled())
     {
@@ -110,19 +370,146 @@ AppGuardWrapper::HandleHttpRequest(appguard::AppGuardHttpRequest &request)
     return response.policy();
 }
 
+appguard_commands::FirewallPolicy
+AppGuardWrapper::HandleTcpConnectionAndHttpRequest(
+    appguard::AppGuardTcpConnection connection,
+    appguard::AppGuardHttpRequest &request,
+    appguard::AppGuardTcpResponse &tcp_response)
+{
+    return this->TryHandleTcpConnectionAndHttpRequest(std::move(connection), request, tcp_response).Value();
+}
+
+AppGuardResult<appguard_commands::FirewallPolicy>
+AppGuardWrapper::TryHandleTcpConnectionAndHttpRequest(
+    appguard::AppGuardTcpConnection connection,
+    appguard::AppGuardHttpRequest &request,
+    appguard::AppGuardTcpResponse &tcp_response)
+{
+    *request.mutable_tcp_info()->mutable_connection() = connection;
+
+    if (this->UseDecisionStream())
+    {
+        // Both decisions share the stream; the TCP one is answered while the HTTP one is made.
+        std::promise<void> tcp_done;
+        auto tcp_future = tcp_done.get_future();
+
+        this->HandleTcpConnectionAsync(
+            std::move(connection),
+            [&tcp_done, &tcp_response](const grpc::Status &status, appguard::AppGuardTcpResponse &response)
+            {
+                if (status.ok())
+                    tcp_response = std::move(response);
+
+                tcp_done.set_value();
+            });
+
+        auto policy = this->TryHandleHttpRequest(request);
+        tcp_future.wait();
+        return policy;
+    }
+
+    // The TCP call is started on a completion queue owned by this frame and overlaps the
+    // synchronous HTTP call; no callback thread is involved.
+    auto deadline = this->CallDeadline();
+    grpc::CompletionQueue queue;
+    grpc::ClientContext tcp_context;
+    grpc::Status tcp_status;
+    appguard::AppGuardTcpResponse response;
+    AppGuardChannelPool::Lease lease;
+    std::unique_ptr<grpc::ClientAsyncResponseReader<appguard::AppGuardTcpResponse>> tcp_call;
+
+    if (!this->channels->Open())
+    {
+        if (auto token = AcquireToken(*this->stream, deadline, this->queue_before_token); token)
+        {
+            lease = this->channels->Acquire();
+
+            if (lease)
+            {
+                connection.set_token(**token);
+                ApplyDeadline(tcp_context, deadline);
+
+                tcp_call = lease->AsyncHandleTcpConnection(&tcp_context, connection, &queue);
+                tcp_call->Finish(&response, &tcp_status, &tcp_call);
+            }
+        }
+    }
+
+    auto policy = this->TryHandleHttpRequest(request);
+
+    void *tag;
+    bool ok;
+
+    if (tcp_call)
+    {
+        queue.Next(&tag, &ok);
+        lease.Complete(tcp_status);
+
+        if (tcp_status.ok())
+            tcp_response = std::move(response);
+    }
+
+    queue.Shutdown();
+    while (queue.Next(&tag, &ok))
+        ;
+
+    return policy;
+}
+
 appguard_commands::FirewallPolicy
 AppGuardWrapper::HandleHttpResponse(appguard::AppGuardHttpRequest &request, appguard::AppGuardHttpResponse &response)
 {
-    auto token = this->AcquireToken();
-    response.set_token(token);
+    return this->TryHandleHttpResponse(request, response).Value();
+}
+
+AppGuardResult<appguard_commands::FirewallPolicy>
+AppGuardWrapper::TryHandleHttpResponse(appguard::AppGuardHttpRequest &request, appguard::AppGuardHttpResponse &response)
+{
+    auto deadline = this->CallDeadline();
+
+    if (this->UseDecisionStream())
+    {
+        appguard::AppGuardDecisionRequest decision;
+        *decision.mutable_http_response() = response;
+
+        auto result = this->Decide(std::move(decision), deadline);
+        if (!result)
+            return result.Error();
+
+        auto policy = result->response().policy();
+
+        auto &cache = AppguardHttpCache<HttpRequestCacheKey>::GetInstance();
+
+        if (cache.IsEnabled())
+        {
+            cache.Put(HttpRequestCacheKey::FromRequest(request), policy);
+        }
+
+        return policy;
+    }
+
+    if (this->channels->Open())
+        return AppGuardError::FromCustomCode(AppGuardStatusCode::APPGUARD_CIRCUIT_OPEN);
+
+    auto token = AcquireToken(*this->stream, deadline, this->queue_before_token);
+    if (!token)
+        return token.Error();
+
+    auto lease = this->channels->Acquire();
+    if (!lease)
+        return AppGuardError::FromCustomCode(AppGuardStatusCode::APPGUARD_CIRCUIT_OPEN);
 
-    auto stub = appguard::AppGuard::NewStub(this->channel);
+    response.set_token(**token);
 
     grpc::ClientContext context;
+    ApplyDeadline(context, deadline);
     appguard::AppGuardResponse retval;
 
-    auto status = stub->HandleHttpResponse(&context, response, &retval);
-    THROW_IF_GRPC(status);
+    auto status = lease->HandleHttpResponse(&context, response, &retval);
+    lease.Complete(status);
+
+    if (!status.ok())
+        return AppGuardError::FromGrpcStatus(status);
 
     auto cacheKey = HttpRequestCacheKey::FromRequest(request);
     auto &cache = AppguardHttpCache<HttpRequestCacheKey>::GetInstance();
@@ -135,13 +522,487 @@ AppGuardWrapper::HandleHttpResponse(appguard::AppGuardHttpRequest &request, appg
     return retval.policy();
 }
 
-std::string AppGuardWrapper::AcquireToken() const
+void AppGuardWrapper::HandleTcpConnectionAsync(appguard::AppGuardTcpConnection connection, TcpConnectionCallback callback)
+{
+    auto deadline = this->CallDeadline();
+
+    if (this->UseDecisionStream())
+    {
+        appguard::AppGuardDecisionRequest request;
+        *request.mutable_tcp_connection() = std::move(connection);
+
+        this->decisions->Send(
+            std::move(request),
+            deadline,
+            [callback = std::move(callback)](const grpc::Status &status, appguard::AppGuardDecisionResponse &response)
+            {
+                callback(status, *response.mutable_tcp_response());
+            });
+        return;
+    }
+
+    if (this->tcp_batcher)
+    {
+        if (this->channels->Open())
+        {
+            appguard::AppGuardTcpResponse none;
+            callback(CircuitOpen(), none);
+            return;
+        }
+
+        this->tcp_batcher->Add(std::move(connection), deadline, std::move(callback));
+        return;
+    }
+
+    auto call = std::make_shared<AsyncCall<appguard::AppGuardTcpConnection, appguard::AppGuardTcpResponse>>();
+
+    if (this->channels->Open())
+    {
+        callback(CircuitOpen(), call->response);
+        return;
+    }
+
+    call->request = std::move(connection);
+
+    this->WithToken(
+        deadline,
+        [call, channels = this->channels, deadline, callback = std::move(callback)](const std::string *token) mutable
+        {
+            if (!token)
+            {
+                callback(NoToken(), call->response);
+                return;
+            }
+
+            call->lease = channels->Acquire();
+            if (!call->lease)
+            {
+                callback(CircuitOpen(), call->response);
+                return;
+            }
+
+            call->request.set_token(*token);
+            ApplyDeadline(call->context, deadline);
+
+            call->lease->experimental_async()->HandleTcpConnection(
+                &call->context,
+                &call->request,
+                &call->response,
+                [call, callback = std::move(callback)](grpc::Status status)
+                {
+                    call->lease.Complete(status);
+
+                    callback(status, call->response);
+                });
+        });
+}
+
+void AppGuardWrapper::HandleHttpRequestAsync(appguard::AppGuardHttpRequest request, PolicyCallback callback)
+{
+    auto cacheKey = HttpRequestCacheKey::FromRequest(request);
+    auto &cache = AppguardHttpCache<HttpRequestCacheKey>::GetInstance();
+
+    if (auto cacheEntry = cache.Get(cacheKey); cacheEntry.has_value() && cache.IsEnabled())
+    {
+        callback(grpc::Status::OK, cacheEntry.value());
+        return;
+    }
+
+    auto deadline = this->CallDeadline();
+
+    if (this->UseDecisionStream())
+    {
+        appguard::AppGuardDecisionRequest decision;
+        *decision.mutable_http_request() = std::move(request);
+
+        this->decisions->Send(
+            std::move(decision),
+            deadline,
+            [cacheKey = std::move(cacheKey), callback = std::move(callback)](const grpc::Status &status, appguard::AppGuardDecisionResponse &response) mutable
+            {
+                auto &cache = AppguardHttpCache<HttpRequestCacheKey>::GetInstance();
+
+                if (status.ok() && cache.IsEnabled())
+                {
+                    cache.Put(std::move(cacheKey), response.response().policy());
+                }
+
+                callback(status, response.response().policy());
+            });
+        return;
+    }
+
+    if (this->http_batcher)
+    {
+        if (this->channels->Open())
+        {
+            callback(CircuitOpen(), appguard_commands::FirewallPolicy::UNKNOWN);
+            return;
+        }
+
+        this->http_batcher->Add(
+            std::move(request),
+            deadline,
+            [cacheKey = std::move(cacheKey), callback = std::move(callback)](const grpc::Status &status, appguard::AppGuardResponse &response) mutable
+            {
+                auto &cache = AppguardHttpCache<HttpRequestCacheKey>::GetInstance();
+
+                if (status.ok() && cache.IsEnabled())
+                {
+                    cache.Put(std::move(cacheKey), response.policy());
+                }
+
+                callback(status, response.policy());
+            });
+        return;
+    }
+
+    auto call = std::make_shared<AsyncCall<appguard::AppGuardHttpRequest, appguard::AppGuardResponse>>();
+
+    if (this->channels->Open())
+    {
+        callback(CircuitOpen(), call->response.policy());
+        return;
+    }
+
+    call->request = std::move(request);
+
+    this->WithToken(
+        deadline,
+        [call, channels = this->channels, deadline, cacheKey = std::move(cacheKey), callback = std::move(callback)](const std::string *token) mutable
+        {
+            if (!token)
+            {
+                callback(NoToken(), call->response.policy());
+                return;
+            }
+
+            call->lease = channels->Acquire();
+            if (!call->lease)
+            {
+                callback(CircuitOpen(), call->response.policy());
+                return;
+            }
+
+            call->request.set_token(*token);
+            ApplyDeadline(call->context, deadline);
+
+            call->lease->experimental_async()->HandleHttpRequest(
+                &call->context,
+                &call->request,
+                &call->response,
+                [call, cacheKey = std::move(cacheKey), callback = std::move(callback)](grpc::Status status) mutable
+                {
+                    call->lease.Complete(status);
+
+                    auto &cache = AppguardHttpCache<HttpRequestCacheKey>::GetInstance();
+
+                    if (status.ok() && cache.IsEnabled())
+                    {
+                        cache.Put(std::move(cacheKey), call->response.policy());
+                    }
+
+                    callback(status, call->response.policy());
+                });
+        });
+}
+
+void AppGuardWrapper::HandleHttpResponseAsync(
+    appguard::AppGuardHttpRequest request,
+    appguard::AppGuardHttpResponse response,
+    PolicyCallback callback)
 {
-    THROW_IF_CUSTOM(!this->stream->Running(), AppGuardStatusCode::APPGUARD_AUTH_STREAM_NOT_RUNNING);
+    auto deadline = this->CallDeadline();
 
-    auto token = this->stream->WaitForToken();
+    if (this->UseDecisionStream())
+    {
+        appguard::AppGuardDecisionRequest decision;
+        *decision.mutable_http_response() = std::move(response);
+
+        this->decisions->Send(
+            std::move(decision),
+            deadline,
+            [cacheKey = HttpRequestCacheKey::FromRequest(request), callback = std::move(callback)](const grpc::Status &status, appguard::AppGuardDecisionResponse &response) mutable
+            {
+                auto &cache = AppguardHttpCache<HttpRequestCacheKey>::GetInstance();
+
+                if (status.ok() && cache.IsEnabled())
+                {
+                    cache.Put(std::move(cacheKey), response.response().policy());
+                }
+
+                callback(status, response.response().policy());
+            });
+        return;
+    }
 
-    THROW_IF_CUSTOM(token.empty(), AppGuardStatusCode::APPGUARD_FAILED_TO_ACQUIRE_TOKEN);
+    auto call = std::make_shared<AsyncCall<appguard::AppGuardHttpResponse, appguard::AppGuardResponse>>();
+
+    if (this->channels->Open())
+    {
+        callback(CircuitOpen(), call->response.policy());
+        return;
+    }
+
+    call->request = std::move(response);
+
+    this->WithToken(
+        deadline,
+        [call, channels = this->channels, deadline, cacheKey = HttpRequestCacheKey::FromRequest(request), callback = std::move(callback)](const std::string *token) mutable
+        {
+            if (!token)
+            {
+                callback(NoToken(), call->response.policy());
+                return;
+            }
+
+            call->lease = channels->Acquire();
+            if (!call->lease)
+            {
+                callback(CircuitOpen(), call->response.policy());
+                return;
+            }
+
+            call->request.set_token(*token);
+            ApplyDeadline(call->context, deadline);
+
+            call->lease->experimental_async()->HandleHttpResponse(
+                &call->context,
+                &call->request,
+                &call->response,
+                [call, cacheKey = std::move(cacheKey), callback = std::move(callback)](grpc::Status status) mutable
+                {
+                    call->lease.Complete(status);
+
+                    auto &cache = AppguardHttpCache<HttpRequestCacheKey>::GetInstance();
+
+                    if (status.ok() && cache.IsEnabled())
+                    {
+                        cache.Put(std::move(cacheKey), call->response.policy());
+                    }
+
+                    callback(status, call->response.policy());
+                });
+        });
+}
+
+void AppGuardWrapper::HandleHttpResponseBatchAsync(
+    std::vector<appguard::AppGuardHttpRequest> requests,
+    std::vector<appguard::AppGuardHttpResponse> responses,
+    PoliciesCallback callback)
+{
+    std::vector<HttpRequestCacheKey> cacheKeys;
+    cacheKeys.reserve(requests.size());
+
+    for (const auto &request : requests)
+        cacheKeys.push_back(HttpRequestCacheKey::FromRequest(request));
+
+    if (this->UseDecisionStream())
+    {
+        // The stream has no batches; it already multiplexes the responses on one call.
+        struct Pending
+        {
+            std::mutex mutex;
+            grpc::Status status;
+            std::vector<appguard_commands::FirewallPolicy> policies;
+            std::size_t remaining;
+            PoliciesCallback callback;
+        };
+
+        auto pending = std::make_shared<Pending>();
+        pending->policies.resize(responses.size());
+        pending->remaining = responses.size();
+        pending->callback = std::move(callback);
+
+        if (responses.empty())
+        {
+            pending->callback(pending->status, pending->policies);
+            return;
+        }
+
+        for (std::size_t i = 0; i < responses.size(); i++)
+        {
+            this->HandleHttpResponseAsync(
+                std::move(requests[i]),
+                std::move(responses[i]),
+                [pending, i](const grpc::Status &status, appguard_commands::FirewallPolicy policy)
+                {
+                    std::unique_lock<std::mutex> lock(pending->mutex);
+
+                    pending->policies[i] = policy;
+                    if (!status.ok() && pending->status.ok())
+                        pending->status = status;
+
+                    if (--pending->remaining == 0)
+                    {
+                        lock.unlock();
+                        pending->callback(pending->status, pending->policies);
+                    }
+                });
+        }
+        return;
+    }
+
+    auto deadline = this->CallDeadline();
+    auto call = std::make_shared<AsyncCall<appguard::AppGuardHttpResponseBatch, appguard::AppGuardResponseBatch>>();
+    std::vector<appguard_commands::FirewallPolicy> none;
+
+    if (this->channels->Open())
+    {
+        callback(CircuitOpen(), none);
+        return;
+    }
+
+    for (auto &response : responses)
+        *call->request.add_responses() = std::move(response);
+
+    this->WithToken(
+        deadline,
+        [call, channels = this->channels, deadline, cacheKeys = std::move(cacheKeys), callback = std::move(callback)](const std::string *token) mutable
+        {
+            std::vector<appguard_commands::FirewallPolicy> none;
+
+            if (!token)
+            {
+                callback(NoToken(), none);
+                return;
+            }
+
+            call->lease = channels->Acquire();
+            if (!call->lease)
+            {
+                callback(CircuitOpen(), none);
+                return;
+            }
+
+            call->request.set_token(*token);
+            ApplyDeadline(call->context, deadline);
+
+            call->lease->experimental_async()->HandleHttpResponseBatch(
+                &call->context,
+                &call->request,
+                &call->response,
+                [call, cacheKeys = std::move(cacheKeys), callback = std::move(callback)](grpc::Status status) mutable
+                {
+                    call->lease.Complete(status);
+
+                    if (status.ok() && static_cast<std::size_t>(call->response.responses_size()) != cacheKeys.size())
+                        status = grpc::Status(grpc::StatusCode::INTERNAL, "AppGuard batch response is incomplete");
+
+                    std::vector<appguard_commands::FirewallPolicy> policies;
+
+                    if (status.ok())
+                    {
+                        auto &cache = AppguardHttpCache<HttpRequestCacheKey>::GetInstance();
+                        policies.reserve(cacheKeys.size());
+
+                        for (std::size_t i = 0; i < cacheKeys.size(); i++)
+                        {
+                            auto policy = call->response.responses(static_cast<int>(i)).policy();
+
+                            if (cache.IsEnabled())
+                                cache.Put(std::move(cacheKeys[i]), policy);
+
+                            policies.push_back(policy);
+                        }
+                    }
+
+                    callback(status, policies);
+                });
+        });
+}
+
+std::chrono::system_clock::time_point AppGuardWrapper::CallDeadline() const
+{
+    auto timeout = this->timeout.count() > 0 ? this->timeout : this->stream->DefaultTimeout();
+
+    if (timeout.count() <= 0)
+        return std::chrono::system_clock::time_point::max();
+
+    return std::chrono::system_clock::now() + timeout;
+}
+
+AppGuardResult<AppGuardStream::Token> AppGuardWrapper::AcquireToken(AppGuardStream &stream, std::chrono::system_clock::time_point deadline, bool wait)
+{
+    if (!stream.Running())
+        return AppGuardError::FromCustomCode(AppGuardStatusCode::APPGUARD_AUTH_STREAM_NOT_RUNNING);
+
+    if (auto token = stream.PeekToken(); token)
+        return token;
+
+    if (!wait)
+        return AppGuardError::FromCustomCode(AppGuardStatusCode::APPGUARD_FAILED_TO_ACQUIRE_TOKEN);
+
+    auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(TokenDeadline(deadline) - std::chrono::system_clock::now());
+
+    auto token = stream.WaitForToken(std::max(remaining, std::chrono::milliseconds(0)));
+    if (!token)
+        return AppGuardError::FromCustomCode(AppGuardStatusCode::APPGUARD_FAILED_TO_ACQUIRE_TOKEN);
 
     return token;
 }
+
+template <typename Start>
+void AppGuardWrapper::WithToken(std::chrono::system_clock::time_point deadline, Start start)
+{
+    if (!this->stream->Running())
+    {
+        start(nullptr);
+        return;
+    }
+
+    if (auto token = this->stream->PeekToken(); token)
+    {
+        start(token.get());
+        return;
+    }
+
+    if (!this->queue_before_token)
+    {
+        start(nullptr);
+        return;
+    }
+
+    this->stream->WhenToken(TokenDeadline(deadline), std::move(start));
+}
+
+std::chrono::system_clock::time_point AppGuardWrapper::TokenDeadline(std::chrono::system_clock::time_point deadline)
+{
+    return std::min(deadline, std::chrono::system_clock::now() + std::chrono::milliseconds(5'000));
+}
+
+AppGuardResult<appguard::AppGuardDecisionResponse> AppGuardWrapper::Decide(
+    appguard::AppGuardDecisionRequest request,
+    std::chrono::system_clock::time_point deadline)
+{
+    // The callback may run after a timed out caller has returned, so it owns the promise.
+    auto done = std::make_shared<std::promise<std::pair<grpc::Status, appguard::AppGuardDecisionResponse>>>();
+    auto future = done->get_future();
+
+    this->decisions->Send(
+        std::move(request),
+        deadline,
+        [done](const grpc::Status &status, appguard::AppGuardDecisionResponse &response)
+        {
+            done->set_value({status, std::move(response)});
+        });
+
+    // The stream fails expired decisions itself, but only as long as its writer keeps up.
+    if (deadline == std::chrono::system_clock::time_point::max())
+        future.wait();
+    else if (future.wait_until(deadline) == std::future_status::timeout)
+        return AppGuardError::FromGrpcStatus(grpc::Status(grpc::StatusCode::DEADLINE_EXCEEDED, "Deadline Exceeded"));
+
+    auto [status, response] = future.get();
+
+    if (!status.ok())
+        return AppGuardError::FromGrpcStatus(status);
+
+    return std::move(response);
+}
+
+void AppGuardWrapper::ApplyDeadline(grpc::ClientContext &context, std::chrono::system_clock::time_point deadline)
+{
+    if (deadline != std::chrono::system_clock::time_point::max())
+        context.set_deadline(deadline);
+}
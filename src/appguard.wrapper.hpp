@@ -4,26 +4,61 @@
 #include "generated/appguard.grpc.pb.h"
 #include "appguard.uclient.info.hpp"
 #include "appguard.stream.hpp"
+#include "appguard.batcher.hpp"
+#include "appguard.decision.stream.hpp"
+#include "appguard.channel.pool.hpp"
+#include "appguard.uclient.result.hpp"
+
+#include <functional>
+#include <vector>
 
 /**
  * @brief Wrapper class for interacting with the AppGuard service.
  *
  * This class provides methods to create a client instance and handle various types of connections
  * and requests with the AppGuard service.
+ *
+ * Each synchronous call comes in two forms: `TryHandle*` returns an `AppGuardResult` so
+ * that failures cost a branch, and `Handle*` throws an `AppGuardClientException` instead.
+ * Asynchronous calls report failures through their callbacks and never throw.
  */
 class AppGuardWrapper
 {
 public:
+    /**
+     * @brief Completion callback of an asynchronous TCP connection call.
+     *
+     * Invoked on a gRPC thread with the call status and the server's response.
+     */
+    using TcpConnectionCallback =
+        std::function<void(const grpc::Status &, appguard::AppGuardTcpResponse &)>;
+
+    /**
+     * @brief Completion callback of an asynchronous HTTP request call.
+     *
+     * Invoked on a gRPC thread (or synchronously on a cache hit) with the call status and the verdict.
+     */
+    using PolicyCallback =
+        std::function<void(const grpc::Status &, appguard_commands::FirewallPolicy)>;
+
+    /**
+     * @brief Completion callback of an asynchronous batch of HTTP response calls.
+     *
+     * Invoked on a gRPC thread with the call status and the verdicts, in the order of the responses.
+     */
+    using PoliciesCallback =
+        std::function<void(const grpc::Status &, const std::vector<appguard_commands::FirewallPolicy> &)>;
+
     /**
      * @brief Creates and initializes an AppGuard client instance.
      *
+     * Doesn't block: the channels connect and the control stream authenticates in the
+     * background.
+     *
      * @param client_info Configuration information required to establish the client.
-     * @param deadline Optional timeout duration for establishing the connection.
      * @return An initialized AppGuardWrapper instance.
      */
-    static AppGuardWrapper CreateClient(
-        AppGaurdClientInfo client_info,
-        const std::chrono::milliseconds &deadline = std::chrono::milliseconds(5'000));
+    static AppGuardWrapper CreateClient(AppGaurdClientInfo client_info);
 
     /**
      * @brief Destructor.
@@ -33,13 +68,24 @@ public:
     /**
      * @brief Copy constructor.
      */
-    AppGuardWrapper(AppGuardWrapper &) = default;
+    AppGuardWrapper(const AppGuardWrapper &) = default;
 
     /**
      * @brief Move constructor.
      */
     AppGuardWrapper(AppGuardWrapper &&) = default;
 
+    /**
+     * @brief Sets the latency budget of the calls made through this instance.
+     *
+     * The budget covers waiting for the token and the call itself. Zero falls back to
+     * the timeout pushed by the server in `FirewallDefaults`; if that is zero as well,
+     * calls have no deadline.
+     *
+     * @param timeout The latency budget.
+     */
+    inline void SetTimeout(std::chrono::milliseconds timeout) noexcept { this->timeout = timeout; }
+
     /**
      * @brief Handles a TCP connection request.
      *
@@ -49,6 +95,17 @@ public:
     [[nodiscard]] appguard::AppGuardTcpResponse
     HandleTcpConnection(appguard::AppGuardTcpConnection connection);
 
+    /**
+     * @brief Handles a TCP connection request without throwing.
+     *
+     * Takes the connection by reference so that it may live on the caller's arena.
+     *
+     * @param connection The TCP connection details to be handled; receives the token.
+     * @return The response from the AppGuard service, or the error.
+     */
+    [[nodiscard]] AppGuardResult<appguard::AppGuardTcpResponse>
+    TryHandleTcpConnection(appguard::AppGuardTcpConnection &connection);
+
     /**
      * @brief Handles an HTTP request.
      *
@@ -58,6 +115,46 @@ public:
     [[nodiscard]] appguard_commands::FirewallPolicy
     HandleHttpRequest(appguard::AppGuardHttpRequest &request);
 
+    /**
+     * @brief Handles an HTTP request without throwing.
+     *
+     * @param request The HTTP request details to be handled.
+     * @return The verdict, or the error.
+     */
+    [[nodiscard]] AppGuardResult<appguard_commands::FirewallPolicy>
+    TryHandleHttpRequest(appguard::AppGuardHttpRequest &request);
+
+    /**
+     * @brief Handles a new TCP connection and its first HTTP request concurrently.
+     *
+     * The HTTP request carries only the connection tuple in `tcp_info`, which the server
+     * uses to correlate it with the TCP call, so both calls are in flight at the same time.
+     *
+     * @param connection The TCP connection details to be handled.
+     * @param request The HTTP request details to be handled.
+     * @param tcp_response Receives the TCP response; left empty if the TCP call failed.
+     * @return The verdict for the HTTP request.
+     */
+    [[nodiscard]] appguard_commands::FirewallPolicy
+    HandleTcpConnectionAndHttpRequest(
+        appguard::AppGuardTcpConnection connection,
+        appguard::AppGuardHttpRequest &request,
+        appguard::AppGuardTcpResponse &tcp_response);
+
+    /**
+     * @brief Handles a new TCP connection and its first HTTP request concurrently, without throwing.
+     *
+     * @param connection The TCP connection details to be handled.
+     * @param request The HTTP request details to be handled.
+     * @param tcp_response Receives the TCP response; left empty if the TCP call failed.
+     * @return The verdict for the HTTP request, or the error of the HTTP call.
+     */
+    [[nodiscard]] AppGuardResult<appguard_commands::FirewallPolicy>
+    TryHandleTcpConnectionAndHttpRequest(
+        appguard::AppGuardTcpConnection connection,
+        appguard::AppGuardHttpRequest &request,
+        appguard::AppGuardTcpResponse &tcp_response);
+
     /**
      * @brief Handles an HTTP response.
      *
@@ -68,24 +165,151 @@ public:
     [[nodiscard]] appguard_commands::FirewallPolicy
     HandleHttpResponse(appguard::AppGuardHttpRequest &request, appguard::AppGuardHttpResponse &response);
 
+    /**
+     * @brief Handles an HTTP response without throwing.
+     *
+     * @param request The HTTP request the response belongs to.
+     * @param response The HTTP response details to be handled.
+     * @return The verdict, or the error.
+     */
+    [[nodiscard]] AppGuardResult<appguard_commands::FirewallPolicy>
+    TryHandleHttpResponse(appguard::AppGuardHttpRequest &request, appguard::AppGuardHttpResponse &response);
+
+    /**
+     * @brief Starts handling a TCP connection without waiting for the reply.
+     *
+     * With the decision stream connected, the connection is sent over it; otherwise, with
+     * batching enabled, it joins the next `HandleTcpConnectionBatch` call.
+     *
+     * @param connection The TCP connection details to be handled.
+     * @param callback Invoked once the call completes.
+     */
+    void HandleTcpConnectionAsync(appguard::AppGuardTcpConnection connection, TcpConnectionCallback callback);
+
+    /**
+     * @brief Starts handling an HTTP request without waiting for the reply.
+     *
+     * Cached verdicts are delivered to the callback immediately. With the decision stream
+     * connected, the request is sent over it; otherwise, with batching enabled, it joins the
+     * next `HandleHttpRequestBatch` call.
+     *
+     * @param request The HTTP request details to be handled.
+     * @param callback Invoked once the verdict is known.
+     */
+    void HandleHttpRequestAsync(appguard::AppGuardHttpRequest request, PolicyCallback callback);
+
+    /**
+     * @brief Starts handling an HTTP response without waiting for the reply.
+     *
+     * @param request The HTTP request the response belongs to.
+     * @param response The HTTP response details to be handled.
+     * @param callback Invoked once the verdict is known.
+     */
+    void HandleHttpResponseAsync(
+        appguard::AppGuardHttpRequest request,
+        appguard::AppGuardHttpResponse response,
+        PolicyCallback callback);
+
+    /**
+     * @brief Starts handling several HTTP responses as one call without waiting for the reply.
+     *
+     * The verdicts are cached under their requests once the reply arrives. With the decision
+     * stream every response is sent on the stream instead, and the callback runs once all are answered.
+     *
+     * @param requests The HTTP requests the responses belong to.
+     * @param responses The HTTP response details to be handled, one per request.
+     * @param callback Invoked once every verdict is known, or the call failed.
+     */
+    void HandleHttpResponseBatchAsync(
+        std::vector<appguard::AppGuardHttpRequest> requests,
+        std::vector<appguard::AppGuardHttpResponse> responses,
+        PoliciesCallback callback);
+
 private:
+    using TcpConnectionBatcher = AppGuardBatcher<appguard::AppGuardTcpConnection, appguard::AppGuardTcpResponse>;
+    using HttpRequestBatcher = AppGuardBatcher<appguard::AppGuardHttpRequest, appguard::AppGuardResponse>;
+
     /**
      * @brief Private constructor used by CreateClient to initialize the wrapper.
      *
-     * @param channel The gRPC channel to communicate with the AppGuard service.
-     * @param installation_code Installation code.
+     * Starts the batchers if `client_info` enables batching.
+     *
+     * @param channels The gRPC channels to communicate with the AppGuard service.
+     * @param client_info Configuration of the client.
      */
-    AppGuardWrapper(std::shared_ptr<grpc::Channel> channel, const std::string &installation_code);
+    AppGuardWrapper(std::shared_ptr<AppGuardChannelPool> channels, const AppGaurdClientInfo &client_info);
+
+    /**
+     * @brief Computes the deadline of a call starting now.
+     *
+     * @return The deadline, or `time_point::max()` if calls are unbounded.
+     */
+    std::chrono::system_clock::time_point CallDeadline() const;
 
     /**
      * @brief Retrieves the current authentication token.
      *
-     * @return The current token as a string.
+     * @param stream The stream providing the token.
+     * @param deadline Gives up waiting for the token past this point.
+     * @param wait Waits for the token if there is none yet, instead of failing at once.
+     * @return The current token, valid for the duration of a call, or the error.
+     */
+    static AppGuardResult<AppGuardStream::Token> AcquireToken(AppGuardStream &stream, std::chrono::system_clock::time_point deadline, bool wait);
+
+    /**
+     * @brief Starts a call once the token is available, without blocking.
+     *
+     * `start` receives the token, inline if there is one. Without one, it receives nullptr at
+     * once, or, with `queue_before_token`, the token once it arrives on a stream thread. It
+     * receives nullptr as well once the control stream has stopped.
+     *
+     * @param deadline The deadline returned by `CallDeadline`.
+     * @param start Starts the call.
+     */
+    template <typename Start>
+    void WithToken(std::chrono::system_clock::time_point deadline, Start start);
+
+    /**
+     * @brief Bounds the wait for a token to the call deadline, and to 5 seconds.
+     */
+    static std::chrono::system_clock::time_point TokenDeadline(std::chrono::system_clock::time_point deadline);
+
+    /**
+     * @brief Makes a decision over the decision stream and waits for the verdict.
+     *
+     * @param request The decision to make.
+     * @param deadline The deadline returned by `CallDeadline`.
+     * @return The verdict, or the error.
+     */
+    AppGuardResult<appguard::AppGuardDecisionResponse> Decide(
+        appguard::AppGuardDecisionRequest request,
+        std::chrono::system_clock::time_point deadline);
+
+    /**
+     * @brief Indicates whether calls should be sent over the decision stream.
+     */
+    inline bool UseDecisionStream() const { return this->decisions && this->decisions->Connected(); }
+
+    /**
+     * @brief Applies the call deadline to a client context, if any.
+     *
+     * @param context The context of the call.
+     * @param deadline The deadline returned by `CallDeadline`.
      */
-    std::string AcquireToken() const;
+    static void ApplyDeadline(grpc::ClientContext &context, std::chrono::system_clock::time_point deadline);
 
-    // gRPC channel for communication.
-    std::shared_ptr<grpc::Channel> channel;
+    // gRPC channels for communication, with their stubs.
+    std::shared_ptr<AppGuardChannelPool> channels;
+    // Waits for the first token instead of failing the calls made before it.
+    bool queue_before_token = false;
     // Stream handling continuous communication with AppGuard.
     std::shared_ptr<AppGuardStream> stream;
+    // Latency budget of a call; zero defers to the server default.
+    std::chrono::milliseconds timeout{0};
+    // Stream multiplexing the decisions, or nullptr if it is disabled.
+    std::shared_ptr<AppGuardDecisionStream> decisions;
+    // Coalesces TCP connection calls, or nullptr if batching is disabled.
+    std::shared_ptr<TcpConnectionBatcher> tcp_batcher;
+    // Coalesces HTTP request calls, or nullptr if batching is disabled.
+    std::shared_ptr<HttpRequestBatcher> http_batcher;
 };
@@ -27,6 +27,10 @@ static const char* AppGuard_method_names[] = {
   "/appguard.AppGuard/HandleTcpConnection",
   "/appguard.AppGuard/HandleHttpRequest",
   "/appguard.AppGuard/HandleHttpResponse",
+  "/appguard.AppGuard/DecisionStream",
+  "/appguard.AppGuard/HandleTcpConnectionBatch",
+  "/appguard.AppGuard/HandleHttpRequestBatch",
+  "/appguard.AppGuard/HandleHttpResponseBatch",
   "/appguard.AppGuard/HandleSmtpRequest",
   "/appguard.AppGuard/HandleSmtpResponse",
   "/appguard.AppGuard/FirewallDefaultsRequest",
@@ -44,9 +48,13 @@ AppGuard::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel)
   , rpcmethod_HandleTcpConnection_(AppGuard_method_names[2], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_HandleHttpRequest_(AppGuard_method_names[3], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_HandleHttpResponse_(AppGuard_method_names[4], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_HandleSmtpRequest_(AppGuard_method_names[5], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_HandleSmtpResponse_(AppGuard_method_names[6], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_FirewallDefaultsRequest_(AppGuard_method_names[7], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_DecisionStream_(AppGuard_method_names[5], ::grpc::internal::RpcMethod::BIDI_STREAMING, channel)
+  , rpcmethod_HandleTcpConnectionBatch_(AppGuard_method_names[6], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_HandleHttpRequestBatch_(AppGuard_method_names[7], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_HandleHttpResponseBatch_(AppGuard_method_names[8], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_HandleSmtpRequest_(AppGuard_method_names[9], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_HandleSmtpResponse_(AppGuard_method_names[10], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_FirewallDefaultsRequest_(AppGuard_method_names[11], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::ClientReaderWriter< ::appguard_commands::ClientMessage, ::appguard_commands::ServerMessage>* AppGuard::Stub::ControlChannelRaw(::grpc::ClientContext* context) {
@@ -177,6 +185,106 @@ void AppGuard::Stub::experimental_async::HandleHttpResponse(::grpc::ClientContex
   return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::appguard::AppGuardResponse>::Create(channel_.get(), cq, rpcmethod_HandleHttpResponse_, context, request, false);
 }
 
+::grpc::ClientReaderWriter< ::appguard::AppGuardDecisionRequest, ::appguard::AppGuardDecisionResponse>* AppGuard::Stub::DecisionStreamRaw(::grpc::ClientContext* context) {
+  return ::grpc_impl::internal::ClientReaderWriterFactory< ::appguard::AppGuardDecisionRequest, ::appguard::AppGuardDecisionResponse>::Create(channel_.get(), rpcmethod_DecisionStream_, context);
+}
+
+void AppGuard::Stub::experimental_async::DecisionStream(::grpc::ClientContext* context, ::grpc::experimental::ClientBidiReactor< ::appguard::AppGuardDecisionRequest,::appguard::AppGuardDecisionResponse>* reactor) {
+  ::grpc_impl::internal::ClientCallbackReaderWriterFactory< ::appguard::AppGuardDecisionRequest,::appguard::AppGuardDecisionResponse>::Create(stub_->channel_.get(), stub_->rpcmethod_DecisionStream_, context, reactor);
+}
+
+::grpc::ClientAsyncReaderWriter< ::appguard::AppGuardDecisionRequest, ::appguard::AppGuardDecisionResponse>* AppGuard::Stub::AsyncDecisionStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc_impl::internal::ClientAsyncReaderWriterFactory< ::appguard::AppGuardDecisionRequest, ::appguard::AppGuardDecisionResponse>::Create(channel_.get(), cq, rpcmethod_DecisionStream_, context, true, tag);
+}
+
+::grpc::ClientAsyncReaderWriter< ::appguard::AppGuardDecisionRequest, ::appguard::AppGuardDecisionResponse>* AppGuard::Stub::PrepareAsyncDecisionStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+  return ::grpc_impl::internal::ClientAsyncReaderWriterFactory< ::appguard::AppGuardDecisionRequest, ::appguard::AppGuardDecisionResponse>::Create(channel_.get(), cq, rpcmethod_DecisionStream_, context, false, nullptr);
+}
+
+::grpc::Status AppGuard::Stub::HandleTcpConnectionBatch(::grpc::ClientContext* context, const ::appguard::AppGuardTcpConnectionBatch& request, ::appguard::AppGuardTcpResponseBatch* response) {
+  return ::grpc::internal::BlockingUnaryCall(channel_.get(), rpcmethod_HandleTcpConnectionBatch_, context, request, response);
+}
+
+void AppGuard::Stub::experimental_async::HandleTcpConnectionBatch(::grpc::ClientContext* context, const ::appguard::AppGuardTcpConnectionBatch* request, ::appguard::AppGuardTcpResponseBatch* response, std::function<void(::grpc::Status)> f) {
+  ::grpc_impl::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_HandleTcpConnectionBatch_, context, request, response, std::move(f));
+}
+
+void AppGuard::Stub::experimental_async::HandleTcpConnectionBatch(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::appguard::AppGuardTcpResponseBatch* response, std::function<void(::grpc::Status)> f) {
+  ::grpc_impl::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_HandleTcpConnectionBatch_, context, request, response, std::move(f));
+}
+
+void AppGuard::Stub::experimental_async::HandleTcpConnectionBatch(::grpc::ClientContext* context, const ::appguard::AppGuardTcpConnectionBatch* request, ::appguard::AppGuardTcpResponseBatch* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc_impl::internal::ClientCallbackUnaryFactory::Create(stub_->channel_.get(), stub_->rpcmethod_HandleTcpConnectionBatch_, context, request, response, reactor);
+}
+
+void AppGuard::Stub::experimental_async::HandleTcpConnectionBatch(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::appguard::AppGuardTcpResponseBatch* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc_impl::internal::ClientCallbackUnaryFactory::Create(stub_->channel_.get(), stub_->rpcmethod_HandleTcpConnectionBatch_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::appguard::AppGuardTcpResponseBatch>* AppGuard::Stub::AsyncHandleTcpConnectionBatchRaw(::grpc::ClientContext* context, const ::appguard::AppGuardTcpConnectionBatch& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::appguard::AppGuardTcpResponseBatch>::Create(channel_.get(), cq, rpcmethod_HandleTcpConnectionBatch_, context, request, true);
+}
+
+::grpc::ClientAsyncResponseReader< ::appguard::AppGuardTcpResponseBatch>* AppGuard::Stub::PrepareAsyncHandleTcpConnectionBatchRaw(::grpc::ClientContext* context, const ::appguard::AppGuardTcpConnectionBatch& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::appguard::AppGuardTcpResponseBatch>::Create(channel_.get(), cq, rpcmethod_HandleTcpConnectionBatch_, context, request, false);
+}
+
+::grpc::Status AppGuard::Stub::HandleHttpRequestBatch(::grpc::ClientContext* context, const ::appguard::AppGuardHttpRequestBatch& request, ::appguard::AppGuardResponseBatch* response) {
+  return ::grpc::internal::BlockingUnaryCall(channel_.get(), rpcmethod_HandleHttpRequestBatch_, context, request, response);
+}
+
+void AppGuard::Stub::experimental_async::HandleHttpRequestBatch(::grpc::ClientContext* context, const ::appguard::AppGuardHttpRequestBatch* request, ::appguard::AppGuardResponseBatch* response, std::function<void(::grpc::Status)> f) {
+  ::grpc_impl::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_HandleHttpRequestBatch_, context, request, response, std::move(f));
+}
+
+void AppGuard::Stub::experimental_async::HandleHttpRequestBatch(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::appguard::AppGuardResponseBatch* response, std::function<void(::grpc::Status)> f) {
+  ::grpc_impl::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_HandleHttpRequestBatch_, context, request, response, std::move(f));
+}
+
+void AppGuard::Stub::experimental_async::HandleHttpRequestBatch(::grpc::ClientContext* context, const ::appguard::AppGuardHttpRequestBatch* request, ::appguard::AppGuardResponseBatch* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc_impl::internal::ClientCallbackUnaryFactory::Create(stub_->channel_.get(), stub_->rpcmethod_HandleHttpRequestBatch_, context, request, response, reactor);
+}
+
+void AppGuard::Stub::experimental_async::HandleHttpRequestBatch(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::appguard::AppGuardResponseBatch* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc_impl::internal::ClientCallbackUnaryFactory::Create(stub_->channel_.get(), stub_->rpcmethod_HandleHttpRequestBatch_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::appguard::AppGuardResponseBatch>* AppGuard::Stub::AsyncHandleHttpRequestBatchRaw(::grpc::ClientContext* context, const ::appguard::AppGuardHttpRequestBatch& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::appguard::AppGuardResponseBatch>::Create(channel_.get(), cq, rpcmethod_HandleHttpRequestBatch_, context, request, true);
+}
+
+::grpc::ClientAsyncResponseReader< ::appguard::AppGuardResponseBatch>* AppGuard::Stub::PrepareAsyncHandleHttpRequestBatchRaw(::grpc::ClientContext* context, const ::appguard::AppGuardHttpRequestBatch& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::appguard::AppGuardResponseBatch>::Create(channel_.get(), cq, rpcmethod_HandleHttpRequestBatch_, context, request, false);
+}
+
+::grpc::Status AppGuard::Stub::HandleHttpResponseBatch(::grpc::ClientContext* context, const ::appguard::AppGuardHttpResponseBatch& request, ::appguard::AppGuardResponseBatch* response) {
+  return ::grpc::internal::BlockingUnaryCall(channel_.get(), rpcmethod_HandleHttpResponseBatch_, context, request, response);
+}
+
+void AppGuard::Stub::experimental_async::HandleHttpResponseBatch(::grpc::ClientContext* context, const ::appguard::AppGuardHttpResponseBatch* request, ::appguard::AppGuardResponseBatch* response, std::function<void(::grpc::Status)> f) {
+  ::grpc_impl::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_HandleHttpResponseBatch_, context, request, response, std::move(f));
+}
+
+void AppGuard::Stub::experimental_async::HandleHttpResponseBatch(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::appguard::AppGuardResponseBatch* response, std::function<void(::grpc::Status)> f) {
+  ::grpc_impl::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_HandleHttpResponseBatch_, context, request, response, std::move(f));
+}
+
+void AppGuard::Stub::experimental_async::HandleHttpResponseBatch(::grpc::ClientContext* context, const ::appguard::AppGuardHttpResponseBatch* request, ::appguard::AppGuardResponseBatch* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc_impl::internal::ClientCallbackUnaryFactory::Create(stub_->channel_.get(), stub_->rpcmethod_HandleHttpResponseBatch_, context, request, response, reactor);
+}
+
+void AppGuard::Stub::experimental_async::HandleHttpResponseBatch(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::appguard::AppGuardResponseBatch* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc_impl::internal::ClientCallbackUnaryFactory::Create(stub_->channel_.get(), stub_->rpcmethod_HandleHttpResponseBatch_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::appguard::AppGuardResponseBatch>* AppGuard::Stub::AsyncHandleHttpResponseBatchRaw(::grpc::ClientContext* context, const ::appguard::AppGuardHttpResponseBatch& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::appguard::AppGuardResponseBatch>::Create(channel_.get(), cq, rpcmethod_HandleHttpResponseBatch_, context, request, true);
+}
+
+::grpc::ClientAsyncResponseReader< ::appguard::AppGuardResponseBatch>* AppGuard::Stub::PrepareAsyncHandleHttpResponseBatchRaw(::grpc::ClientContext* context, const ::appguard::AppGuardHttpResponseBatch& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::appguard::AppGuardResponseBatch>::Create(channel_.get(), cq, rpcmethod_HandleHttpResponseBatch_, context, request, false);
+}
+
 ::grpc::Status AppGuard::Stub::HandleSmtpRequest(::grpc::ClientContext* context, const ::appguard::AppGuardSmtpRequest& request, ::appguard::AppGuardResponse* response) {
   return ::grpc::internal::BlockingUnaryCall(channel_.get(), rpcmethod_HandleSmtpRequest_, context, request, response);
 }
@@ -314,6 +422,46 @@ AppGuard::Service::Service() {
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       AppGuard_method_names[5],
+      ::grpc::internal::RpcMethod::BIDI_STREAMING,
+      new ::grpc::internal::BidiStreamingHandler< AppGuard::Service, ::appguard::AppGuardDecisionRequest, ::appguard::AppGuardDecisionResponse>(
+          [](AppGuard::Service* service,
+             ::grpc_impl::ServerContext* ctx,
+             ::grpc_impl::ServerReaderWriter<::appguard::AppGuardDecisionResponse,
+             ::appguard::AppGuardDecisionRequest>* stream) {
+               return service->DecisionStream(ctx, stream);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      AppGuard_method_names[6],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< AppGuard::Service, ::appguard::AppGuardTcpConnectionBatch, ::appguard::AppGuardTcpResponseBatch>(
+          [](AppGuard::Service* service,
+             ::grpc_impl::ServerContext* ctx,
+             const ::appguard::AppGuardTcpConnectionBatch* req,
+             ::appguard::AppGuardTcpResponseBatch* resp) {
+               return service->HandleTcpConnectionBatch(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      AppGuard_method_names[7],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< AppGuard::Service, ::appguard::AppGuardHttpRequestBatch, ::appguard::AppGuardResponseBatch>(
+          [](AppGuard::Service* service,
+             ::grpc_impl::ServerContext* ctx,
+             const ::appguard::AppGuardHttpRequestBatch* req,
+             ::appguard::AppGuardResponseBatch* resp) {
+               return service->HandleHttpRequestBatch(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      AppGuard_method_names[8],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< AppGuard::Service, ::appguard::AppGuardHttpResponseBatch, ::appguard::AppGuardResponseBatch>(
+          [](AppGuard::Service* service,
+             ::grpc_impl::ServerContext* ctx,
+             const ::appguard::AppGuardHttpResponseBatch* req,
+             ::appguard::AppGuardResponseBatch* resp) {
+               return service->HandleHttpResponseBatch(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      AppGuard_method_names[9],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< AppGuard::Service, ::appguard::AppGuardSmtpRequest, ::appguard::AppGuardResponse>(
           [](AppGuard::Service* service,
@@ -323,7 +471,7 @@ AppGuard::Service::Service() {
                return service->HandleSmtpRequest(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      AppGuard_method_names[6],
+      AppGuard_method_names[10],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< AppGuard::Service, ::appguard::AppGuardSmtpResponse, ::appguard::AppGuardResponse>(
           [](AppGuard::Service* service,
@@ -333,7 +481,7 @@ AppGuard::Service::Service() {
                return service->HandleSmtpResponse(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      AppGuard_method_names[7],
+      AppGuard_method_names[11],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< AppGuard::Service, ::appguard::Token, ::appguard_commands::FirewallDefaults>(
           [](AppGuard::Service* service,
@@ -381,6 +529,33 @@ AppGuard::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status AppGuard::Service::DecisionStream(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::appguard::AppGuardDecisionResponse, ::appguard::AppGuardDecisionRequest>* stream) {
+  (void) context;
+  (void) stream;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status AppGuard::Service::HandleTcpConnectionBatch(::grpc::ServerContext* context, const ::appguard::AppGuardTcpConnectionBatch* request, ::appguard::AppGuardTcpResponseBatch* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status AppGuard::Service::HandleHttpRequestBatch(::grpc::ServerContext* context, const ::appguard::AppGuardHttpRequestBatch* request, ::appguard::AppGuardResponseBatch* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status AppGuard::Service::HandleHttpResponseBatch(::grpc::ServerContext* context, const ::appguard::AppGuardHttpResponseBatch* request, ::appguard::AppGuardResponseBatch* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 ::grpc::Status AppGuard::Service::HandleSmtpRequest(::grpc::ServerContext* context, const ::appguard::AppGuardSmtpRequest* request, ::appguard::AppGuardResponse* response) {
   (void) context;
   (void) request;
@@ -77,6 +77,38 @@ class AppGuard final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::appguard::AppGuardResponse>> PrepareAsyncHandleHttpResponse(::grpc::ClientContext* context, const ::appguard::AppGuardHttpResponse& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::appguard::AppGuardResponse>>(PrepareAsyncHandleHttpResponseRaw(context, request, cq));
     }
+    // Decisions multiplexed over a single stream
+    std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::appguard::AppGuardDecisionRequest, ::appguard::AppGuardDecisionResponse>> DecisionStream(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::appguard::AppGuardDecisionRequest, ::appguard::AppGuardDecisionResponse>>(DecisionStreamRaw(context));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::appguard::AppGuardDecisionRequest, ::appguard::AppGuardDecisionResponse>> AsyncDecisionStream(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::appguard::AppGuardDecisionRequest, ::appguard::AppGuardDecisionResponse>>(AsyncDecisionStreamRaw(context, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::appguard::AppGuardDecisionRequest, ::appguard::AppGuardDecisionResponse>> PrepareAsyncDecisionStream(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::appguard::AppGuardDecisionRequest, ::appguard::AppGuardDecisionResponse>>(PrepareAsyncDecisionStreamRaw(context, cq));
+    }
+    // Batches
+    virtual ::grpc::Status HandleTcpConnectionBatch(::grpc::ClientContext* context, const ::appguard::AppGuardTcpConnectionBatch& request, ::appguard::AppGuardTcpResponseBatch* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::appguard::AppGuardTcpResponseBatch>> AsyncHandleTcpConnectionBatch(::grpc::ClientContext* context, const ::appguard::AppGuardTcpConnectionBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::appguard::AppGuardTcpResponseBatch>>(AsyncHandleTcpConnectionBatchRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::appguard::AppGuardTcpResponseBatch>> PrepareAsyncHandleTcpConnectionBatch(::grpc::ClientContext* context, const ::appguard::AppGuardTcpConnectionBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::appguard::AppGuardTcpResponseBatch>>(PrepareAsyncHandleTcpConnectionBatchRaw(context, request, cq));
+    }
+    virtual ::grpc::Status HandleHttpRequestBatch(::grpc::ClientContext* context, const ::appguard::AppGuardHttpRequestBatch& request, ::appguard::AppGuardResponseBatch* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::appguard::AppGuardResponseBatch>> AsyncHandleHttpRequestBatch(::grpc::ClientContext* context, const ::appguard::AppGuardHttpRequestBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::appguard::AppGuardResponseBatch>>(AsyncHandleHttpRequestBatchRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::appguard::AppGuardResponseBatch>> PrepareAsyncHandleHttpRequestBatch(::grpc::ClientContext* context, const ::appguard::AppGuardHttpRequestBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::appguard::AppGuardResponseBatch>>(PrepareAsyncHandleHttpRequestBatchRaw(context, request, cq));
+    }
+    virtual ::grpc::Status HandleHttpResponseBatch(::grpc::ClientContext* context, const ::appguard::AppGuardHttpResponseBatch& request, ::appguard::AppGuardResponseBatch* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::appguard::AppGuardResponseBatch>> AsyncHandleHttpResponseBatch(::grpc::ClientContext* context, const ::appguard::AppGuardHttpResponseBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::appguard::AppGuardResponseBatch>>(AsyncHandleHttpResponseBatchRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::appguard::AppGuardResponseBatch>> PrepareAsyncHandleHttpResponseBatch(::grpc::ClientContext* context, const ::appguard::AppGuardHttpResponseBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::appguard::AppGuardResponseBatch>>(PrepareAsyncHandleHttpResponseBatchRaw(context, request, cq));
+    }
     // SMTP
     virtual ::grpc::Status HandleSmtpRequest(::grpc::ClientContext* context, const ::appguard::AppGuardSmtpRequest& request, ::appguard::AppGuardResponse* response) = 0;
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::appguard::AppGuardResponse>> AsyncHandleSmtpRequest(::grpc::ClientContext* context, const ::appguard::AppGuardSmtpRequest& request, ::grpc::CompletionQueue* cq) {
@@ -160,6 +192,49 @@ class AppGuard final {
       #else
       virtual void HandleHttpResponse(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::appguard::AppGuardResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
       #endif
+      // Decisions multiplexed over a single stream
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      virtual void DecisionStream(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::appguard::AppGuardDecisionRequest,::appguard::AppGuardDecisionResponse>* reactor) = 0;
+      #else
+      virtual void DecisionStream(::grpc::ClientContext* context, ::grpc::experimental::ClientBidiReactor< ::appguard::AppGuardDecisionRequest,::appguard::AppGuardDecisionResponse>* reactor) = 0;
+      #endif
+      // Batches
+      virtual void HandleTcpConnectionBatch(::grpc::ClientContext* context, const ::appguard::AppGuardTcpConnectionBatch* request, ::appguard::AppGuardTcpResponseBatch* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void HandleTcpConnectionBatch(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::appguard::AppGuardTcpResponseBatch* response, std::function<void(::grpc::Status)>) = 0;
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      virtual void HandleTcpConnectionBatch(::grpc::ClientContext* context, const ::appguard::AppGuardTcpConnectionBatch* request, ::appguard::AppGuardTcpResponseBatch* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      #else
+      virtual void HandleTcpConnectionBatch(::grpc::ClientContext* context, const ::appguard::AppGuardTcpConnectionBatch* request, ::appguard::AppGuardTcpResponseBatch* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
+      #endif
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      virtual void HandleTcpConnectionBatch(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::appguard::AppGuardTcpResponseBatch* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      #else
+      virtual void HandleTcpConnectionBatch(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::appguard::AppGuardTcpResponseBatch* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
+      #endif
+      virtual void HandleHttpRequestBatch(::grpc::ClientContext* context, const ::appguard::AppGuardHttpRequestBatch* request, ::appguard::AppGuardResponseBatch* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void HandleHttpRequestBatch(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::appguard::AppGuardResponseBatch* response, std::function<void(::grpc::Status)>) = 0;
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      virtual void HandleHttpRequestBatch(::grpc::ClientContext* context, const ::appguard::AppGuardHttpRequestBatch* request, ::appguard::AppGuardResponseBatch* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      #else
+      virtual void HandleHttpRequestBatch(::grpc::ClientContext* context, const ::appguard::AppGuardHttpRequestBatch* request, ::appguard::AppGuardResponseBatch* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
+      #endif
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      virtual void HandleHttpRequestBatch(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::appguard::AppGuardResponseBatch* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      #else
+      virtual void HandleHttpRequestBatch(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::appguard::AppGuardResponseBatch* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
+      #endif
+      virtual void HandleHttpResponseBatch(::grpc::ClientContext* context, const ::appguard::AppGuardHttpResponseBatch* request, ::appguard::AppGuardResponseBatch* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void HandleHttpResponseBatch(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::appguard::AppGuardResponseBatch* response, std::function<void(::grpc::Status)>) = 0;
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      virtual void HandleHttpResponseBatch(::grpc::ClientContext* context, const ::appguard::AppGuardHttpResponseBatch* request, ::appguard::AppGuardResponseBatch* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      #else
+      virtual void HandleHttpResponseBatch(::grpc::ClientContext* context, const ::appguard::AppGuardHttpResponseBatch* request, ::appguard::AppGuardResponseBatch* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
+      #endif
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      virtual void HandleHttpResponseBatch(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::appguard::AppGuardResponseBatch* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      #else
+      virtual void HandleHttpResponseBatch(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::appguard::AppGuardResponseBatch* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
+      #endif
       // SMTP
       virtual void HandleSmtpRequest(::grpc::ClientContext* context, const ::appguard::AppGuardSmtpRequest* request, ::appguard::AppGuardResponse* response, std::function<void(::grpc::Status)>) = 0;
       virtual void HandleSmtpRequest(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::appguard::AppGuardResponse* response, std::function<void(::grpc::Status)>) = 0;
@@ -218,6 +293,15 @@ class AppGuard final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::appguard::AppGuardResponse>* PrepareAsyncHandleHttpRequestRaw(::grpc::ClientContext* context, const ::appguard::AppGuardHttpRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::appguard::AppGuardResponse>* AsyncHandleHttpResponseRaw(::grpc::ClientContext* context, const ::appguard::AppGuardHttpResponse& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::appguard::AppGuardResponse>* PrepareAsyncHandleHttpResponseRaw(::grpc::ClientContext* context, const ::appguard::AppGuardHttpResponse& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderWriterInterface< ::appguard::AppGuardDecisionRequest, ::appguard::AppGuardDecisionResponse>* DecisionStreamRaw(::grpc::ClientContext* context) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::appguard::AppGuardDecisionRequest, ::appguard::AppGuardDecisionResponse>* AsyncDecisionStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::appguard::AppGuardDecisionRequest, ::appguard::AppGuardDecisionResponse>* PrepareAsyncDecisionStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::appguard::AppGuardTcpResponseBatch>* AsyncHandleTcpConnectionBatchRaw(::grpc::ClientContext* context, const ::appguard::AppGuardTcpConnectionBatch& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::appguard::AppGuardTcpResponseBatch>* PrepareAsyncHandleTcpConnectionBatchRaw(::grpc::ClientContext* context, const ::appguard::AppGuardTcpConnectionBatch& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::appguard::AppGuardResponseBatch>* AsyncHandleHttpRequestBatchRaw(::grpc::ClientContext* context, const ::appguard::AppGuardHttpRequestBatch& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::appguard::AppGuardResponseBatch>* PrepareAsyncHandleHttpRequestBatchRaw(::grpc::ClientContext* context, const ::appguard::AppGuardHttpRequestBatch& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::appguard::AppGuardResponseBatch>* AsyncHandleHttpResponseBatchRaw(::grpc::ClientContext* context, const ::appguard::AppGuardHttpResponseBatch& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::appguard::AppGuardResponseBatch>* PrepareAsyncHandleHttpResponseBatchRaw(::grpc::ClientContext* context, const ::appguard::AppGuardHttpResponseBatch& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::appguard::AppGuardResponse>* AsyncHandleSmtpRequestRaw(::grpc::ClientContext* context, const ::appguard::AppGuardSmtpRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::appguard::AppGuardResponse>* PrepareAsyncHandleSmtpRequestRaw(::grpc::ClientContext* context, const ::appguard::AppGuardSmtpRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::appguard::AppGuardResponse>* AsyncHandleSmtpResponseRaw(::grpc::ClientContext* context, const ::appguard::AppGuardSmtpResponse& request, ::grpc::CompletionQueue* cq) = 0;
@@ -265,6 +349,36 @@ class AppGuard final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::appguard::AppGuardResponse>> PrepareAsyncHandleHttpResponse(::grpc::ClientContext* context, const ::appguard::AppGuardHttpResponse& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::appguard::AppGuardResponse>>(PrepareAsyncHandleHttpResponseRaw(context, request, cq));
     }
+    std::unique_ptr< ::grpc::ClientReaderWriter< ::appguard::AppGuardDecisionRequest, ::appguard::AppGuardDecisionResponse>> DecisionStream(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriter< ::appguard::AppGuardDecisionRequest, ::appguard::AppGuardDecisionResponse>>(DecisionStreamRaw(context));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::appguard::AppGuardDecisionRequest, ::appguard::AppGuardDecisionResponse>> AsyncDecisionStream(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::appguard::AppGuardDecisionRequest, ::appguard::AppGuardDecisionResponse>>(AsyncDecisionStreamRaw(context, cq, tag));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::appguard::AppGuardDecisionRequest, ::appguard::AppGuardDecisionResponse>> PrepareAsyncDecisionStream(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::appguard::AppGuardDecisionRequest, ::appguard::AppGuardDecisionResponse>>(PrepareAsyncDecisionStreamRaw(context, cq));
+    }
+    ::grpc::Status HandleTcpConnectionBatch(::grpc::ClientContext* context, const ::appguard::AppGuardTcpConnectionBatch& request, ::appguard::AppGuardTcpResponseBatch* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::appguard::AppGuardTcpResponseBatch>> AsyncHandleTcpConnectionBatch(::grpc::ClientContext* context, const ::appguard::AppGuardTcpConnectionBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::appguard::AppGuardTcpResponseBatch>>(AsyncHandleTcpConnectionBatchRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::appguard::AppGuardTcpResponseBatch>> PrepareAsyncHandleTcpConnectionBatch(::grpc::ClientContext* context, const ::appguard::AppGuardTcpConnectionBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::appguard::AppGuardTcpResponseBatch>>(PrepareAsyncHandleTcpConnectionBatchRaw(context, request, cq));
+    }
+    ::grpc::Status HandleHttpRequestBatch(::grpc::ClientContext* context, const ::appguard::AppGuardHttpRequestBatch& request, ::appguard::AppGuardResponseBatch* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::appguard::AppGuardResponseBatch>> AsyncHandleHttpRequestBatch(::grpc::ClientContext* context, const ::appguard::AppGuardHttpRequestBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::appguard::AppGuardResponseBatch>>(AsyncHandleHttpRequestBatchRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::appguard::AppGuardResponseBatch>> PrepareAsyncHandleHttpRequestBatch(::grpc::ClientContext* context, const ::appguard::AppGuardHttpRequestBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::appguard::AppGuardResponseBatch>>(PrepareAsyncHandleHttpRequestBatchRaw(context, request, cq));
+    }
+    ::grpc::Status HandleHttpResponseBatch(::grpc::ClientContext* context, const ::appguard::AppGuardHttpResponseBatch& request, ::appguard::AppGuardResponseBatch* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::appguard::AppGuardResponseBatch>> AsyncHandleHttpResponseBatch(::grpc::ClientContext* context, const ::appguard::AppGuardHttpResponseBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::appguard::AppGuardResponseBatch>>(AsyncHandleHttpResponseBatchRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::appguard::AppGuardResponseBatch>> PrepareAsyncHandleHttpResponseBatch(::grpc::ClientContext* context, const ::appguard::AppGuardHttpResponseBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::appguard::AppGuardResponseBatch>>(PrepareAsyncHandleHttpResponseBatchRaw(context, request, cq));
+    }
     ::grpc::Status HandleSmtpRequest(::grpc::ClientContext* context, const ::appguard::AppGuardSmtpRequest& request, ::appguard::AppGuardResponse* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::appguard::AppGuardResponse>> AsyncHandleSmtpRequest(::grpc::ClientContext* context, const ::appguard::AppGuardSmtpRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::appguard::AppGuardResponse>>(AsyncHandleSmtpRequestRaw(context, request, cq));
@@ -342,6 +456,47 @@ class AppGuard final {
       #else
       void HandleHttpResponse(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::appguard::AppGuardResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
       #endif
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      void DecisionStream(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::appguard::AppGuardDecisionRequest,::appguard::AppGuardDecisionResponse>* reactor) override;
+      #else
+      void DecisionStream(::grpc::ClientContext* context, ::grpc::experimental::ClientBidiReactor< ::appguard::AppGuardDecisionRequest,::appguard::AppGuardDecisionResponse>* reactor) override;
+      #endif
+      void HandleTcpConnectionBatch(::grpc::ClientContext* context, const ::appguard::AppGuardTcpConnectionBatch* request, ::appguard::AppGuardTcpResponseBatch* response, std::function<void(::grpc::Status)>) override;
+      void HandleTcpConnectionBatch(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::appguard::AppGuardTcpResponseBatch* response, std::function<void(::grpc::Status)>) override;
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      void HandleTcpConnectionBatch(::grpc::ClientContext* context, const ::appguard::AppGuardTcpConnectionBatch* request, ::appguard::AppGuardTcpResponseBatch* response, ::grpc::ClientUnaryReactor* reactor) override;
+      #else
+      void HandleTcpConnectionBatch(::grpc::ClientContext* context, const ::appguard::AppGuardTcpConnectionBatch* request, ::appguard::AppGuardTcpResponseBatch* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
+      #endif
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      void HandleTcpConnectionBatch(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::appguard::AppGuardTcpResponseBatch* response, ::grpc::ClientUnaryReactor* reactor) override;
+      #else
+      void HandleTcpConnectionBatch(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::appguard::AppGuardTcpResponseBatch* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
+      #endif
+      void HandleHttpRequestBatch(::grpc::ClientContext* context, const ::appguard::AppGuardHttpRequestBatch* request, ::appguard::AppGuardResponseBatch* response, std::function<void(::grpc::Status)>) override;
+      void HandleHttpRequestBatch(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::appguard::AppGuardResponseBatch* response, std::function<void(::grpc::Status)>) override;
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      void HandleHttpRequestBatch(::grpc::ClientContext* context, const ::appguard::AppGuardHttpRequestBatch* request, ::appguard::AppGuardResponseBatch* response, ::grpc::ClientUnaryReactor* reactor) override;
+      #else
+      void HandleHttpRequestBatch(::grpc::ClientContext* context, const ::appguard::AppGuardHttpRequestBatch* request, ::appguard::AppGuardResponseBatch* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
+      #endif
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      void HandleHttpRequestBatch(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::appguard::AppGuardResponseBatch* response, ::grpc::ClientUnaryReactor* reactor) override;
+      #else
+      void HandleHttpRequestBatch(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::appguard::AppGuardResponseBatch* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
+      #endif
+      void HandleHttpResponseBatch(::grpc::ClientContext* context, const ::appguard::AppGuardHttpResponseBatch* request, ::appguard::AppGuardResponseBatch* response, std::function<void(::grpc::Status)>) override;
+      void HandleHttpResponseBatch(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::appguard::AppGuardResponseBatch* response, std::function<void(::grpc::Status)>) override;
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      void HandleHttpResponseBatch(::grpc::ClientContext* context, const ::appguard::AppGuardHttpResponseBatch* request, ::appguard::AppGuardResponseBatch* response, ::grpc::ClientUnaryReactor* reactor) override;
+      #else
+      void HandleHttpResponseBatch(::grpc::ClientContext* context, const ::appguard::AppGuardHttpResponseBatch* request, ::appguard::AppGuardResponseBatch* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
+      #endif
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      void HandleHttpResponseBatch(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::appguard::AppGuardResponseBatch* response, ::grpc::ClientUnaryReactor* reactor) override;
+      #else
+      void HandleHttpResponseBatch(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::appguard::AppGuardResponseBatch* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
+      #endif
       void HandleSmtpRequest(::grpc::ClientContext* context, const ::appguard::AppGuardSmtpRequest* request, ::appguard::AppGuardResponse* response, std::function<void(::grpc::Status)>) override;
       void HandleSmtpRequest(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::appguard::AppGuardResponse* response, std::function<void(::grpc::Status)>) override;
       #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
@@ -400,6 +555,15 @@ class AppGuard final {
     ::grpc::ClientAsyncResponseReader< ::appguard::AppGuardResponse>* PrepareAsyncHandleHttpRequestRaw(::grpc::ClientContext* context, const ::appguard::AppGuardHttpRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::appguard::AppGuardResponse>* AsyncHandleHttpResponseRaw(::grpc::ClientContext* context, const ::appguard::AppGuardHttpResponse& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::appguard::AppGuardResponse>* PrepareAsyncHandleHttpResponseRaw(::grpc::ClientContext* context, const ::appguard::AppGuardHttpResponse& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReaderWriter< ::appguard::AppGuardDecisionRequest, ::appguard::AppGuardDecisionResponse>* DecisionStreamRaw(::grpc::ClientContext* context) override;
+    ::grpc::ClientAsyncReaderWriter< ::appguard::AppGuardDecisionRequest, ::appguard::AppGuardDecisionResponse>* AsyncDecisionStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReaderWriter< ::appguard::AppGuardDecisionRequest, ::appguard::AppGuardDecisionResponse>* PrepareAsyncDecisionStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::appguard::AppGuardTcpResponseBatch>* AsyncHandleTcpConnectionBatchRaw(::grpc::ClientContext* context, const ::appguard::AppGuardTcpConnectionBatch& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::appguard::AppGuardTcpResponseBatch>* PrepareAsyncHandleTcpConnectionBatchRaw(::grpc::ClientContext* context, const ::appguard::AppGuardTcpConnectionBatch& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::appguard::AppGuardResponseBatch>* AsyncHandleHttpRequestBatchRaw(::grpc::ClientContext* context, const ::appguard::AppGuardHttpRequestBatch& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::appguard::AppGuardResponseBatch>* PrepareAsyncHandleHttpRequestBatchRaw(::grpc::ClientContext* context, const ::appguard::AppGuardHttpRequestBatch& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::appguard::AppGuardResponseBatch>* AsyncHandleHttpResponseBatchRaw(::grpc::ClientContext* context, const ::appguard::AppGuardHttpResponseBatch& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::appguard::AppGuardResponseBatch>* PrepareAsyncHandleHttpResponseBatchRaw(::grpc::ClientContext* context, const ::appguard::AppGuardHttpResponseBatch& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::appguard::AppGuardResponse>* AsyncHandleSmtpRequestRaw(::grpc::ClientContext* context, const ::appguard::AppGuardSmtpRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::appguard::AppGuardResponse>* PrepareAsyncHandleSmtpRequestRaw(::grpc::ClientContext* context, const ::appguard::AppGuardSmtpRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::appguard::AppGuardResponse>* AsyncHandleSmtpResponseRaw(::grpc::ClientContext* context, const ::appguard::AppGuardSmtpResponse& request, ::grpc::CompletionQueue* cq) override;
@@ -411,6 +575,10 @@ class AppGuard final {
     const ::grpc::internal::RpcMethod rpcmethod_HandleTcpConnection_;
     const ::grpc::internal::RpcMethod rpcmethod_HandleHttpRequest_;
     const ::grpc::internal::RpcMethod rpcmethod_HandleHttpResponse_;
+    const ::grpc::internal::RpcMethod rpcmethod_DecisionStream_;
+    const ::grpc::internal::RpcMethod rpcmethod_HandleTcpConnectionBatch_;
+    const ::grpc::internal::RpcMethod rpcmethod_HandleHttpRequestBatch_;
+    const ::grpc::internal::RpcMethod rpcmethod_HandleHttpResponseBatch_;
     const ::grpc::internal::RpcMethod rpcmethod_HandleSmtpRequest_;
     const ::grpc::internal::RpcMethod rpcmethod_HandleSmtpResponse_;
     const ::grpc::internal::RpcMethod rpcmethod_FirewallDefaultsRequest_;
@@ -430,6 +598,12 @@ class AppGuard final {
     // HTTP
     virtual ::grpc::Status HandleHttpRequest(::grpc::ServerContext* context, const ::appguard::AppGuardHttpRequest* request, ::appguard::AppGuardResponse* response);
     virtual ::grpc::Status HandleHttpResponse(::grpc::ServerContext* context, const ::appguard::AppGuardHttpResponse* request, ::appguard::AppGuardResponse* response);
+    // Decisions multiplexed over a single stream
+    virtual ::grpc::Status DecisionStream(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::appguard::AppGuardDecisionResponse, ::appguard::AppGuardDecisionRequest>* stream);
+    // Batches
+    virtual ::grpc::Status HandleTcpConnectionBatch(::grpc::ServerContext* context, const ::appguard::AppGuardTcpConnectionBatch* request, ::appguard::AppGuardTcpResponseBatch* response);
+    virtual ::grpc::Status HandleHttpRequestBatch(::grpc::ServerContext* context, const ::appguard::AppGuardHttpRequestBatch* request, ::appguard::AppGuardResponseBatch* response);
+    virtual ::grpc::Status HandleHttpResponseBatch(::grpc::ServerContext* context, const ::appguard::AppGuardHttpResponseBatch* request, ::appguard::AppGuardResponseBatch* response);
     // SMTP
     virtual ::grpc::Status HandleSmtpRequest(::grpc::ServerContext* context, const ::appguard::AppGuardSmtpRequest* request, ::appguard::AppGuardResponse* response);
     virtual ::grpc::Status HandleSmtpResponse(::grpc::ServerContext* context, const ::appguard::AppGuardSmtpResponse* request, ::appguard::AppGuardResponse* response);
@@ -537,12 +711,92 @@ class AppGuard final {
     }
   };
   template <class BaseClass>
+  class WithAsyncMethod_DecisionStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_DecisionStream() {
+      ::grpc::Service::MarkMethodAsync(5);
+    }
+    ~WithAsyncMethod_DecisionStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status DecisionStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::appguard::AppGuardDecisionResponse, ::appguard::AppGuardDecisionRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestDecisionStream(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::appguard::AppGuardDecisionResponse, ::appguard::AppGuardDecisionRequest>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(5, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_HandleTcpConnectionBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_HandleTcpConnectionBatch() {
+      ::grpc::Service::MarkMethodAsync(6);
+    }
+    ~WithAsyncMethod_HandleTcpConnectionBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status HandleTcpConnectionBatch(::grpc::ServerContext* /*context*/, const ::appguard::AppGuardTcpConnectionBatch* /*request*/, ::appguard::AppGuardTcpResponseBatch* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestHandleTcpConnectionBatch(::grpc::ServerContext* context, ::appguard::AppGuardTcpConnectionBatch* request, ::grpc::ServerAsyncResponseWriter< ::appguard::AppGuardTcpResponseBatch>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_HandleHttpRequestBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_HandleHttpRequestBatch() {
+      ::grpc::Service::MarkMethodAsync(7);
+    }
+    ~WithAsyncMethod_HandleHttpRequestBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status HandleHttpRequestBatch(::grpc::ServerContext* /*context*/, const ::appguard::AppGuardHttpRequestBatch* /*request*/, ::appguard::AppGuardResponseBatch* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestHandleHttpRequestBatch(::grpc::ServerContext* context, ::appguard::AppGuardHttpRequestBatch* request, ::grpc::ServerAsyncResponseWriter< ::appguard::AppGuardResponseBatch>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_HandleHttpResponseBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_HandleHttpResponseBatch() {
+      ::grpc::Service::MarkMethodAsync(8);
+    }
+    ~WithAsyncMethod_HandleHttpResponseBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status HandleHttpResponseBatch(::grpc::ServerContext* /*context*/, const ::appguard::AppGuardHttpResponseBatch* /*request*/, ::appguard::AppGuardResponseBatch* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestHandleHttpResponseBatch(::grpc::ServerContext* context, ::appguard::AppGuardHttpResponseBatch* request, ::grpc::ServerAsyncResponseWriter< ::appguard::AppGuardResponseBatch>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithAsyncMethod_HandleSmtpRequest : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_HandleSmtpRequest() {
-      ::grpc::Service::MarkMethodAsync(5);
+      ::grpc::Service::MarkMethodAsync(9);
     }
     ~WithAsyncMethod_HandleSmtpRequest() override {
       BaseClassMustBeDerivedFromService(this);
@@ -553,7 +807,7 @@ class AppGuard final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestHandleSmtpRequest(::grpc::ServerContext* context, ::appguard::AppGuardSmtpRequest* request, ::grpc::ServerAsyncResponseWriter< ::appguard::AppGuardResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -562,7 +816,7 @@ class AppGuard final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_HandleSmtpResponse() {
-      ::grpc::Service::MarkMethodAsync(6);
+      ::grpc::Service::MarkMethodAsync(10);
     }
     ~WithAsyncMethod_HandleSmtpResponse() override {
       BaseClassMustBeDerivedFromService(this);
@@ -573,7 +827,7 @@ class AppGuard final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestHandleSmtpResponse(::grpc::ServerContext* context, ::appguard::AppGuardSmtpResponse* request, ::grpc::ServerAsyncResponseWriter< ::appguard::AppGuardResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(10, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -582,7 +836,7 @@ class AppGuard final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_FirewallDefaultsRequest() {
-      ::grpc::Service::MarkMethodAsync(7);
+      ::grpc::Service::MarkMethodAsync(11);
     }
     ~WithAsyncMethod_FirewallDefaultsRequest() override {
       BaseClassMustBeDerivedFromService(this);
@@ -593,10 +847,10 @@ class AppGuard final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestFirewallDefaultsRequest(::grpc::ServerContext* context, ::appguard::Token* request, ::grpc::ServerAsyncResponseWriter< ::appguard_commands::FirewallDefaults>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(11, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_ControlChannel<WithAsyncMethod_HandleLogs<WithAsyncMethod_HandleTcpConnection<WithAsyncMethod_HandleHttpRequest<WithAsyncMethod_HandleHttpResponse<WithAsyncMethod_HandleSmtpRequest<WithAsyncMethod_HandleSmtpResponse<WithAsyncMethod_FirewallDefaultsRequest<Service > > > > > > > > AsyncService;
+  typedef WithAsyncMethod_ControlChannel<WithAsyncMethod_HandleLogs<WithAsyncMethod_HandleTcpConnection<WithAsyncMethod_HandleHttpRequest<WithAsyncMethod_HandleHttpResponse<WithAsyncMethod_DecisionStream<WithAsyncMethod_HandleTcpConnectionBatch<WithAsyncMethod_HandleHttpRequestBatch<WithAsyncMethod_HandleHttpResponseBatch<WithAsyncMethod_HandleSmtpRequest<WithAsyncMethod_HandleSmtpResponse<WithAsyncMethod_FirewallDefaultsRequest<Service > > > > > > > > > > > > AsyncService;
   template <class BaseClass>
   class ExperimentalWithCallbackMethod_ControlChannel : public BaseClass {
    private:
@@ -824,192 +1078,371 @@ class AppGuard final {
       { return nullptr; }
   };
   template <class BaseClass>
-  class ExperimentalWithCallbackMethod_HandleSmtpRequest : public BaseClass {
+  class ExperimentalWithCallbackMethod_DecisionStream : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    ExperimentalWithCallbackMethod_HandleSmtpRequest() {
+    ExperimentalWithCallbackMethod_DecisionStream() {
     #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
       ::grpc::Service::
     #else
       ::grpc::Service::experimental().
     #endif
         MarkMethodCallback(5,
-          new ::grpc_impl::internal::CallbackUnaryHandler< ::appguard::AppGuardSmtpRequest, ::appguard::AppGuardResponse>(
+          new ::grpc_impl::internal::CallbackBidiHandler< ::appguard::AppGuardDecisionRequest, ::appguard::AppGuardDecisionResponse>(
             [this](
     #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
                    ::grpc::CallbackServerContext*
     #else
                    ::grpc::experimental::CallbackServerContext*
     #endif
-                     context, const ::appguard::AppGuardSmtpRequest* request, ::appguard::AppGuardResponse* response) { return this->HandleSmtpRequest(context, request, response); }));}
-    void SetMessageAllocatorFor_HandleSmtpRequest(
-        ::grpc::experimental::MessageAllocator< ::appguard::AppGuardSmtpRequest, ::appguard::AppGuardResponse>* allocator) {
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(5);
-    #else
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::experimental().GetHandler(5);
-    #endif
-      static_cast<::grpc_impl::internal::CallbackUnaryHandler< ::appguard::AppGuardSmtpRequest, ::appguard::AppGuardResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
+                     context) { return this->DecisionStream(context); }));
     }
-    ~ExperimentalWithCallbackMethod_HandleSmtpRequest() override {
+    ~ExperimentalWithCallbackMethod_DecisionStream() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status HandleSmtpRequest(::grpc::ServerContext* /*context*/, const ::appguard::AppGuardSmtpRequest* /*request*/, ::appguard::AppGuardResponse* /*response*/) override {
+    ::grpc::Status DecisionStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::appguard::AppGuardDecisionResponse, ::appguard::AppGuardDecisionRequest>* /*stream*/)  override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-    virtual ::grpc::ServerUnaryReactor* HandleSmtpRequest(
-      ::grpc::CallbackServerContext* /*context*/, const ::appguard::AppGuardSmtpRequest* /*request*/, ::appguard::AppGuardResponse* /*response*/)
+    virtual ::grpc::ServerBidiReactor< ::appguard::AppGuardDecisionRequest, ::appguard::AppGuardDecisionResponse>* DecisionStream(
+      ::grpc::CallbackServerContext* /*context*/)
     #else
-    virtual ::grpc::experimental::ServerUnaryReactor* HandleSmtpRequest(
-      ::grpc::experimental::CallbackServerContext* /*context*/, const ::appguard::AppGuardSmtpRequest* /*request*/, ::appguard::AppGuardResponse* /*response*/)
+    virtual ::grpc::experimental::ServerBidiReactor< ::appguard::AppGuardDecisionRequest, ::appguard::AppGuardDecisionResponse>* DecisionStream(
+      ::grpc::experimental::CallbackServerContext* /*context*/)
     #endif
       { return nullptr; }
   };
   template <class BaseClass>
-  class ExperimentalWithCallbackMethod_HandleSmtpResponse : public BaseClass {
+  class ExperimentalWithCallbackMethod_HandleTcpConnectionBatch : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    ExperimentalWithCallbackMethod_HandleSmtpResponse() {
+    ExperimentalWithCallbackMethod_HandleTcpConnectionBatch() {
     #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
       ::grpc::Service::
     #else
       ::grpc::Service::experimental().
     #endif
         MarkMethodCallback(6,
-          new ::grpc_impl::internal::CallbackUnaryHandler< ::appguard::AppGuardSmtpResponse, ::appguard::AppGuardResponse>(
+          new ::grpc_impl::internal::CallbackUnaryHandler< ::appguard::AppGuardTcpConnectionBatch, ::appguard::AppGuardTcpResponseBatch>(
             [this](
     #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
                    ::grpc::CallbackServerContext*
     #else
                    ::grpc::experimental::CallbackServerContext*
     #endif
-                     context, const ::appguard::AppGuardSmtpResponse* request, ::appguard::AppGuardResponse* response) { return this->HandleSmtpResponse(context, request, response); }));}
-    void SetMessageAllocatorFor_HandleSmtpResponse(
-        ::grpc::experimental::MessageAllocator< ::appguard::AppGuardSmtpResponse, ::appguard::AppGuardResponse>* allocator) {
+                     context, const ::appguard::AppGuardTcpConnectionBatch* request, ::appguard::AppGuardTcpResponseBatch* response) { return this->HandleTcpConnectionBatch(context, request, response); }));}
+    void SetMessageAllocatorFor_HandleTcpConnectionBatch(
+        ::grpc::experimental::MessageAllocator< ::appguard::AppGuardTcpConnectionBatch, ::appguard::AppGuardTcpResponseBatch>* allocator) {
     #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
       ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(6);
     #else
       ::grpc::internal::MethodHandler* const handler = ::grpc::Service::experimental().GetHandler(6);
     #endif
-      static_cast<::grpc_impl::internal::CallbackUnaryHandler< ::appguard::AppGuardSmtpResponse, ::appguard::AppGuardResponse>*>(handler)
+      static_cast<::grpc_impl::internal::CallbackUnaryHandler< ::appguard::AppGuardTcpConnectionBatch, ::appguard::AppGuardTcpResponseBatch>*>(handler)
               ->SetMessageAllocator(allocator);
     }
-    ~ExperimentalWithCallbackMethod_HandleSmtpResponse() override {
+    ~ExperimentalWithCallbackMethod_HandleTcpConnectionBatch() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status HandleSmtpResponse(::grpc::ServerContext* /*context*/, const ::appguard::AppGuardSmtpResponse* /*request*/, ::appguard::AppGuardResponse* /*response*/) override {
+    ::grpc::Status HandleTcpConnectionBatch(::grpc::ServerContext* /*context*/, const ::appguard::AppGuardTcpConnectionBatch* /*request*/, ::appguard::AppGuardTcpResponseBatch* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-    virtual ::grpc::ServerUnaryReactor* HandleSmtpResponse(
-      ::grpc::CallbackServerContext* /*context*/, const ::appguard::AppGuardSmtpResponse* /*request*/, ::appguard::AppGuardResponse* /*response*/)
+    virtual ::grpc::ServerUnaryReactor* HandleTcpConnectionBatch(
+      ::grpc::CallbackServerContext* /*context*/, const ::appguard::AppGuardTcpConnectionBatch* /*request*/, ::appguard::AppGuardTcpResponseBatch* /*response*/)
     #else
-    virtual ::grpc::experimental::ServerUnaryReactor* HandleSmtpResponse(
-      ::grpc::experimental::CallbackServerContext* /*context*/, const ::appguard::AppGuardSmtpResponse* /*request*/, ::appguard::AppGuardResponse* /*response*/)
+    virtual ::grpc::experimental::ServerUnaryReactor* HandleTcpConnectionBatch(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::appguard::AppGuardTcpConnectionBatch* /*request*/, ::appguard::AppGuardTcpResponseBatch* /*response*/)
     #endif
       { return nullptr; }
   };
   template <class BaseClass>
-  class ExperimentalWithCallbackMethod_FirewallDefaultsRequest : public BaseClass {
+  class ExperimentalWithCallbackMethod_HandleHttpRequestBatch : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    ExperimentalWithCallbackMethod_FirewallDefaultsRequest() {
+    ExperimentalWithCallbackMethod_HandleHttpRequestBatch() {
     #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
       ::grpc::Service::
     #else
       ::grpc::Service::experimental().
     #endif
         MarkMethodCallback(7,
-          new ::grpc_impl::internal::CallbackUnaryHandler< ::appguard::Token, ::appguard_commands::FirewallDefaults>(
+          new ::grpc_impl::internal::CallbackUnaryHandler< ::appguard::AppGuardHttpRequestBatch, ::appguard::AppGuardResponseBatch>(
             [this](
     #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
                    ::grpc::CallbackServerContext*
     #else
                    ::grpc::experimental::CallbackServerContext*
     #endif
-                     context, const ::appguard::Token* request, ::appguard_commands::FirewallDefaults* response) { return this->FirewallDefaultsRequest(context, request, response); }));}
-    void SetMessageAllocatorFor_FirewallDefaultsRequest(
-        ::grpc::experimental::MessageAllocator< ::appguard::Token, ::appguard_commands::FirewallDefaults>* allocator) {
+                     context, const ::appguard::AppGuardHttpRequestBatch* request, ::appguard::AppGuardResponseBatch* response) { return this->HandleHttpRequestBatch(context, request, response); }));}
+    void SetMessageAllocatorFor_HandleHttpRequestBatch(
+        ::grpc::experimental::MessageAllocator< ::appguard::AppGuardHttpRequestBatch, ::appguard::AppGuardResponseBatch>* allocator) {
     #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
       ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(7);
     #else
       ::grpc::internal::MethodHandler* const handler = ::grpc::Service::experimental().GetHandler(7);
     #endif
-      static_cast<::grpc_impl::internal::CallbackUnaryHandler< ::appguard::Token, ::appguard_commands::FirewallDefaults>*>(handler)
+      static_cast<::grpc_impl::internal::CallbackUnaryHandler< ::appguard::AppGuardHttpRequestBatch, ::appguard::AppGuardResponseBatch>*>(handler)
               ->SetMessageAllocator(allocator);
     }
-    ~ExperimentalWithCallbackMethod_FirewallDefaultsRequest() override {
+    ~ExperimentalWithCallbackMethod_HandleHttpRequestBatch() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status FirewallDefaultsRequest(::grpc::ServerContext* /*context*/, const ::appguard::Token* /*request*/, ::appguard_commands::FirewallDefaults* /*response*/) override {
+    ::grpc::Status HandleHttpRequestBatch(::grpc::ServerContext* /*context*/, const ::appguard::AppGuardHttpRequestBatch* /*request*/, ::appguard::AppGuardResponseBatch* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-    virtual ::grpc::ServerUnaryReactor* FirewallDefaultsRequest(
-      ::grpc::CallbackServerContext* /*context*/, const ::appguard::Token* /*request*/, ::appguard_commands::FirewallDefaults* /*response*/)
+    virtual ::grpc::ServerUnaryReactor* HandleHttpRequestBatch(
+      ::grpc::CallbackServerContext* /*context*/, const ::appguard::AppGuardHttpRequestBatch* /*request*/, ::appguard::AppGuardResponseBatch* /*response*/)
     #else
-    virtual ::grpc::experimental::ServerUnaryReactor* FirewallDefaultsRequest(
-      ::grpc::experimental::CallbackServerContext* /*context*/, const ::appguard::Token* /*request*/, ::appguard_commands::FirewallDefaults* /*response*/)
+    virtual ::grpc::experimental::ServerUnaryReactor* HandleHttpRequestBatch(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::appguard::AppGuardHttpRequestBatch* /*request*/, ::appguard::AppGuardResponseBatch* /*response*/)
     #endif
       { return nullptr; }
   };
-  #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-  typedef ExperimentalWithCallbackMethod_ControlChannel<ExperimentalWithCallbackMethod_HandleLogs<ExperimentalWithCallbackMethod_HandleTcpConnection<ExperimentalWithCallbackMethod_HandleHttpRequest<ExperimentalWithCallbackMethod_HandleHttpResponse<ExperimentalWithCallbackMethod_HandleSmtpRequest<ExperimentalWithCallbackMethod_HandleSmtpResponse<ExperimentalWithCallbackMethod_FirewallDefaultsRequest<Service > > > > > > > > CallbackService;
-  #endif
-
-  typedef ExperimentalWithCallbackMethod_ControlChannel<ExperimentalWithCallbackMethod_HandleLogs<ExperimentalWithCallbackMethod_HandleTcpConnection<ExperimentalWithCallbackMethod_HandleHttpRequest<ExperimentalWithCallbackMethod_HandleHttpResponse<ExperimentalWithCallbackMethod_HandleSmtpRequest<ExperimentalWithCallbackMethod_HandleSmtpResponse<ExperimentalWithCallbackMethod_FirewallDefaultsRequest<Service > > > > > > > > ExperimentalCallbackService;
   template <class BaseClass>
-  class WithGenericMethod_ControlChannel : public BaseClass {
+  class ExperimentalWithCallbackMethod_HandleHttpResponseBatch : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_ControlChannel() {
-      ::grpc::Service::MarkMethodGeneric(0);
+    ExperimentalWithCallbackMethod_HandleHttpResponseBatch() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodCallback(8,
+          new ::grpc_impl::internal::CallbackUnaryHandler< ::appguard::AppGuardHttpResponseBatch, ::appguard::AppGuardResponseBatch>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::appguard::AppGuardHttpResponseBatch* request, ::appguard::AppGuardResponseBatch* response) { return this->HandleHttpResponseBatch(context, request, response); }));}
+    void SetMessageAllocatorFor_HandleHttpResponseBatch(
+        ::grpc::experimental::MessageAllocator< ::appguard::AppGuardHttpResponseBatch, ::appguard::AppGuardResponseBatch>* allocator) {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(8);
+    #else
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::experimental().GetHandler(8);
+    #endif
+      static_cast<::grpc_impl::internal::CallbackUnaryHandler< ::appguard::AppGuardHttpResponseBatch, ::appguard::AppGuardResponseBatch>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithGenericMethod_ControlChannel() override {
+    ~ExperimentalWithCallbackMethod_HandleHttpResponseBatch() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status ControlChannel(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::appguard_commands::ServerMessage, ::appguard_commands::ClientMessage>* /*stream*/)  override {
+    ::grpc::Status HandleHttpResponseBatch(::grpc::ServerContext* /*context*/, const ::appguard::AppGuardHttpResponseBatch* /*request*/, ::appguard::AppGuardResponseBatch* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerUnaryReactor* HandleHttpResponseBatch(
+      ::grpc::CallbackServerContext* /*context*/, const ::appguard::AppGuardHttpResponseBatch* /*request*/, ::appguard::AppGuardResponseBatch* /*response*/)
+    #else
+    virtual ::grpc::experimental::ServerUnaryReactor* HandleHttpResponseBatch(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::appguard::AppGuardHttpResponseBatch* /*request*/, ::appguard::AppGuardResponseBatch* /*response*/)
+    #endif
+      { return nullptr; }
   };
   template <class BaseClass>
-  class WithGenericMethod_HandleLogs : public BaseClass {
+  class ExperimentalWithCallbackMethod_HandleSmtpRequest : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_HandleLogs() {
-      ::grpc::Service::MarkMethodGeneric(1);
+    ExperimentalWithCallbackMethod_HandleSmtpRequest() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodCallback(9,
+          new ::grpc_impl::internal::CallbackUnaryHandler< ::appguard::AppGuardSmtpRequest, ::appguard::AppGuardResponse>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::appguard::AppGuardSmtpRequest* request, ::appguard::AppGuardResponse* response) { return this->HandleSmtpRequest(context, request, response); }));}
+    void SetMessageAllocatorFor_HandleSmtpRequest(
+        ::grpc::experimental::MessageAllocator< ::appguard::AppGuardSmtpRequest, ::appguard::AppGuardResponse>* allocator) {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(9);
+    #else
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::experimental().GetHandler(9);
+    #endif
+      static_cast<::grpc_impl::internal::CallbackUnaryHandler< ::appguard::AppGuardSmtpRequest, ::appguard::AppGuardResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithGenericMethod_HandleLogs() override {
+    ~ExperimentalWithCallbackMethod_HandleSmtpRequest() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status HandleLogs(::grpc::ServerContext* /*context*/, const ::appguard::Logs* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+    ::grpc::Status HandleSmtpRequest(::grpc::ServerContext* /*context*/, const ::appguard::AppGuardSmtpRequest* /*request*/, ::appguard::AppGuardResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerUnaryReactor* HandleSmtpRequest(
+      ::grpc::CallbackServerContext* /*context*/, const ::appguard::AppGuardSmtpRequest* /*request*/, ::appguard::AppGuardResponse* /*response*/)
+    #else
+    virtual ::grpc::experimental::ServerUnaryReactor* HandleSmtpRequest(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::appguard::AppGuardSmtpRequest* /*request*/, ::appguard::AppGuardResponse* /*response*/)
+    #endif
+      { return nullptr; }
   };
   template <class BaseClass>
-  class WithGenericMethod_HandleTcpConnection : public BaseClass {
+  class ExperimentalWithCallbackMethod_HandleSmtpResponse : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_HandleTcpConnection() {
-      ::grpc::Service::MarkMethodGeneric(2);
+    ExperimentalWithCallbackMethod_HandleSmtpResponse() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodCallback(10,
+          new ::grpc_impl::internal::CallbackUnaryHandler< ::appguard::AppGuardSmtpResponse, ::appguard::AppGuardResponse>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::appguard::AppGuardSmtpResponse* request, ::appguard::AppGuardResponse* response) { return this->HandleSmtpResponse(context, request, response); }));}
+    void SetMessageAllocatorFor_HandleSmtpResponse(
+        ::grpc::experimental::MessageAllocator< ::appguard::AppGuardSmtpResponse, ::appguard::AppGuardResponse>* allocator) {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(10);
+    #else
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::experimental().GetHandler(10);
+    #endif
+      static_cast<::grpc_impl::internal::CallbackUnaryHandler< ::appguard::AppGuardSmtpResponse, ::appguard::AppGuardResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~ExperimentalWithCallbackMethod_HandleSmtpResponse() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status HandleSmtpResponse(::grpc::ServerContext* /*context*/, const ::appguard::AppGuardSmtpResponse* /*request*/, ::appguard::AppGuardResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerUnaryReactor* HandleSmtpResponse(
+      ::grpc::CallbackServerContext* /*context*/, const ::appguard::AppGuardSmtpResponse* /*request*/, ::appguard::AppGuardResponse* /*response*/)
+    #else
+    virtual ::grpc::experimental::ServerUnaryReactor* HandleSmtpResponse(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::appguard::AppGuardSmtpResponse* /*request*/, ::appguard::AppGuardResponse* /*response*/)
+    #endif
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class ExperimentalWithCallbackMethod_FirewallDefaultsRequest : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithCallbackMethod_FirewallDefaultsRequest() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodCallback(11,
+          new ::grpc_impl::internal::CallbackUnaryHandler< ::appguard::Token, ::appguard_commands::FirewallDefaults>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::appguard::Token* request, ::appguard_commands::FirewallDefaults* response) { return this->FirewallDefaultsRequest(context, request, response); }));}
+    void SetMessageAllocatorFor_FirewallDefaultsRequest(
+        ::grpc::experimental::MessageAllocator< ::appguard::Token, ::appguard_commands::FirewallDefaults>* allocator) {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(11);
+    #else
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::experimental().GetHandler(11);
+    #endif
+      static_cast<::grpc_impl::internal::CallbackUnaryHandler< ::appguard::Token, ::appguard_commands::FirewallDefaults>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~ExperimentalWithCallbackMethod_FirewallDefaultsRequest() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status FirewallDefaultsRequest(::grpc::ServerContext* /*context*/, const ::appguard::Token* /*request*/, ::appguard_commands::FirewallDefaults* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerUnaryReactor* FirewallDefaultsRequest(
+      ::grpc::CallbackServerContext* /*context*/, const ::appguard::Token* /*request*/, ::appguard_commands::FirewallDefaults* /*response*/)
+    #else
+    virtual ::grpc::experimental::ServerUnaryReactor* FirewallDefaultsRequest(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::appguard::Token* /*request*/, ::appguard_commands::FirewallDefaults* /*response*/)
+    #endif
+      { return nullptr; }
+  };
+  #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+  typedef ExperimentalWithCallbackMethod_ControlChannel<ExperimentalWithCallbackMethod_HandleLogs<ExperimentalWithCallbackMethod_HandleTcpConnection<ExperimentalWithCallbackMethod_HandleHttpRequest<ExperimentalWithCallbackMethod_HandleHttpResponse<ExperimentalWithCallbackMethod_DecisionStream<ExperimentalWithCallbackMethod_HandleTcpConnectionBatch<ExperimentalWithCallbackMethod_HandleHttpRequestBatch<ExperimentalWithCallbackMethod_HandleHttpResponseBatch<ExperimentalWithCallbackMethod_HandleSmtpRequest<ExperimentalWithCallbackMethod_HandleSmtpResponse<ExperimentalWithCallbackMethod_FirewallDefaultsRequest<Service > > > > > > > > > > > > CallbackService;
+  #endif
+
+  typedef ExperimentalWithCallbackMethod_ControlChannel<ExperimentalWithCallbackMethod_HandleLogs<ExperimentalWithCallbackMethod_HandleTcpConnection<ExperimentalWithCallbackMethod_HandleHttpRequest<ExperimentalWithCallbackMethod_HandleHttpResponse<ExperimentalWithCallbackMethod_DecisionStream<ExperimentalWithCallbackMethod_HandleTcpConnectionBatch<ExperimentalWithCallbackMethod_HandleHttpRequestBatch<ExperimentalWithCallbackMethod_HandleHttpResponseBatch<ExperimentalWithCallbackMethod_HandleSmtpRequest<ExperimentalWithCallbackMethod_HandleSmtpResponse<ExperimentalWithCallbackMethod_FirewallDefaultsRequest<Service > > > > > > > > > > > > ExperimentalCallbackService;
+  template <class BaseClass>
+  class WithGenericMethod_ControlChannel : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_ControlChannel() {
+      ::grpc::Service::MarkMethodGeneric(0);
+    }
+    ~WithGenericMethod_ControlChannel() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ControlChannel(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::appguard_commands::ServerMessage, ::appguard_commands::ClientMessage>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_HandleLogs : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_HandleLogs() {
+      ::grpc::Service::MarkMethodGeneric(1);
+    }
+    ~WithGenericMethod_HandleLogs() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status HandleLogs(::grpc::ServerContext* /*context*/, const ::appguard::Logs* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_HandleTcpConnection : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_HandleTcpConnection() {
+      ::grpc::Service::MarkMethodGeneric(2);
     }
     ~WithGenericMethod_HandleTcpConnection() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1055,12 +1488,80 @@ class AppGuard final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_DecisionStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_DecisionStream() {
+      ::grpc::Service::MarkMethodGeneric(5);
+    }
+    ~WithGenericMethod_DecisionStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status DecisionStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::appguard::AppGuardDecisionResponse, ::appguard::AppGuardDecisionRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_HandleTcpConnectionBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_HandleTcpConnectionBatch() {
+      ::grpc::Service::MarkMethodGeneric(6);
+    }
+    ~WithGenericMethod_HandleTcpConnectionBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status HandleTcpConnectionBatch(::grpc::ServerContext* /*context*/, const ::appguard::AppGuardTcpConnectionBatch* /*request*/, ::appguard::AppGuardTcpResponseBatch* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_HandleHttpRequestBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_HandleHttpRequestBatch() {
+      ::grpc::Service::MarkMethodGeneric(7);
+    }
+    ~WithGenericMethod_HandleHttpRequestBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status HandleHttpRequestBatch(::grpc::ServerContext* /*context*/, const ::appguard::AppGuardHttpRequestBatch* /*request*/, ::appguard::AppGuardResponseBatch* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_HandleHttpResponseBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_HandleHttpResponseBatch() {
+      ::grpc::Service::MarkMethodGeneric(8);
+    }
+    ~WithGenericMethod_HandleHttpResponseBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status HandleHttpResponseBatch(::grpc::ServerContext* /*context*/, const ::appguard::AppGuardHttpResponseBatch* /*request*/, ::appguard::AppGuardResponseBatch* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithGenericMethod_HandleSmtpRequest : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_HandleSmtpRequest() {
-      ::grpc::Service::MarkMethodGeneric(5);
+      ::grpc::Service::MarkMethodGeneric(9);
     }
     ~WithGenericMethod_HandleSmtpRequest() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1077,7 +1578,7 @@ class AppGuard final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_HandleSmtpResponse() {
-      ::grpc::Service::MarkMethodGeneric(6);
+      ::grpc::Service::MarkMethodGeneric(10);
     }
     ~WithGenericMethod_HandleSmtpResponse() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1094,7 +1595,7 @@ class AppGuard final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_FirewallDefaultsRequest() {
-      ::grpc::Service::MarkMethodGeneric(7);
+      ::grpc::Service::MarkMethodGeneric(11);
     }
     ~WithGenericMethod_FirewallDefaultsRequest() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1206,12 +1707,92 @@ class AppGuard final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_DecisionStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_DecisionStream() {
+      ::grpc::Service::MarkMethodRaw(5);
+    }
+    ~WithRawMethod_DecisionStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status DecisionStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::appguard::AppGuardDecisionResponse, ::appguard::AppGuardDecisionRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestDecisionStream(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(5, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_HandleTcpConnectionBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_HandleTcpConnectionBatch() {
+      ::grpc::Service::MarkMethodRaw(6);
+    }
+    ~WithRawMethod_HandleTcpConnectionBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status HandleTcpConnectionBatch(::grpc::ServerContext* /*context*/, const ::appguard::AppGuardTcpConnectionBatch* /*request*/, ::appguard::AppGuardTcpResponseBatch* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestHandleTcpConnectionBatch(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_HandleHttpRequestBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_HandleHttpRequestBatch() {
+      ::grpc::Service::MarkMethodRaw(7);
+    }
+    ~WithRawMethod_HandleHttpRequestBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status HandleHttpRequestBatch(::grpc::ServerContext* /*context*/, const ::appguard::AppGuardHttpRequestBatch* /*request*/, ::appguard::AppGuardResponseBatch* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestHandleHttpRequestBatch(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_HandleHttpResponseBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_HandleHttpResponseBatch() {
+      ::grpc::Service::MarkMethodRaw(8);
+    }
+    ~WithRawMethod_HandleHttpResponseBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status HandleHttpResponseBatch(::grpc::ServerContext* /*context*/, const ::appguard::AppGuardHttpResponseBatch* /*request*/, ::appguard::AppGuardResponseBatch* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestHandleHttpResponseBatch(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_HandleSmtpRequest : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_HandleSmtpRequest() {
-      ::grpc::Service::MarkMethodRaw(5);
+      ::grpc::Service::MarkMethodRaw(9);
     }
     ~WithRawMethod_HandleSmtpRequest() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1222,7 +1803,7 @@ class AppGuard final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestHandleSmtpRequest(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1231,7 +1812,7 @@ class AppGuard final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_HandleSmtpResponse() {
-      ::grpc::Service::MarkMethodRaw(6);
+      ::grpc::Service::MarkMethodRaw(10);
     }
     ~WithRawMethod_HandleSmtpResponse() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1242,7 +1823,7 @@ class AppGuard final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestHandleSmtpResponse(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(10, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1251,7 +1832,7 @@ class AppGuard final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_FirewallDefaultsRequest() {
-      ::grpc::Service::MarkMethodRaw(7);
+      ::grpc::Service::MarkMethodRaw(11);
     }
     ~WithRawMethod_FirewallDefaultsRequest() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1262,7 +1843,7 @@ class AppGuard final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestFirewallDefaultsRequest(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(11, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1456,6 +2037,158 @@ class AppGuard final {
       { return nullptr; }
   };
   template <class BaseClass>
+  class ExperimentalWithRawCallbackMethod_DecisionStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithRawCallbackMethod_DecisionStream() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodRawCallback(5,
+          new ::grpc_impl::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context) { return this->DecisionStream(context); }));
+    }
+    ~ExperimentalWithRawCallbackMethod_DecisionStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status DecisionStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::appguard::AppGuardDecisionResponse, ::appguard::AppGuardDecisionRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* DecisionStream(
+      ::grpc::CallbackServerContext* /*context*/)
+    #else
+    virtual ::grpc::experimental::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* DecisionStream(
+      ::grpc::experimental::CallbackServerContext* /*context*/)
+    #endif
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class ExperimentalWithRawCallbackMethod_HandleTcpConnectionBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithRawCallbackMethod_HandleTcpConnectionBatch() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodRawCallback(6,
+          new ::grpc_impl::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->HandleTcpConnectionBatch(context, request, response); }));
+    }
+    ~ExperimentalWithRawCallbackMethod_HandleTcpConnectionBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status HandleTcpConnectionBatch(::grpc::ServerContext* /*context*/, const ::appguard::AppGuardTcpConnectionBatch* /*request*/, ::appguard::AppGuardTcpResponseBatch* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerUnaryReactor* HandleTcpConnectionBatch(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
+    #else
+    virtual ::grpc::experimental::ServerUnaryReactor* HandleTcpConnectionBatch(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
+    #endif
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class ExperimentalWithRawCallbackMethod_HandleHttpRequestBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithRawCallbackMethod_HandleHttpRequestBatch() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodRawCallback(7,
+          new ::grpc_impl::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->HandleHttpRequestBatch(context, request, response); }));
+    }
+    ~ExperimentalWithRawCallbackMethod_HandleHttpRequestBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status HandleHttpRequestBatch(::grpc::ServerContext* /*context*/, const ::appguard::AppGuardHttpRequestBatch* /*request*/, ::appguard::AppGuardResponseBatch* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerUnaryReactor* HandleHttpRequestBatch(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
+    #else
+    virtual ::grpc::experimental::ServerUnaryReactor* HandleHttpRequestBatch(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
+    #endif
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class ExperimentalWithRawCallbackMethod_HandleHttpResponseBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithRawCallbackMethod_HandleHttpResponseBatch() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodRawCallback(8,
+          new ::grpc_impl::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->HandleHttpResponseBatch(context, request, response); }));
+    }
+    ~ExperimentalWithRawCallbackMethod_HandleHttpResponseBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status HandleHttpResponseBatch(::grpc::ServerContext* /*context*/, const ::appguard::AppGuardHttpResponseBatch* /*request*/, ::appguard::AppGuardResponseBatch* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerUnaryReactor* HandleHttpResponseBatch(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
+    #else
+    virtual ::grpc::experimental::ServerUnaryReactor* HandleHttpResponseBatch(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
+    #endif
+      { return nullptr; }
+  };
+  template <class BaseClass>
   class ExperimentalWithRawCallbackMethod_HandleSmtpRequest : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -1466,7 +2199,7 @@ class AppGuard final {
     #else
       ::grpc::Service::experimental().
     #endif
-        MarkMethodRawCallback(5,
+        MarkMethodRawCallback(9,
           new ::grpc_impl::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
     #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
@@ -1504,7 +2237,7 @@ class AppGuard final {
     #else
       ::grpc::Service::experimental().
     #endif
-        MarkMethodRawCallback(6,
+        MarkMethodRawCallback(10,
           new ::grpc_impl::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
     #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
@@ -1542,7 +2275,7 @@ class AppGuard final {
     #else
       ::grpc::Service::experimental().
     #endif
-        MarkMethodRawCallback(7,
+        MarkMethodRawCallback(11,
           new ::grpc_impl::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
     #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
@@ -1678,12 +2411,93 @@ class AppGuard final {
     virtual ::grpc::Status StreamedHandleHttpResponse(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::appguard::AppGuardHttpResponse,::appguard::AppGuardResponse>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
+  class WithStreamedUnaryMethod_HandleTcpConnectionBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_HandleTcpConnectionBatch() {
+      ::grpc::Service::MarkMethodStreamed(6,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::appguard::AppGuardTcpConnectionBatch, ::appguard::AppGuardTcpResponseBatch>(
+            [this](::grpc_impl::ServerContext* context,
+                   ::grpc_impl::ServerUnaryStreamer<
+                     ::appguard::AppGuardTcpConnectionBatch, ::appguard::AppGuardTcpResponseBatch>* streamer) {
+                       return this->StreamedHandleTcpConnectionBatch(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_HandleTcpConnectionBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status HandleTcpConnectionBatch(::grpc::ServerContext* /*context*/, const ::appguard::AppGuardTcpConnectionBatch* /*request*/, ::appguard::AppGuardTcpResponseBatch* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedHandleTcpConnectionBatch(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::appguard::AppGuardTcpConnectionBatch,::appguard::AppGuardTcpResponseBatch>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_HandleHttpRequestBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_HandleHttpRequestBatch() {
+      ::grpc::Service::MarkMethodStreamed(7,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::appguard::AppGuardHttpRequestBatch, ::appguard::AppGuardResponseBatch>(
+            [this](::grpc_impl::ServerContext* context,
+                   ::grpc_impl::ServerUnaryStreamer<
+                     ::appguard::AppGuardHttpRequestBatch, ::appguard::AppGuardResponseBatch>* streamer) {
+                       return this->StreamedHandleHttpRequestBatch(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_HandleHttpRequestBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status HandleHttpRequestBatch(::grpc::ServerContext* /*context*/, const ::appguard::AppGuardHttpRequestBatch* /*request*/, ::appguard::AppGuardResponseBatch* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedHandleHttpRequestBatch(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::appguard::AppGuardHttpRequestBatch,::appguard::AppGuardResponseBatch>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_HandleHttpResponseBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_HandleHttpResponseBatch() {
+      ::grpc::Service::MarkMethodStreamed(8,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::appguard::AppGuardHttpResponseBatch, ::appguard::AppGuardResponseBatch>(
+            [this](::grpc_impl::ServerContext* context,
+                   ::grpc_impl::ServerUnaryStreamer<
+                     ::appguard::AppGuardHttpResponseBatch, ::appguard::AppGuardResponseBatch>* streamer) {
+                       return this->StreamedHandleHttpResponseBatch(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_HandleHttpResponseBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status HandleHttpResponseBatch(::grpc::ServerContext* /*context*/, const ::appguard::AppGuardHttpResponseBatch* /*request*/, ::appguard::AppGuardResponseBatch* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedHandleHttpResponseBatch(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::appguard::AppGuardHttpResponseBatch,::appguard::AppGuardResponseBatch>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_HandleSmtpRequest : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_HandleSmtpRequest() {
-      ::grpc::Service::MarkMethodStreamed(5,
+      ::grpc::Service::MarkMethodStreamed(9,
         new ::grpc::internal::StreamedUnaryHandler<
           ::appguard::AppGuardSmtpRequest, ::appguard::AppGuardResponse>(
             [this](::grpc_impl::ServerContext* context,
@@ -1710,7 +2524,7 @@ class AppGuard final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_HandleSmtpResponse() {
-      ::grpc::Service::MarkMethodStreamed(6,
+      ::grpc::Service::MarkMethodStreamed(10,
         new ::grpc::internal::StreamedUnaryHandler<
           ::appguard::AppGuardSmtpResponse, ::appguard::AppGuardResponse>(
             [this](::grpc_impl::ServerContext* context,
@@ -1737,7 +2551,7 @@ class AppGuard final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_FirewallDefaultsRequest() {
-      ::grpc::Service::MarkMethodStreamed(7,
+      ::grpc::Service::MarkMethodStreamed(11,
         new ::grpc::internal::StreamedUnaryHandler<
           ::appguard::Token, ::appguard_commands::FirewallDefaults>(
             [this](::grpc_impl::ServerContext* context,
@@ -1758,9 +2572,9 @@ class AppGuard final {
     // replace default version of method with streamed unary
     virtual ::grpc::Status StreamedFirewallDefaultsRequest(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::appguard::Token,::appguard_commands::FirewallDefaults>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_HandleLogs<WithStreamedUnaryMethod_HandleTcpConnection<WithStreamedUnaryMethod_HandleHttpRequest<WithStreamedUnaryMethod_HandleHttpResponse<WithStreamedUnaryMethod_HandleSmtpRequest<WithStreamedUnaryMethod_HandleSmtpResponse<WithStreamedUnaryMethod_FirewallDefaultsRequest<Service > > > > > > > StreamedUnaryService;
+  typedef WithStreamedUnaryMethod_HandleLogs<WithStreamedUnaryMethod_HandleTcpConnection<WithStreamedUnaryMethod_HandleHttpRequest<WithStreamedUnaryMethod_HandleHttpResponse<WithStreamedUnaryMethod_HandleTcpConnectionBatch<WithStreamedUnaryMethod_HandleHttpRequestBatch<WithStreamedUnaryMethod_HandleHttpResponseBatch<WithStreamedUnaryMethod_HandleSmtpRequest<WithStreamedUnaryMethod_HandleSmtpResponse<WithStreamedUnaryMethod_FirewallDefaultsRequest<Service > > > > > > > > > > StreamedUnaryService;
   typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_HandleLogs<WithStreamedUnaryMethod_HandleTcpConnection<WithStreamedUnaryMethod_HandleHttpRequest<WithStreamedUnaryMethod_HandleHttpResponse<WithStreamedUnaryMethod_HandleSmtpRequest<WithStreamedUnaryMethod_HandleSmtpResponse<WithStreamedUnaryMethod_FirewallDefaultsRequest<Service > > > > > > > StreamedService;
+  typedef WithStreamedUnaryMethod_HandleLogs<WithStreamedUnaryMethod_HandleTcpConnection<WithStreamedUnaryMethod_HandleHttpRequest<WithStreamedUnaryMethod_HandleHttpResponse<WithStreamedUnaryMethod_HandleTcpConnectionBatch<WithStreamedUnaryMethod_HandleHttpRequestBatch<WithStreamedUnaryMethod_HandleHttpResponseBatch<WithStreamedUnaryMethod_HandleSmtpRequest<WithStreamedUnaryMethod_HandleSmtpResponse<WithStreamedUnaryMethod_FirewallDefaultsRequest<Service > > > > > > > > > > StreamedService;
 };
 
 }  // namespace appguard
@@ -14,13 +14,17 @@
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
+extern PROTOBUF_INTERNAL_EXPORT_appguard_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<3> scc_info_AppGuardHttpRequest_appguard_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_appguard_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_AppGuardHttpRequest_HeadersEntry_DoNotUse_appguard_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_appguard_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_AppGuardHttpRequest_QueryEntry_DoNotUse_appguard_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_appguard_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_AppGuardHttpResponse_appguard_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_appguard_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_AppGuardHttpResponse_HeadersEntry_DoNotUse_appguard_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_appguard_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_AppGuardIpInfo_appguard_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_appguard_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_AppGuardResponse_appguard_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_appguard_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_AppGuardSmtpRequest_HeadersEntry_DoNotUse_appguard_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_appguard_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_AppGuardTcpConnection_appguard_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_appguard_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_AppGuardTcpInfo_appguard_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_appguard_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_AppGuardTcpResponse_appguard_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_appguard_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Log_appguard_2eproto;
 namespace appguard {
 class LogsDefaultTypeInternal {
@@ -83,11 +87,77 @@ class AppGuardTcpResponseDefaultTypeInternal {
  public:
   ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<AppGuardTcpResponse> _instance;
 } _AppGuardTcpResponse_default_instance_;
+class AppGuardTcpConnectionBatchDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<AppGuardTcpConnectionBatch> _instance;
+} _AppGuardTcpConnectionBatch_default_instance_;
+class AppGuardTcpResponseBatchDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<AppGuardTcpResponseBatch> _instance;
+} _AppGuardTcpResponseBatch_default_instance_;
+class AppGuardHttpRequestBatchDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<AppGuardHttpRequestBatch> _instance;
+} _AppGuardHttpRequestBatch_default_instance_;
+class AppGuardHttpResponseBatchDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<AppGuardHttpResponseBatch> _instance;
+} _AppGuardHttpResponseBatch_default_instance_;
+class AppGuardResponseBatchDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<AppGuardResponseBatch> _instance;
+} _AppGuardResponseBatch_default_instance_;
+class AppGuardDecisionRequestDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<AppGuardDecisionRequest> _instance;
+  const ::appguard::AppGuardTcpConnection* tcp_connection_;
+  const ::appguard::AppGuardHttpRequest* http_request_;
+  const ::appguard::AppGuardHttpResponse* http_response_;
+} _AppGuardDecisionRequest_default_instance_;
+class AppGuardDecisionResponseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<AppGuardDecisionResponse> _instance;
+  const ::appguard::AppGuardTcpResponse* tcp_response_;
+  const ::appguard::AppGuardResponse* response_;
+} _AppGuardDecisionResponse_default_instance_;
 class TokenDefaultTypeInternal {
  public:
   ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Token> _instance;
 } _Token_default_instance_;
 }  // namespace appguard
+static void InitDefaultsscc_info_AppGuardDecisionRequest_appguard_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::appguard::_AppGuardDecisionRequest_default_instance_;
+    new (ptr) ::appguard::AppGuardDecisionRequest();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::appguard::AppGuardDecisionRequest::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<3> scc_info_AppGuardDecisionRequest_appguard_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 3, 0, InitDefaultsscc_info_AppGuardDecisionRequest_appguard_2eproto}, {
+      &scc_info_AppGuardTcpConnection_appguard_2eproto.base,
+      &scc_info_AppGuardHttpRequest_appguard_2eproto.base,
+      &scc_info_AppGuardHttpResponse_appguard_2eproto.base,}};
+
+static void InitDefaultsscc_info_AppGuardDecisionResponse_appguard_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::appguard::_AppGuardDecisionResponse_default_instance_;
+    new (ptr) ::appguard::AppGuardDecisionResponse();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::appguard::AppGuardDecisionResponse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_AppGuardDecisionResponse_appguard_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 2, 0, InitDefaultsscc_info_AppGuardDecisionResponse_appguard_2eproto}, {
+      &scc_info_AppGuardTcpResponse_appguard_2eproto.base,
+      &scc_info_AppGuardResponse_appguard_2eproto.base,}};
+
 static void InitDefaultsscc_info_AppGuardHttpRequest_appguard_2eproto() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
 
@@ -131,6 +201,21 @@ static void InitDefaultsscc_info_AppGuardHttpRequest_QueryEntry_DoNotUse_appguar
 ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_AppGuardHttpRequest_QueryEntry_DoNotUse_appguard_2eproto =
     {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_AppGuardHttpRequest_QueryEntry_DoNotUse_appguard_2eproto}, {}};
 
+static void InitDefaultsscc_info_AppGuardHttpRequestBatch_appguard_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::appguard::_AppGuardHttpRequestBatch_default_instance_;
+    new (ptr) ::appguard::AppGuardHttpRequestBatch();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::appguard::AppGuardHttpRequestBatch::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_AppGuardHttpRequestBatch_appguard_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_AppGuardHttpRequestBatch_appguard_2eproto}, {
+      &scc_info_AppGuardHttpRequest_appguard_2eproto.base,}};
+
 static void InitDefaultsscc_info_AppGuardHttpResponse_appguard_2eproto() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
 
@@ -160,6 +245,21 @@ static void InitDefaultsscc_info_AppGuardHttpResponse_HeadersEntry_DoNotUse_appg
 ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_AppGuardHttpResponse_HeadersEntry_DoNotUse_appguard_2eproto =
     {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_AppGuardHttpResponse_HeadersEntry_DoNotUse_appguard_2eproto}, {}};
 
+static void InitDefaultsscc_info_AppGuardHttpResponseBatch_appguard_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::appguard::_AppGuardHttpResponseBatch_default_instance_;
+    new (ptr) ::appguard::AppGuardHttpResponseBatch();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::appguard::AppGuardHttpResponseBatch::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_AppGuardHttpResponseBatch_appguard_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_AppGuardHttpResponseBatch_appguard_2eproto}, {
+      &scc_info_AppGuardHttpResponse_appguard_2eproto.base,}};
+
 static void InitDefaultsscc_info_AppGuardIpInfo_appguard_2eproto() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
 
@@ -188,6 +288,21 @@ static void InitDefaultsscc_info_AppGuardResponse_appguard_2eproto() {
 ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_AppGuardResponse_appguard_2eproto =
     {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_AppGuardResponse_appguard_2eproto}, {}};
 
+static void InitDefaultsscc_info_AppGuardResponseBatch_appguard_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::appguard::_AppGuardResponseBatch_default_instance_;
+    new (ptr) ::appguard::AppGuardResponseBatch();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::appguard::AppGuardResponseBatch::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_AppGuardResponseBatch_appguard_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_AppGuardResponseBatch_appguard_2eproto}, {
+      &scc_info_AppGuardResponse_appguard_2eproto.base,}};
+
 static void InitDefaultsscc_info_AppGuardSmtpRequest_appguard_2eproto() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
 
@@ -246,6 +361,21 @@ static void InitDefaultsscc_info_AppGuardTcpConnection_appguard_2eproto() {
 ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_AppGuardTcpConnection_appguard_2eproto =
     {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_AppGuardTcpConnection_appguard_2eproto}, {}};
 
+static void InitDefaultsscc_info_AppGuardTcpConnectionBatch_appguard_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::appguard::_AppGuardTcpConnectionBatch_default_instance_;
+    new (ptr) ::appguard::AppGuardTcpConnectionBatch();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::appguard::AppGuardTcpConnectionBatch::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_AppGuardTcpConnectionBatch_appguard_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_AppGuardTcpConnectionBatch_appguard_2eproto}, {
+      &scc_info_AppGuardTcpConnection_appguard_2eproto.base,}};
+
 static void InitDefaultsscc_info_AppGuardTcpInfo_appguard_2eproto() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
 
@@ -277,6 +407,21 @@ static void InitDefaultsscc_info_AppGuardTcpResponse_appguard_2eproto() {
     {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_AppGuardTcpResponse_appguard_2eproto}, {
       &scc_info_AppGuardTcpInfo_appguard_2eproto.base,}};
 
+static void InitDefaultsscc_info_AppGuardTcpResponseBatch_appguard_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::appguard::_AppGuardTcpResponseBatch_default_instance_;
+    new (ptr) ::appguard::AppGuardTcpResponseBatch();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::appguard::AppGuardTcpResponseBatch::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_AppGuardTcpResponseBatch_appguard_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_AppGuardTcpResponseBatch_appguard_2eproto}, {
+      &scc_info_AppGuardTcpResponse_appguard_2eproto.base,}};
+
 static void InitDefaultsscc_info_Log_appguard_2eproto() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
 
@@ -320,7 +465,7 @@ static void InitDefaultsscc_info_Token_appguard_2eproto() {
 ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Token_appguard_2eproto =
     {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Token_appguard_2eproto}, {}};
 
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_appguard_2eproto[16];
+static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_appguard_2eproto[23];
 static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_appguard_2eproto = nullptr;
 static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_appguard_2eproto = nullptr;
 
@@ -489,6 +634,59 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_appguard_2eproto::offsets[] PR
   ~0u,  // no _weak_field_map_
   PROTOBUF_FIELD_OFFSET(::appguard::AppGuardTcpResponse, tcp_info_),
   ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::appguard::AppGuardTcpConnectionBatch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::appguard::AppGuardTcpConnectionBatch, token_),
+  PROTOBUF_FIELD_OFFSET(::appguard::AppGuardTcpConnectionBatch, connections_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::appguard::AppGuardTcpResponseBatch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::appguard::AppGuardTcpResponseBatch, responses_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::appguard::AppGuardHttpRequestBatch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::appguard::AppGuardHttpRequestBatch, token_),
+  PROTOBUF_FIELD_OFFSET(::appguard::AppGuardHttpRequestBatch, requests_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::appguard::AppGuardHttpResponseBatch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::appguard::AppGuardHttpResponseBatch, token_),
+  PROTOBUF_FIELD_OFFSET(::appguard::AppGuardHttpResponseBatch, responses_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::appguard::AppGuardResponseBatch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::appguard::AppGuardResponseBatch, responses_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::appguard::AppGuardDecisionRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::appguard::AppGuardDecisionRequest, _oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::appguard::AppGuardDecisionRequest, id_),
+  PROTOBUF_FIELD_OFFSET(::appguard::AppGuardDecisionRequest, token_),
+  offsetof(::appguard::AppGuardDecisionRequestDefaultTypeInternal, tcp_connection_),
+  offsetof(::appguard::AppGuardDecisionRequestDefaultTypeInternal, http_request_),
+  offsetof(::appguard::AppGuardDecisionRequestDefaultTypeInternal, http_response_),
+  PROTOBUF_FIELD_OFFSET(::appguard::AppGuardDecisionRequest, payload_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::appguard::AppGuardDecisionResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::appguard::AppGuardDecisionResponse, _oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::appguard::AppGuardDecisionResponse, id_),
+  offsetof(::appguard::AppGuardDecisionResponseDefaultTypeInternal, tcp_response_),
+  offsetof(::appguard::AppGuardDecisionResponseDefaultTypeInternal, response_),
+  PROTOBUF_FIELD_OFFSET(::appguard::AppGuardDecisionResponse, payload_),
+  ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::appguard::Token, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -511,7 +709,14 @@ static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOB
   { 140, 148, sizeof(::appguard::AppGuardSmtpResponse)},
   { 151, -1, sizeof(::appguard::AppGuardResponse)},
   { 157, -1, sizeof(::appguard::AppGuardTcpResponse)},
-  { 163, -1, sizeof(::appguard::Token)},
+  { 163, -1, sizeof(::appguard::AppGuardTcpConnectionBatch)},
+  { 170, -1, sizeof(::appguard::AppGuardTcpResponseBatch)},
+  { 176, -1, sizeof(::appguard::AppGuardHttpRequestBatch)},
+  { 183, -1, sizeof(::appguard::AppGuardHttpResponseBatch)},
+  { 190, -1, sizeof(::appguard::AppGuardResponseBatch)},
+  { 196, -1, sizeof(::appguard::AppGuardDecisionRequest)},
+  { 207, -1, sizeof(::appguard::AppGuardDecisionResponse)},
+  { 216, -1, sizeof(::appguard::Token)},
 };
 
 static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
@@ -530,6 +735,13 @@ static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] =
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::appguard::_AppGuardSmtpResponse_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::appguard::_AppGuardResponse_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::appguard::_AppGuardTcpResponse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::appguard::_AppGuardTcpConnectionBatch_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::appguard::_AppGuardTcpResponseBatch_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::appguard::_AppGuardHttpRequestBatch_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::appguard::_AppGuardHttpResponseBatch_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::appguard::_AppGuardResponseBatch_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::appguard::_AppGuardDecisionRequest_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::appguard::_AppGuardDecisionResponse_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::appguard::_Token_default_instance_),
 };
 
@@ -581,53 +793,90 @@ const char descriptor_table_protodef_appguard_2eproto[] PROTOBUF_SECTION_VARIABL
   "dResponse\0221\n\006policy\030\002 \001(\0162!.appguard_com"
   "mands.FirewallPolicy\"B\n\023AppGuardTcpRespo"
   "nse\022+\n\010tcp_info\030\001 \001(\0132\031.appguard.AppGuar"
-  "dTcpInfo\"\026\n\005Token\022\r\n\005token\030\001 \001(\t2\206\005\n\010App"
-  "Guard\022X\n\016ControlChannel\022 .appguard_comma"
-  "nds.ClientMessage\032 .appguard_commands.Se"
-  "rverMessage(\0010\001\0224\n\nHandleLogs\022\016.appguard"
-  ".Logs\032\026.google.protobuf.Empty\022U\n\023HandleT"
-  "cpConnection\022\037.appguard.AppGuardTcpConne"
-  "ction\032\035.appguard.AppGuardTcpResponse\022N\n\021"
-  "HandleHttpRequest\022\035.appguard.AppGuardHtt"
-  "pRequest\032\032.appguard.AppGuardResponse\022P\n\022"
-  "HandleHttpResponse\022\036.appguard.AppGuardHt"
-  "tpResponse\032\032.appguard.AppGuardResponse\022N"
-  "\n\021HandleSmtpRequest\022\035.appguard.AppGuardS"
-  "mtpRequest\032\032.appguard.AppGuardResponse\022P"
-  "\n\022HandleSmtpResponse\022\036.appguard.AppGuard"
-  "SmtpResponse\032\032.appguard.AppGuardResponse"
-  "\022O\n\027FirewallDefaultsRequest\022\017.appguard.T"
-  "oken\032#.appguard_commands.FirewallDefault"
-  "sb\006proto3"
+  "dTcpInfo\"a\n\032AppGuardTcpConnectionBatch\022\r"
+  "\n\005token\030\001 \001(\t\0224\n\013connections\030\002 \003(\0132\037.app"
+  "guard.AppGuardTcpConnection\"L\n\030AppGuardT"
+  "cpResponseBatch\0220\n\tresponses\030\001 \003(\0132\035.app"
+  "guard.AppGuardTcpResponse\"Z\n\030AppGuardHtt"
+  "pRequestBatch\022\r\n\005token\030\001 \001(\t\022/\n\010requests"
+  "\030\002 \003(\0132\035.appguard.AppGuardHttpRequest\"]\n"
+  "\031AppGuardHttpResponseBatch\022\r\n\005token\030\001 \001("
+  "\t\0221\n\tresponses\030\002 \003(\0132\036.appguard.AppGuard"
+  "HttpResponse\"F\n\025AppGuardResponseBatch\022-\n"
+  "\tresponses\030\001 \003(\0132\032.appguard.AppGuardResp"
+  "onse\"\352\001\n\027AppGuardDecisionRequest\022\n\n\002id\030\001"
+  " \001(\004\022\r\n\005token\030\002 \001(\t\0229\n\016tcp_connection\030\003 "
+  "\001(\0132\037.appguard.AppGuardTcpConnectionH\000\0225"
+  "\n\014http_request\030\004 \001(\0132\035.appguard.AppGuard"
+  "HttpRequestH\000\0227\n\rhttp_response\030\005 \001(\0132\036.a"
+  "ppguard.AppGuardHttpResponseH\000B\t\n\007payloa"
+  "d\"\230\001\n\030AppGuardDecisionResponse\022\n\n\002id\030\001 \001"
+  "(\004\0225\n\014tcp_response\030\002 \001(\0132\035.appguard.AppG"
+  "uardTcpResponseH\000\022.\n\010response\030\003 \001(\0132\032.ap"
+  "pguard.AppGuardResponseH\000B\t\n\007payload\"\026\n\005"
+  "Token\022\r\n\005token\030\001 \001(\t2\211\010\n\010AppGuard\022X\n\016Con"
+  "trolChannel\022 .appguard_commands.ClientMe"
+  "ssage\032 .appguard_commands.ServerMessage("
+  "\0010\001\0224\n\nHandleLogs\022\016.appguard.Logs\032\026.goog"
+  "le.protobuf.Empty\022U\n\023HandleTcpConnection"
+  "\022\037.appguard.AppGuardTcpConnection\032\035.appg"
+  "uard.AppGuardTcpResponse\022N\n\021HandleHttpRe"
+  "quest\022\035.appguard.AppGuardHttpRequest\032\032.a"
+  "ppguard.AppGuardResponse\022P\n\022HandleHttpRe"
+  "sponse\022\036.appguard.AppGuardHttpResponse\032\032"
+  ".appguard.AppGuardResponse\022[\n\016DecisionSt"
+  "ream\022!.appguard.AppGuardDecisionRequest\032"
+  "\".appguard.AppGuardDecisionResponse(\0010\001\022"
+  "d\n\030HandleTcpConnectionBatch\022$.appguard.A"
+  "ppGuardTcpConnectionBatch\032\".appguard.App"
+  "GuardTcpResponseBatch\022]\n\026HandleHttpReque"
+  "stBatch\022\".appguard.AppGuardHttpRequestBa"
+  "tch\032\037.appguard.AppGuardResponseBatch\022_\n\027"
+  "HandleHttpResponseBatch\022#.appguard.AppGu"
+  "ardHttpResponseBatch\032\037.appguard.AppGuard"
+  "ResponseBatch\022N\n\021HandleSmtpRequest\022\035.app"
+  "guard.AppGuardSmtpRequest\032\032.appguard.App"
+  "GuardResponse\022P\n\022HandleSmtpResponse\022\036.ap"
+  "pguard.AppGuardSmtpResponse\032\032.appguard.A"
+  "ppGuardResponse\022O\n\027FirewallDefaultsReque"
+  "st\022\017.appguard.Token\032#.appguard_commands."
+  "FirewallDefaultsb\006proto3"
   ;
 static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_appguard_2eproto_deps[2] = {
   &::descriptor_table_commands_2eproto,
   &::descriptor_table_google_2fprotobuf_2fempty_2eproto,
 };
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_appguard_2eproto_sccs[16] = {
+static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_appguard_2eproto_sccs[23] = {
+  &scc_info_AppGuardDecisionRequest_appguard_2eproto.base,
+  &scc_info_AppGuardDecisionResponse_appguard_2eproto.base,
   &scc_info_AppGuardHttpRequest_appguard_2eproto.base,
   &scc_info_AppGuardHttpRequest_HeadersEntry_DoNotUse_appguard_2eproto.base,
   &scc_info_AppGuardHttpRequest_QueryEntry_DoNotUse_appguard_2eproto.base,
+  &scc_info_AppGuardHttpRequestBatch_appguard_2eproto.base,
   &scc_info_AppGuardHttpResponse_appguard_2eproto.base,
   &scc_info_AppGuardHttpResponse_HeadersEntry_DoNotUse_appguard_2eproto.base,
+  &scc_info_AppGuardHttpResponseBatch_appguard_2eproto.base,
   &scc_info_AppGuardIpInfo_appguard_2eproto.base,
   &scc_info_AppGuardResponse_appguard_2eproto.base,
+  &scc_info_AppGuardResponseBatch_appguard_2eproto.base,
   &scc_info_AppGuardSmtpRequest_appguard_2eproto.base,
   &scc_info_AppGuardSmtpRequest_HeadersEntry_DoNotUse_appguard_2eproto.base,
   &scc_info_AppGuardSmtpResponse_appguard_2eproto.base,
   &scc_info_AppGuardTcpConnection_appguard_2eproto.base,
+  &scc_info_AppGuardTcpConnectionBatch_appguard_2eproto.base,
   &scc_info_AppGuardTcpInfo_appguard_2eproto.base,
   &scc_info_AppGuardTcpResponse_appguard_2eproto.base,
+  &scc_info_AppGuardTcpResponseBatch_appguard_2eproto.base,
   &scc_info_Log_appguard_2eproto.base,
   &scc_info_Logs_appguard_2eproto.base,
   &scc_info_Token_appguard_2eproto.base,
 };
 static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_appguard_2eproto_once;
 const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_appguard_2eproto = {
-  false, false, descriptor_table_protodef_appguard_2eproto, "appguard.proto", 2569,
-  &descriptor_table_appguard_2eproto_once, descriptor_table_appguard_2eproto_sccs, descriptor_table_appguard_2eproto_deps, 16, 2,
+  false, false, descriptor_table_protodef_appguard_2eproto, "appguard.proto", 3784,
+  &descriptor_table_appguard_2eproto_once, descriptor_table_appguard_2eproto_sccs, descriptor_table_appguard_2eproto_deps, 23, 2,
   schemas, file_default_instances, TableStruct_appguard_2eproto::offsets,
-  file_level_metadata_appguard_2eproto, 16, file_level_enum_descriptors_appguard_2eproto, file_level_service_descriptors_appguard_2eproto,
+  file_level_metadata_appguard_2eproto, 23, file_level_enum_descriptors_appguard_2eproto, file_level_service_descriptors_appguard_2eproto,
 };
 
 // Force running AddDescriptors() at dynamic initialization time.
@@ -4473,71 +4722,74 @@ void AppGuardTcpResponse::InternalSwap(AppGuardTcpResponse* other) {
 
 // ===================================================================
 
-void Token::InitAsDefaultInstance() {
+void AppGuardTcpConnectionBatch::InitAsDefaultInstance() {
 }
-class Token::_Internal {
+class AppGuardTcpConnectionBatch::_Internal {
  public:
 };
 
-Token::Token(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+AppGuardTcpConnectionBatch::AppGuardTcpConnectionBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  connections_(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:appguard.Token)
+  // @@protoc_insertion_point(arena_constructor:appguard.AppGuardTcpConnectionBatch)
 }
-Token::Token(const Token& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
+AppGuardTcpConnectionBatch::AppGuardTcpConnectionBatch(const AppGuardTcpConnectionBatch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      connections_(from.connections_) {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   token_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   if (!from._internal_token().empty()) {
     token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_token(),
       GetArena());
   }
-  // @@protoc_insertion_point(copy_constructor:appguard.Token)
+  // @@protoc_insertion_point(copy_constructor:appguard.AppGuardTcpConnectionBatch)
 }
 
-void Token::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Token_appguard_2eproto.base);
+void AppGuardTcpConnectionBatch::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_AppGuardTcpConnectionBatch_appguard_2eproto.base);
   token_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
 
-Token::~Token() {
-  // @@protoc_insertion_point(destructor:appguard.Token)
+AppGuardTcpConnectionBatch::~AppGuardTcpConnectionBatch() {
+  // @@protoc_insertion_point(destructor:appguard.AppGuardTcpConnectionBatch)
   SharedDtor();
   _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void Token::SharedDtor() {
+void AppGuardTcpConnectionBatch::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
   token_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
 
-void Token::ArenaDtor(void* object) {
-  Token* _this = reinterpret_cast< Token* >(object);
+void AppGuardTcpConnectionBatch::ArenaDtor(void* object) {
+  AppGuardTcpConnectionBatch* _this = reinterpret_cast< AppGuardTcpConnectionBatch* >(object);
   (void)_this;
 }
-void Token::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void AppGuardTcpConnectionBatch::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-void Token::SetCachedSize(int size) const {
+void AppGuardTcpConnectionBatch::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const Token& Token::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Token_appguard_2eproto.base);
+const AppGuardTcpConnectionBatch& AppGuardTcpConnectionBatch::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_AppGuardTcpConnectionBatch_appguard_2eproto.base);
   return *internal_default_instance();
 }
 
 
-void Token::Clear() {
-// @@protoc_insertion_point(message_clear_start:appguard.Token)
+void AppGuardTcpConnectionBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:appguard.AppGuardTcpConnectionBatch)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  connections_.Clear();
   token_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Token::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* AppGuardTcpConnectionBatch::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
@@ -4550,10 +4802,22 @@ const char* Token::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::inte
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
           auto str = _internal_mutable_token();
           ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "appguard.Token.token"));
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "appguard.AppGuardTcpConnectionBatch.token"));
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
+      // repeated .appguard.AppGuardTcpConnection connections = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_connections(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else goto handle_unusual;
+        continue;
       default: {
       handle_unusual:
         if ((tag & 7) == 4 || tag == 0) {
@@ -4576,9 +4840,9 @@ failure:
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Token::_InternalSerialize(
+::PROTOBUF_NAMESPACE_ID::uint8* AppGuardTcpConnectionBatch::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:appguard.Token)
+  // @@protoc_insertion_point(serialize_to_array_start:appguard.AppGuardTcpConnectionBatch)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -4587,27 +4851,42 @@ failure:
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_token().data(), static_cast<int>(this->_internal_token().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "appguard.Token.token");
+      "appguard.AppGuardTcpConnectionBatch.token");
     target = stream->WriteStringMaybeAliased(
         1, this->_internal_token(), target);
   }
 
+  // repeated .appguard.AppGuardTcpConnection connections = 2;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_connections_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, this->_internal_connections(i), target, stream);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:appguard.Token)
+  // @@protoc_insertion_point(serialize_to_array_end:appguard.AppGuardTcpConnectionBatch)
   return target;
 }
 
-size_t Token::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:appguard.Token)
+size_t AppGuardTcpConnectionBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:appguard.AppGuardTcpConnectionBatch)
   size_t total_size = 0;
 
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  // repeated .appguard.AppGuardTcpConnection connections = 2;
+  total_size += 1UL * this->_internal_connections_size();
+  for (const auto& msg : this->connections_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
   // string token = 1;
   if (this->token().size() > 0) {
     total_size += 1 +
@@ -4624,109 +4903,2021 @@ size_t Token::ByteSizeLong() const {
   return total_size;
 }
 
-void Token::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:appguard.Token)
+void AppGuardTcpConnectionBatch::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:appguard.AppGuardTcpConnectionBatch)
   GOOGLE_DCHECK_NE(&from, this);
-  const Token* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Token>(
+  const AppGuardTcpConnectionBatch* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<AppGuardTcpConnectionBatch>(
           &from);
   if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:appguard.Token)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:appguard.AppGuardTcpConnectionBatch)
     ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:appguard.Token)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:appguard.AppGuardTcpConnectionBatch)
     MergeFrom(*source);
   }
 }
 
-void Token::MergeFrom(const Token& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:appguard.Token)
+void AppGuardTcpConnectionBatch::MergeFrom(const AppGuardTcpConnectionBatch& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:appguard.AppGuardTcpConnectionBatch)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
+  connections_.MergeFrom(from.connections_);
   if (from.token().size() > 0) {
     _internal_set_token(from._internal_token());
   }
 }
 
-void Token::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:appguard.Token)
+void AppGuardTcpConnectionBatch::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:appguard.AppGuardTcpConnectionBatch)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void Token::CopyFrom(const Token& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:appguard.Token)
+void AppGuardTcpConnectionBatch::CopyFrom(const AppGuardTcpConnectionBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:appguard.AppGuardTcpConnectionBatch)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Token::IsInitialized() const {
+bool AppGuardTcpConnectionBatch::IsInitialized() const {
   return true;
 }
 
-void Token::InternalSwap(Token* other) {
+void AppGuardTcpConnectionBatch::InternalSwap(AppGuardTcpConnectionBatch* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  connections_.InternalSwap(&other->connections_);
   token_.Swap(&other->token_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata Token::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata AppGuardTcpConnectionBatch::GetMetadata() const {
   return GetMetadataStatic();
 }
 
 
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace appguard
-PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::appguard::Logs* Arena::CreateMaybeMessage< ::appguard::Logs >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::appguard::Logs >(arena);
-}
-template<> PROTOBUF_NOINLINE ::appguard::Log* Arena::CreateMaybeMessage< ::appguard::Log >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::appguard::Log >(arena);
-}
-template<> PROTOBUF_NOINLINE ::appguard::AppGuardTcpConnection* Arena::CreateMaybeMessage< ::appguard::AppGuardTcpConnection >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::appguard::AppGuardTcpConnection >(arena);
+// ===================================================================
+
+void AppGuardTcpResponseBatch::InitAsDefaultInstance() {
 }
-template<> PROTOBUF_NOINLINE ::appguard::AppGuardIpInfo* Arena::CreateMaybeMessage< ::appguard::AppGuardIpInfo >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::appguard::AppGuardIpInfo >(arena);
+class AppGuardTcpResponseBatch::_Internal {
+ public:
+};
+
+AppGuardTcpResponseBatch::AppGuardTcpResponseBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  responses_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:appguard.AppGuardTcpResponseBatch)
 }
-template<> PROTOBUF_NOINLINE ::appguard::AppGuardTcpInfo* Arena::CreateMaybeMessage< ::appguard::AppGuardTcpInfo >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::appguard::AppGuardTcpInfo >(arena);
+AppGuardTcpResponseBatch::AppGuardTcpResponseBatch(const AppGuardTcpResponseBatch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      responses_(from.responses_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:appguard.AppGuardTcpResponseBatch)
 }
-template<> PROTOBUF_NOINLINE ::appguard::AppGuardHttpRequest_HeadersEntry_DoNotUse* Arena::CreateMaybeMessage< ::appguard::AppGuardHttpRequest_HeadersEntry_DoNotUse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::appguard::AppGuardHttpRequest_HeadersEntry_DoNotUse >(arena);
+
+void AppGuardTcpResponseBatch::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_AppGuardTcpResponseBatch_appguard_2eproto.base);
 }
-template<> PROTOBUF_NOINLINE ::appguard::AppGuardHttpRequest_QueryEntry_DoNotUse* Arena::CreateMaybeMessage< ::appguard::AppGuardHttpRequest_QueryEntry_DoNotUse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::appguard::AppGuardHttpRequest_QueryEntry_DoNotUse >(arena);
+
+AppGuardTcpResponseBatch::~AppGuardTcpResponseBatch() {
+  // @@protoc_insertion_point(destructor:appguard.AppGuardTcpResponseBatch)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
-template<> PROTOBUF_NOINLINE ::appguard::AppGuardHttpRequest* Arena::CreateMaybeMessage< ::appguard::AppGuardHttpRequest >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::appguard::AppGuardHttpRequest >(arena);
+
+void AppGuardTcpResponseBatch::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
 }
-template<> PROTOBUF_NOINLINE ::appguard::AppGuardHttpResponse_HeadersEntry_DoNotUse* Arena::CreateMaybeMessage< ::appguard::AppGuardHttpResponse_HeadersEntry_DoNotUse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::appguard::AppGuardHttpResponse_HeadersEntry_DoNotUse >(arena);
+
+void AppGuardTcpResponseBatch::ArenaDtor(void* object) {
+  AppGuardTcpResponseBatch* _this = reinterpret_cast< AppGuardTcpResponseBatch* >(object);
+  (void)_this;
 }
-template<> PROTOBUF_NOINLINE ::appguard::AppGuardHttpResponse* Arena::CreateMaybeMessage< ::appguard::AppGuardHttpResponse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::appguard::AppGuardHttpResponse >(arena);
+void AppGuardTcpResponseBatch::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-template<> PROTOBUF_NOINLINE ::appguard::AppGuardSmtpRequest_HeadersEntry_DoNotUse* Arena::CreateMaybeMessage< ::appguard::AppGuardSmtpRequest_HeadersEntry_DoNotUse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::appguard::AppGuardSmtpRequest_HeadersEntry_DoNotUse >(arena);
+void AppGuardTcpResponseBatch::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
 }
-template<> PROTOBUF_NOINLINE ::appguard::AppGuardSmtpRequest* Arena::CreateMaybeMessage< ::appguard::AppGuardSmtpRequest >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::appguard::AppGuardSmtpRequest >(arena);
+const AppGuardTcpResponseBatch& AppGuardTcpResponseBatch::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_AppGuardTcpResponseBatch_appguard_2eproto.base);
+  return *internal_default_instance();
 }
-template<> PROTOBUF_NOINLINE ::appguard::AppGuardSmtpResponse* Arena::CreateMaybeMessage< ::appguard::AppGuardSmtpResponse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::appguard::AppGuardSmtpResponse >(arena);
+
+
+void AppGuardTcpResponseBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:appguard.AppGuardTcpResponseBatch)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  responses_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
-template<> PROTOBUF_NOINLINE ::appguard::AppGuardResponse* Arena::CreateMaybeMessage< ::appguard::AppGuardResponse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::appguard::AppGuardResponse >(arena);
+
+const char* AppGuardTcpResponseBatch::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // repeated .appguard.AppGuardTcpResponse responses = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_responses(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
 }
-template<> PROTOBUF_NOINLINE ::appguard::AppGuardTcpResponse* Arena::CreateMaybeMessage< ::appguard::AppGuardTcpResponse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::appguard::AppGuardTcpResponse >(arena);
+
+::PROTOBUF_NAMESPACE_ID::uint8* AppGuardTcpResponseBatch::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:appguard.AppGuardTcpResponseBatch)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .appguard.AppGuardTcpResponse responses = 1;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_responses_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, this->_internal_responses(i), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:appguard.AppGuardTcpResponseBatch)
+  return target;
+}
+
+size_t AppGuardTcpResponseBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:appguard.AppGuardTcpResponseBatch)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .appguard.AppGuardTcpResponse responses = 1;
+  total_size += 1UL * this->_internal_responses_size();
+  for (const auto& msg : this->responses_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void AppGuardTcpResponseBatch::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:appguard.AppGuardTcpResponseBatch)
+  GOOGLE_DCHECK_NE(&from, this);
+  const AppGuardTcpResponseBatch* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<AppGuardTcpResponseBatch>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:appguard.AppGuardTcpResponseBatch)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:appguard.AppGuardTcpResponseBatch)
+    MergeFrom(*source);
+  }
+}
+
+void AppGuardTcpResponseBatch::MergeFrom(const AppGuardTcpResponseBatch& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:appguard.AppGuardTcpResponseBatch)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  responses_.MergeFrom(from.responses_);
+}
+
+void AppGuardTcpResponseBatch::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:appguard.AppGuardTcpResponseBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void AppGuardTcpResponseBatch::CopyFrom(const AppGuardTcpResponseBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:appguard.AppGuardTcpResponseBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool AppGuardTcpResponseBatch::IsInitialized() const {
+  return true;
+}
+
+void AppGuardTcpResponseBatch::InternalSwap(AppGuardTcpResponseBatch* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  responses_.InternalSwap(&other->responses_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata AppGuardTcpResponseBatch::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void AppGuardHttpRequestBatch::InitAsDefaultInstance() {
+}
+class AppGuardHttpRequestBatch::_Internal {
+ public:
+};
+
+AppGuardHttpRequestBatch::AppGuardHttpRequestBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  requests_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:appguard.AppGuardHttpRequestBatch)
+}
+AppGuardHttpRequestBatch::AppGuardHttpRequestBatch(const AppGuardHttpRequestBatch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      requests_(from.requests_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  token_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_token().empty()) {
+    token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_token(),
+      GetArena());
+  }
+  // @@protoc_insertion_point(copy_constructor:appguard.AppGuardHttpRequestBatch)
+}
+
+void AppGuardHttpRequestBatch::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_AppGuardHttpRequestBatch_appguard_2eproto.base);
+  token_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+AppGuardHttpRequestBatch::~AppGuardHttpRequestBatch() {
+  // @@protoc_insertion_point(destructor:appguard.AppGuardHttpRequestBatch)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void AppGuardHttpRequestBatch::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  token_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+void AppGuardHttpRequestBatch::ArenaDtor(void* object) {
+  AppGuardHttpRequestBatch* _this = reinterpret_cast< AppGuardHttpRequestBatch* >(object);
+  (void)_this;
+}
+void AppGuardHttpRequestBatch::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void AppGuardHttpRequestBatch::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const AppGuardHttpRequestBatch& AppGuardHttpRequestBatch::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_AppGuardHttpRequestBatch_appguard_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void AppGuardHttpRequestBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:appguard.AppGuardHttpRequestBatch)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  requests_.Clear();
+  token_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* AppGuardHttpRequestBatch::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // string token = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          auto str = _internal_mutable_token();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "appguard.AppGuardHttpRequestBatch.token"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated .appguard.AppGuardHttpRequest requests = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_requests(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* AppGuardHttpRequestBatch::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:appguard.AppGuardHttpRequestBatch)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string token = 1;
+  if (this->token().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_token().data(), static_cast<int>(this->_internal_token().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "appguard.AppGuardHttpRequestBatch.token");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_token(), target);
+  }
+
+  // repeated .appguard.AppGuardHttpRequest requests = 2;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_requests_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, this->_internal_requests(i), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:appguard.AppGuardHttpRequestBatch)
+  return target;
+}
+
+size_t AppGuardHttpRequestBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:appguard.AppGuardHttpRequestBatch)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .appguard.AppGuardHttpRequest requests = 2;
+  total_size += 1UL * this->_internal_requests_size();
+  for (const auto& msg : this->requests_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string token = 1;
+  if (this->token().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_token());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void AppGuardHttpRequestBatch::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:appguard.AppGuardHttpRequestBatch)
+  GOOGLE_DCHECK_NE(&from, this);
+  const AppGuardHttpRequestBatch* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<AppGuardHttpRequestBatch>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:appguard.AppGuardHttpRequestBatch)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:appguard.AppGuardHttpRequestBatch)
+    MergeFrom(*source);
+  }
+}
+
+void AppGuardHttpRequestBatch::MergeFrom(const AppGuardHttpRequestBatch& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:appguard.AppGuardHttpRequestBatch)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  requests_.MergeFrom(from.requests_);
+  if (from.token().size() > 0) {
+    _internal_set_token(from._internal_token());
+  }
+}
+
+void AppGuardHttpRequestBatch::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:appguard.AppGuardHttpRequestBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void AppGuardHttpRequestBatch::CopyFrom(const AppGuardHttpRequestBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:appguard.AppGuardHttpRequestBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool AppGuardHttpRequestBatch::IsInitialized() const {
+  return true;
+}
+
+void AppGuardHttpRequestBatch::InternalSwap(AppGuardHttpRequestBatch* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  requests_.InternalSwap(&other->requests_);
+  token_.Swap(&other->token_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata AppGuardHttpRequestBatch::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void AppGuardHttpResponseBatch::InitAsDefaultInstance() {
+}
+class AppGuardHttpResponseBatch::_Internal {
+ public:
+};
+
+AppGuardHttpResponseBatch::AppGuardHttpResponseBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  responses_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:appguard.AppGuardHttpResponseBatch)
+}
+AppGuardHttpResponseBatch::AppGuardHttpResponseBatch(const AppGuardHttpResponseBatch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      responses_(from.responses_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  token_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_token().empty()) {
+    token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_token(),
+      GetArena());
+  }
+  // @@protoc_insertion_point(copy_constructor:appguard.AppGuardHttpResponseBatch)
+}
+
+void AppGuardHttpResponseBatch::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_AppGuardHttpResponseBatch_appguard_2eproto.base);
+  token_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+AppGuardHttpResponseBatch::~AppGuardHttpResponseBatch() {
+  // @@protoc_insertion_point(destructor:appguard.AppGuardHttpResponseBatch)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void AppGuardHttpResponseBatch::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  token_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+void AppGuardHttpResponseBatch::ArenaDtor(void* object) {
+  AppGuardHttpResponseBatch* _this = reinterpret_cast< AppGuardHttpResponseBatch* >(object);
+  (void)_this;
+}
+void AppGuardHttpResponseBatch::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void AppGuardHttpResponseBatch::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const AppGuardHttpResponseBatch& AppGuardHttpResponseBatch::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_AppGuardHttpResponseBatch_appguard_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void AppGuardHttpResponseBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:appguard.AppGuardHttpResponseBatch)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  responses_.Clear();
+  token_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* AppGuardHttpResponseBatch::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // string token = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          auto str = _internal_mutable_token();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "appguard.AppGuardHttpResponseBatch.token"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated .appguard.AppGuardHttpResponse responses = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_responses(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* AppGuardHttpResponseBatch::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:appguard.AppGuardHttpResponseBatch)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string token = 1;
+  if (this->token().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_token().data(), static_cast<int>(this->_internal_token().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "appguard.AppGuardHttpResponseBatch.token");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_token(), target);
+  }
+
+  // repeated .appguard.AppGuardHttpResponse responses = 2;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_responses_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, this->_internal_responses(i), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:appguard.AppGuardHttpResponseBatch)
+  return target;
+}
+
+size_t AppGuardHttpResponseBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:appguard.AppGuardHttpResponseBatch)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .appguard.AppGuardHttpResponse responses = 2;
+  total_size += 1UL * this->_internal_responses_size();
+  for (const auto& msg : this->responses_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string token = 1;
+  if (this->token().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_token());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void AppGuardHttpResponseBatch::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:appguard.AppGuardHttpResponseBatch)
+  GOOGLE_DCHECK_NE(&from, this);
+  const AppGuardHttpResponseBatch* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<AppGuardHttpResponseBatch>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:appguard.AppGuardHttpResponseBatch)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:appguard.AppGuardHttpResponseBatch)
+    MergeFrom(*source);
+  }
+}
+
+void AppGuardHttpResponseBatch::MergeFrom(const AppGuardHttpResponseBatch& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:appguard.AppGuardHttpResponseBatch)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  responses_.MergeFrom(from.responses_);
+  if (from.token().size() > 0) {
+    _internal_set_token(from._internal_token());
+  }
+}
+
+void AppGuardHttpResponseBatch::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:appguard.AppGuardHttpResponseBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void AppGuardHttpResponseBatch::CopyFrom(const AppGuardHttpResponseBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:appguard.AppGuardHttpResponseBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool AppGuardHttpResponseBatch::IsInitialized() const {
+  return true;
+}
+
+void AppGuardHttpResponseBatch::InternalSwap(AppGuardHttpResponseBatch* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  responses_.InternalSwap(&other->responses_);
+  token_.Swap(&other->token_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata AppGuardHttpResponseBatch::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void AppGuardResponseBatch::InitAsDefaultInstance() {
+}
+class AppGuardResponseBatch::_Internal {
+ public:
+};
+
+AppGuardResponseBatch::AppGuardResponseBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  responses_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:appguard.AppGuardResponseBatch)
+}
+AppGuardResponseBatch::AppGuardResponseBatch(const AppGuardResponseBatch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      responses_(from.responses_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:appguard.AppGuardResponseBatch)
+}
+
+void AppGuardResponseBatch::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_AppGuardResponseBatch_appguard_2eproto.base);
+}
+
+AppGuardResponseBatch::~AppGuardResponseBatch() {
+  // @@protoc_insertion_point(destructor:appguard.AppGuardResponseBatch)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void AppGuardResponseBatch::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void AppGuardResponseBatch::ArenaDtor(void* object) {
+  AppGuardResponseBatch* _this = reinterpret_cast< AppGuardResponseBatch* >(object);
+  (void)_this;
+}
+void AppGuardResponseBatch::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void AppGuardResponseBatch::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const AppGuardResponseBatch& AppGuardResponseBatch::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_AppGuardResponseBatch_appguard_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void AppGuardResponseBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:appguard.AppGuardResponseBatch)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  responses_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* AppGuardResponseBatch::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // repeated .appguard.AppGuardResponse responses = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_responses(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* AppGuardResponseBatch::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:appguard.AppGuardResponseBatch)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .appguard.AppGuardResponse responses = 1;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_responses_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, this->_internal_responses(i), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:appguard.AppGuardResponseBatch)
+  return target;
+}
+
+size_t AppGuardResponseBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:appguard.AppGuardResponseBatch)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .appguard.AppGuardResponse responses = 1;
+  total_size += 1UL * this->_internal_responses_size();
+  for (const auto& msg : this->responses_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void AppGuardResponseBatch::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:appguard.AppGuardResponseBatch)
+  GOOGLE_DCHECK_NE(&from, this);
+  const AppGuardResponseBatch* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<AppGuardResponseBatch>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:appguard.AppGuardResponseBatch)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:appguard.AppGuardResponseBatch)
+    MergeFrom(*source);
+  }
+}
+
+void AppGuardResponseBatch::MergeFrom(const AppGuardResponseBatch& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:appguard.AppGuardResponseBatch)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  responses_.MergeFrom(from.responses_);
+}
+
+void AppGuardResponseBatch::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:appguard.AppGuardResponseBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void AppGuardResponseBatch::CopyFrom(const AppGuardResponseBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:appguard.AppGuardResponseBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool AppGuardResponseBatch::IsInitialized() const {
+  return true;
+}
+
+void AppGuardResponseBatch::InternalSwap(AppGuardResponseBatch* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  responses_.InternalSwap(&other->responses_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata AppGuardResponseBatch::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void AppGuardDecisionRequest::InitAsDefaultInstance() {
+  ::appguard::_AppGuardDecisionRequest_default_instance_.tcp_connection_ = const_cast< ::appguard::AppGuardTcpConnection*>(
+      ::appguard::AppGuardTcpConnection::internal_default_instance());
+  ::appguard::_AppGuardDecisionRequest_default_instance_.http_request_ = const_cast< ::appguard::AppGuardHttpRequest*>(
+      ::appguard::AppGuardHttpRequest::internal_default_instance());
+  ::appguard::_AppGuardDecisionRequest_default_instance_.http_response_ = const_cast< ::appguard::AppGuardHttpResponse*>(
+      ::appguard::AppGuardHttpResponse::internal_default_instance());
+}
+class AppGuardDecisionRequest::_Internal {
+ public:
+  static const ::appguard::AppGuardTcpConnection& tcp_connection(const AppGuardDecisionRequest* msg);
+  static const ::appguard::AppGuardHttpRequest& http_request(const AppGuardDecisionRequest* msg);
+  static const ::appguard::AppGuardHttpResponse& http_response(const AppGuardDecisionRequest* msg);
+};
+
+const ::appguard::AppGuardTcpConnection&
+AppGuardDecisionRequest::_Internal::tcp_connection(const AppGuardDecisionRequest* msg) {
+  return *msg->payload_.tcp_connection_;
+}
+const ::appguard::AppGuardHttpRequest&
+AppGuardDecisionRequest::_Internal::http_request(const AppGuardDecisionRequest* msg) {
+  return *msg->payload_.http_request_;
+}
+const ::appguard::AppGuardHttpResponse&
+AppGuardDecisionRequest::_Internal::http_response(const AppGuardDecisionRequest* msg) {
+  return *msg->payload_.http_response_;
+}
+void AppGuardDecisionRequest::set_allocated_tcp_connection(::appguard::AppGuardTcpConnection* tcp_connection) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_payload();
+  if (tcp_connection) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(tcp_connection);
+    if (message_arena != submessage_arena) {
+      tcp_connection = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, tcp_connection, submessage_arena);
+    }
+    set_has_tcp_connection();
+    payload_.tcp_connection_ = tcp_connection;
+  }
+  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardDecisionRequest.tcp_connection)
+}
+void AppGuardDecisionRequest::set_allocated_http_request(::appguard::AppGuardHttpRequest* http_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_payload();
+  if (http_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(http_request);
+    if (message_arena != submessage_arena) {
+      http_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, http_request, submessage_arena);
+    }
+    set_has_http_request();
+    payload_.http_request_ = http_request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardDecisionRequest.http_request)
+}
+void AppGuardDecisionRequest::set_allocated_http_response(::appguard::AppGuardHttpResponse* http_response) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_payload();
+  if (http_response) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(http_response);
+    if (message_arena != submessage_arena) {
+      http_response = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, http_response, submessage_arena);
+    }
+    set_has_http_response();
+    payload_.http_response_ = http_response;
+  }
+  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardDecisionRequest.http_response)
+}
+AppGuardDecisionRequest::AppGuardDecisionRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:appguard.AppGuardDecisionRequest)
+}
+AppGuardDecisionRequest::AppGuardDecisionRequest(const AppGuardDecisionRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  token_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_token().empty()) {
+    token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_token(),
+      GetArena());
+  }
+  id_ = from.id_;
+  clear_has_payload();
+  switch (from.payload_case()) {
+    case kTcpConnection: {
+      _internal_mutable_tcp_connection()->::appguard::AppGuardTcpConnection::MergeFrom(from._internal_tcp_connection());
+      break;
+    }
+    case kHttpRequest: {
+      _internal_mutable_http_request()->::appguard::AppGuardHttpRequest::MergeFrom(from._internal_http_request());
+      break;
+    }
+    case kHttpResponse: {
+      _internal_mutable_http_response()->::appguard::AppGuardHttpResponse::MergeFrom(from._internal_http_response());
+      break;
+    }
+    case PAYLOAD_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:appguard.AppGuardDecisionRequest)
+}
+
+void AppGuardDecisionRequest::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_AppGuardDecisionRequest_appguard_2eproto.base);
+  token_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  id_ = PROTOBUF_ULONGLONG(0);
+  clear_has_payload();
+}
+
+AppGuardDecisionRequest::~AppGuardDecisionRequest() {
+  // @@protoc_insertion_point(destructor:appguard.AppGuardDecisionRequest)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void AppGuardDecisionRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  token_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (has_payload()) {
+    clear_payload();
+  }
+}
+
+void AppGuardDecisionRequest::ArenaDtor(void* object) {
+  AppGuardDecisionRequest* _this = reinterpret_cast< AppGuardDecisionRequest* >(object);
+  (void)_this;
+}
+void AppGuardDecisionRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void AppGuardDecisionRequest::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const AppGuardDecisionRequest& AppGuardDecisionRequest::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_AppGuardDecisionRequest_appguard_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void AppGuardDecisionRequest::clear_payload() {
+// @@protoc_insertion_point(one_of_clear_start:appguard.AppGuardDecisionRequest)
+  switch (payload_case()) {
+    case kTcpConnection: {
+      if (GetArena() == nullptr) {
+        delete payload_.tcp_connection_;
+      }
+      break;
+    }
+    case kHttpRequest: {
+      if (GetArena() == nullptr) {
+        delete payload_.http_request_;
+      }
+      break;
+    }
+    case kHttpResponse: {
+      if (GetArena() == nullptr) {
+        delete payload_.http_response_;
+      }
+      break;
+    }
+    case PAYLOAD_NOT_SET: {
+      break;
+    }
+  }
+  _oneof_case_[0] = PAYLOAD_NOT_SET;
+}
+
+
+void AppGuardDecisionRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:appguard.AppGuardDecisionRequest)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  token_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  id_ = PROTOBUF_ULONGLONG(0);
+  clear_payload();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* AppGuardDecisionRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // uint64 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // string token = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          auto str = _internal_mutable_token();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "appguard.AppGuardDecisionRequest.token"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .appguard.AppGuardTcpConnection tcp_connection = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_tcp_connection(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .appguard.AppGuardHttpRequest http_request = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_http_request(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .appguard.AppGuardHttpResponse http_response = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_http_response(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* AppGuardDecisionRequest::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:appguard.AppGuardDecisionRequest)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 id = 1;
+  if (this->id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(1, this->_internal_id(), target);
+  }
+
+  // string token = 2;
+  if (this->token().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_token().data(), static_cast<int>(this->_internal_token().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "appguard.AppGuardDecisionRequest.token");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_token(), target);
+  }
+
+  // .appguard.AppGuardTcpConnection tcp_connection = 3;
+  if (_internal_has_tcp_connection()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        3, _Internal::tcp_connection(this), target, stream);
+  }
+
+  // .appguard.AppGuardHttpRequest http_request = 4;
+  if (_internal_has_http_request()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        4, _Internal::http_request(this), target, stream);
+  }
+
+  // .appguard.AppGuardHttpResponse http_response = 5;
+  if (_internal_has_http_response()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        5, _Internal::http_response(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:appguard.AppGuardDecisionRequest)
+  return target;
+}
+
+size_t AppGuardDecisionRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:appguard.AppGuardDecisionRequest)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string token = 2;
+  if (this->token().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_token());
+  }
+
+  // uint64 id = 1;
+  if (this->id() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+        this->_internal_id());
+  }
+
+  switch (payload_case()) {
+    // .appguard.AppGuardTcpConnection tcp_connection = 3;
+    case kTcpConnection: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *payload_.tcp_connection_);
+      break;
+    }
+    // .appguard.AppGuardHttpRequest http_request = 4;
+    case kHttpRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *payload_.http_request_);
+      break;
+    }
+    // .appguard.AppGuardHttpResponse http_response = 5;
+    case kHttpResponse: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *payload_.http_response_);
+      break;
+    }
+    case PAYLOAD_NOT_SET: {
+      break;
+    }
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void AppGuardDecisionRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:appguard.AppGuardDecisionRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  const AppGuardDecisionRequest* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<AppGuardDecisionRequest>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:appguard.AppGuardDecisionRequest)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:appguard.AppGuardDecisionRequest)
+    MergeFrom(*source);
+  }
+}
+
+void AppGuardDecisionRequest::MergeFrom(const AppGuardDecisionRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:appguard.AppGuardDecisionRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.token().size() > 0) {
+    _internal_set_token(from._internal_token());
+  }
+  if (from.id() != 0) {
+    _internal_set_id(from._internal_id());
+  }
+  switch (from.payload_case()) {
+    case kTcpConnection: {
+      _internal_mutable_tcp_connection()->::appguard::AppGuardTcpConnection::MergeFrom(from._internal_tcp_connection());
+      break;
+    }
+    case kHttpRequest: {
+      _internal_mutable_http_request()->::appguard::AppGuardHttpRequest::MergeFrom(from._internal_http_request());
+      break;
+    }
+    case kHttpResponse: {
+      _internal_mutable_http_response()->::appguard::AppGuardHttpResponse::MergeFrom(from._internal_http_response());
+      break;
+    }
+    case PAYLOAD_NOT_SET: {
+      break;
+    }
+  }
+}
+
+void AppGuardDecisionRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:appguard.AppGuardDecisionRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void AppGuardDecisionRequest::CopyFrom(const AppGuardDecisionRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:appguard.AppGuardDecisionRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool AppGuardDecisionRequest::IsInitialized() const {
+  return true;
+}
+
+void AppGuardDecisionRequest::InternalSwap(AppGuardDecisionRequest* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  token_.Swap(&other->token_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  swap(id_, other->id_);
+  swap(payload_, other->payload_);
+  swap(_oneof_case_[0], other->_oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata AppGuardDecisionRequest::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void AppGuardDecisionResponse::InitAsDefaultInstance() {
+  ::appguard::_AppGuardDecisionResponse_default_instance_.tcp_response_ = const_cast< ::appguard::AppGuardTcpResponse*>(
+      ::appguard::AppGuardTcpResponse::internal_default_instance());
+  ::appguard::_AppGuardDecisionResponse_default_instance_.response_ = const_cast< ::appguard::AppGuardResponse*>(
+      ::appguard::AppGuardResponse::internal_default_instance());
+}
+class AppGuardDecisionResponse::_Internal {
+ public:
+  static const ::appguard::AppGuardTcpResponse& tcp_response(const AppGuardDecisionResponse* msg);
+  static const ::appguard::AppGuardResponse& response(const AppGuardDecisionResponse* msg);
+};
+
+const ::appguard::AppGuardTcpResponse&
+AppGuardDecisionResponse::_Internal::tcp_response(const AppGuardDecisionResponse* msg) {
+  return *msg->payload_.tcp_response_;
+}
+const ::appguard::AppGuardResponse&
+AppGuardDecisionResponse::_Internal::response(const AppGuardDecisionResponse* msg) {
+  return *msg->payload_.response_;
+}
+void AppGuardDecisionResponse::set_allocated_tcp_response(::appguard::AppGuardTcpResponse* tcp_response) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_payload();
+  if (tcp_response) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(tcp_response);
+    if (message_arena != submessage_arena) {
+      tcp_response = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, tcp_response, submessage_arena);
+    }
+    set_has_tcp_response();
+    payload_.tcp_response_ = tcp_response;
+  }
+  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardDecisionResponse.tcp_response)
+}
+void AppGuardDecisionResponse::set_allocated_response(::appguard::AppGuardResponse* response) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_payload();
+  if (response) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(response);
+    if (message_arena != submessage_arena) {
+      response = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, response, submessage_arena);
+    }
+    set_has_response();
+    payload_.response_ = response;
+  }
+  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardDecisionResponse.response)
+}
+AppGuardDecisionResponse::AppGuardDecisionResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:appguard.AppGuardDecisionResponse)
+}
+AppGuardDecisionResponse::AppGuardDecisionResponse(const AppGuardDecisionResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  id_ = from.id_;
+  clear_has_payload();
+  switch (from.payload_case()) {
+    case kTcpResponse: {
+      _internal_mutable_tcp_response()->::appguard::AppGuardTcpResponse::MergeFrom(from._internal_tcp_response());
+      break;
+    }
+    case kResponse: {
+      _internal_mutable_response()->::appguard::AppGuardResponse::MergeFrom(from._internal_response());
+      break;
+    }
+    case PAYLOAD_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:appguard.AppGuardDecisionResponse)
+}
+
+void AppGuardDecisionResponse::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_AppGuardDecisionResponse_appguard_2eproto.base);
+  id_ = PROTOBUF_ULONGLONG(0);
+  clear_has_payload();
+}
+
+AppGuardDecisionResponse::~AppGuardDecisionResponse() {
+  // @@protoc_insertion_point(destructor:appguard.AppGuardDecisionResponse)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void AppGuardDecisionResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (has_payload()) {
+    clear_payload();
+  }
+}
+
+void AppGuardDecisionResponse::ArenaDtor(void* object) {
+  AppGuardDecisionResponse* _this = reinterpret_cast< AppGuardDecisionResponse* >(object);
+  (void)_this;
+}
+void AppGuardDecisionResponse::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void AppGuardDecisionResponse::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const AppGuardDecisionResponse& AppGuardDecisionResponse::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_AppGuardDecisionResponse_appguard_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void AppGuardDecisionResponse::clear_payload() {
+// @@protoc_insertion_point(one_of_clear_start:appguard.AppGuardDecisionResponse)
+  switch (payload_case()) {
+    case kTcpResponse: {
+      if (GetArena() == nullptr) {
+        delete payload_.tcp_response_;
+      }
+      break;
+    }
+    case kResponse: {
+      if (GetArena() == nullptr) {
+        delete payload_.response_;
+      }
+      break;
+    }
+    case PAYLOAD_NOT_SET: {
+      break;
+    }
+  }
+  _oneof_case_[0] = PAYLOAD_NOT_SET;
+}
+
+
+void AppGuardDecisionResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:appguard.AppGuardDecisionResponse)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  id_ = PROTOBUF_ULONGLONG(0);
+  clear_payload();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* AppGuardDecisionResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // uint64 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .appguard.AppGuardTcpResponse tcp_response = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_tcp_response(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .appguard.AppGuardResponse response = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_response(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* AppGuardDecisionResponse::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:appguard.AppGuardDecisionResponse)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 id = 1;
+  if (this->id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(1, this->_internal_id(), target);
+  }
+
+  // .appguard.AppGuardTcpResponse tcp_response = 2;
+  if (_internal_has_tcp_response()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        2, _Internal::tcp_response(this), target, stream);
+  }
+
+  // .appguard.AppGuardResponse response = 3;
+  if (_internal_has_response()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        3, _Internal::response(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:appguard.AppGuardDecisionResponse)
+  return target;
+}
+
+size_t AppGuardDecisionResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:appguard.AppGuardDecisionResponse)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 id = 1;
+  if (this->id() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+        this->_internal_id());
+  }
+
+  switch (payload_case()) {
+    // .appguard.AppGuardTcpResponse tcp_response = 2;
+    case kTcpResponse: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *payload_.tcp_response_);
+      break;
+    }
+    // .appguard.AppGuardResponse response = 3;
+    case kResponse: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *payload_.response_);
+      break;
+    }
+    case PAYLOAD_NOT_SET: {
+      break;
+    }
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void AppGuardDecisionResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:appguard.AppGuardDecisionResponse)
+  GOOGLE_DCHECK_NE(&from, this);
+  const AppGuardDecisionResponse* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<AppGuardDecisionResponse>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:appguard.AppGuardDecisionResponse)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:appguard.AppGuardDecisionResponse)
+    MergeFrom(*source);
+  }
+}
+
+void AppGuardDecisionResponse::MergeFrom(const AppGuardDecisionResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:appguard.AppGuardDecisionResponse)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.id() != 0) {
+    _internal_set_id(from._internal_id());
+  }
+  switch (from.payload_case()) {
+    case kTcpResponse: {
+      _internal_mutable_tcp_response()->::appguard::AppGuardTcpResponse::MergeFrom(from._internal_tcp_response());
+      break;
+    }
+    case kResponse: {
+      _internal_mutable_response()->::appguard::AppGuardResponse::MergeFrom(from._internal_response());
+      break;
+    }
+    case PAYLOAD_NOT_SET: {
+      break;
+    }
+  }
+}
+
+void AppGuardDecisionResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:appguard.AppGuardDecisionResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void AppGuardDecisionResponse::CopyFrom(const AppGuardDecisionResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:appguard.AppGuardDecisionResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool AppGuardDecisionResponse::IsInitialized() const {
+  return true;
+}
+
+void AppGuardDecisionResponse::InternalSwap(AppGuardDecisionResponse* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  swap(id_, other->id_);
+  swap(payload_, other->payload_);
+  swap(_oneof_case_[0], other->_oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata AppGuardDecisionResponse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void Token::InitAsDefaultInstance() {
+}
+class Token::_Internal {
+ public:
+};
+
+Token::Token(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:appguard.Token)
+}
+Token::Token(const Token& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  token_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_token().empty()) {
+    token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_token(),
+      GetArena());
+  }
+  // @@protoc_insertion_point(copy_constructor:appguard.Token)
+}
+
+void Token::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Token_appguard_2eproto.base);
+  token_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+Token::~Token() {
+  // @@protoc_insertion_point(destructor:appguard.Token)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void Token::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  token_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+void Token::ArenaDtor(void* object) {
+  Token* _this = reinterpret_cast< Token* >(object);
+  (void)_this;
+}
+void Token::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void Token::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const Token& Token::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Token_appguard_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void Token::Clear() {
+// @@protoc_insertion_point(message_clear_start:appguard.Token)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  token_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Token::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // string token = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          auto str = _internal_mutable_token();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "appguard.Token.token"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* Token::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:appguard.Token)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string token = 1;
+  if (this->token().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_token().data(), static_cast<int>(this->_internal_token().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "appguard.Token.token");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_token(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:appguard.Token)
+  return target;
+}
+
+size_t Token::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:appguard.Token)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string token = 1;
+  if (this->token().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_token());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void Token::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:appguard.Token)
+  GOOGLE_DCHECK_NE(&from, this);
+  const Token* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Token>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:appguard.Token)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:appguard.Token)
+    MergeFrom(*source);
+  }
+}
+
+void Token::MergeFrom(const Token& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:appguard.Token)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.token().size() > 0) {
+    _internal_set_token(from._internal_token());
+  }
+}
+
+void Token::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:appguard.Token)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void Token::CopyFrom(const Token& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:appguard.Token)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Token::IsInitialized() const {
+  return true;
+}
+
+void Token::InternalSwap(Token* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  token_.Swap(&other->token_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Token::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace appguard
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::appguard::Logs* Arena::CreateMaybeMessage< ::appguard::Logs >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::appguard::Logs >(arena);
+}
+template<> PROTOBUF_NOINLINE ::appguard::Log* Arena::CreateMaybeMessage< ::appguard::Log >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::appguard::Log >(arena);
+}
+template<> PROTOBUF_NOINLINE ::appguard::AppGuardTcpConnection* Arena::CreateMaybeMessage< ::appguard::AppGuardTcpConnection >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::appguard::AppGuardTcpConnection >(arena);
+}
+template<> PROTOBUF_NOINLINE ::appguard::AppGuardIpInfo* Arena::CreateMaybeMessage< ::appguard::AppGuardIpInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::appguard::AppGuardIpInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::appguard::AppGuardTcpInfo* Arena::CreateMaybeMessage< ::appguard::AppGuardTcpInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::appguard::AppGuardTcpInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::appguard::AppGuardHttpRequest_HeadersEntry_DoNotUse* Arena::CreateMaybeMessage< ::appguard::AppGuardHttpRequest_HeadersEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::appguard::AppGuardHttpRequest_HeadersEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::appguard::AppGuardHttpRequest_QueryEntry_DoNotUse* Arena::CreateMaybeMessage< ::appguard::AppGuardHttpRequest_QueryEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::appguard::AppGuardHttpRequest_QueryEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::appguard::AppGuardHttpRequest* Arena::CreateMaybeMessage< ::appguard::AppGuardHttpRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::appguard::AppGuardHttpRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::appguard::AppGuardHttpResponse_HeadersEntry_DoNotUse* Arena::CreateMaybeMessage< ::appguard::AppGuardHttpResponse_HeadersEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::appguard::AppGuardHttpResponse_HeadersEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::appguard::AppGuardHttpResponse* Arena::CreateMaybeMessage< ::appguard::AppGuardHttpResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::appguard::AppGuardHttpResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::appguard::AppGuardSmtpRequest_HeadersEntry_DoNotUse* Arena::CreateMaybeMessage< ::appguard::AppGuardSmtpRequest_HeadersEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::appguard::AppGuardSmtpRequest_HeadersEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::appguard::AppGuardSmtpRequest* Arena::CreateMaybeMessage< ::appguard::AppGuardSmtpRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::appguard::AppGuardSmtpRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::appguard::AppGuardSmtpResponse* Arena::CreateMaybeMessage< ::appguard::AppGuardSmtpResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::appguard::AppGuardSmtpResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::appguard::AppGuardResponse* Arena::CreateMaybeMessage< ::appguard::AppGuardResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::appguard::AppGuardResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::appguard::AppGuardTcpResponse* Arena::CreateMaybeMessage< ::appguard::AppGuardTcpResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::appguard::AppGuardTcpResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::appguard::AppGuardTcpConnectionBatch* Arena::CreateMaybeMessage< ::appguard::AppGuardTcpConnectionBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::appguard::AppGuardTcpConnectionBatch >(arena);
+}
+template<> PROTOBUF_NOINLINE ::appguard::AppGuardTcpResponseBatch* Arena::CreateMaybeMessage< ::appguard::AppGuardTcpResponseBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::appguard::AppGuardTcpResponseBatch >(arena);
+}
+template<> PROTOBUF_NOINLINE ::appguard::AppGuardHttpRequestBatch* Arena::CreateMaybeMessage< ::appguard::AppGuardHttpRequestBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::appguard::AppGuardHttpRequestBatch >(arena);
+}
+template<> PROTOBUF_NOINLINE ::appguard::AppGuardHttpResponseBatch* Arena::CreateMaybeMessage< ::appguard::AppGuardHttpResponseBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::appguard::AppGuardHttpResponseBatch >(arena);
+}
+template<> PROTOBUF_NOINLINE ::appguard::AppGuardResponseBatch* Arena::CreateMaybeMessage< ::appguard::AppGuardResponseBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::appguard::AppGuardResponseBatch >(arena);
+}
+template<> PROTOBUF_NOINLINE ::appguard::AppGuardDecisionRequest* Arena::CreateMaybeMessage< ::appguard::AppGuardDecisionRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::appguard::AppGuardDecisionRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::appguard::AppGuardDecisionResponse* Arena::CreateMaybeMessage< ::appguard::AppGuardDecisionResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::appguard::AppGuardDecisionResponse >(arena);
 }
 template<> PROTOBUF_NOINLINE ::appguard::Token* Arena::CreateMaybeMessage< ::appguard::Token >(Arena* arena) {
   return Arena::CreateMessageInternal< ::appguard::Token >(arena);
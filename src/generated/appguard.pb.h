@@ -52,7 +52,7 @@ struct TableStruct_appguard_2eproto {
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
   static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[16]
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[23]
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
   static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
   static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
@@ -60,9 +60,18 @@ struct TableStruct_appguard_2eproto {
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_appguard_2eproto;
 namespace appguard {
+class AppGuardDecisionRequest;
+class AppGuardDecisionRequestDefaultTypeInternal;
+extern AppGuardDecisionRequestDefaultTypeInternal _AppGuardDecisionRequest_default_instance_;
+class AppGuardDecisionResponse;
+class AppGuardDecisionResponseDefaultTypeInternal;
+extern AppGuardDecisionResponseDefaultTypeInternal _AppGuardDecisionResponse_default_instance_;
 class AppGuardHttpRequest;
 class AppGuardHttpRequestDefaultTypeInternal;
 extern AppGuardHttpRequestDefaultTypeInternal _AppGuardHttpRequest_default_instance_;
+class AppGuardHttpRequestBatch;
+class AppGuardHttpRequestBatchDefaultTypeInternal;
+extern AppGuardHttpRequestBatchDefaultTypeInternal _AppGuardHttpRequestBatch_default_instance_;
 class AppGuardHttpRequest_HeadersEntry_DoNotUse;
 class AppGuardHttpRequest_HeadersEntry_DoNotUseDefaultTypeInternal;
 extern AppGuardHttpRequest_HeadersEntry_DoNotUseDefaultTypeInternal _AppGuardHttpRequest_HeadersEntry_DoNotUse_default_instance_;
@@ -72,6 +81,9 @@ extern AppGuardHttpRequest_QueryEntry_DoNotUseDefaultTypeInternal _AppGuardHttpR
 class AppGuardHttpResponse;
 class AppGuardHttpResponseDefaultTypeInternal;
 extern AppGuardHttpResponseDefaultTypeInternal _AppGuardHttpResponse_default_instance_;
+class AppGuardHttpResponseBatch;
+class AppGuardHttpResponseBatchDefaultTypeInternal;
+extern AppGuardHttpResponseBatchDefaultTypeInternal _AppGuardHttpResponseBatch_default_instance_;
 class AppGuardHttpResponse_HeadersEntry_DoNotUse;
 class AppGuardHttpResponse_HeadersEntry_DoNotUseDefaultTypeInternal;
 extern AppGuardHttpResponse_HeadersEntry_DoNotUseDefaultTypeInternal _AppGuardHttpResponse_HeadersEntry_DoNotUse_default_instance_;
@@ -81,6 +93,9 @@ extern AppGuardIpInfoDefaultTypeInternal _AppGuardIpInfo_default_instance_;
 class AppGuardResponse;
 class AppGuardResponseDefaultTypeInternal;
 extern AppGuardResponseDefaultTypeInternal _AppGuardResponse_default_instance_;
+class AppGuardResponseBatch;
+class AppGuardResponseBatchDefaultTypeInternal;
+extern AppGuardResponseBatchDefaultTypeInternal _AppGuardResponseBatch_default_instance_;
 class AppGuardSmtpRequest;
 class AppGuardSmtpRequestDefaultTypeInternal;
 extern AppGuardSmtpRequestDefaultTypeInternal _AppGuardSmtpRequest_default_instance_;
@@ -93,12 +108,18 @@ extern AppGuardSmtpResponseDefaultTypeInternal _AppGuardSmtpResponse_default_ins
 class AppGuardTcpConnection;
 class AppGuardTcpConnectionDefaultTypeInternal;
 extern AppGuardTcpConnectionDefaultTypeInternal _AppGuardTcpConnection_default_instance_;
+class AppGuardTcpConnectionBatch;
+class AppGuardTcpConnectionBatchDefaultTypeInternal;
+extern AppGuardTcpConnectionBatchDefaultTypeInternal _AppGuardTcpConnectionBatch_default_instance_;
 class AppGuardTcpInfo;
 class AppGuardTcpInfoDefaultTypeInternal;
 extern AppGuardTcpInfoDefaultTypeInternal _AppGuardTcpInfo_default_instance_;
 class AppGuardTcpResponse;
 class AppGuardTcpResponseDefaultTypeInternal;
 extern AppGuardTcpResponseDefaultTypeInternal _AppGuardTcpResponse_default_instance_;
+class AppGuardTcpResponseBatch;
+class AppGuardTcpResponseBatchDefaultTypeInternal;
+extern AppGuardTcpResponseBatchDefaultTypeInternal _AppGuardTcpResponseBatch_default_instance_;
 class Log;
 class LogDefaultTypeInternal;
 extern LogDefaultTypeInternal _Log_default_instance_;
@@ -110,19 +131,26 @@ class TokenDefaultTypeInternal;
 extern TokenDefaultTypeInternal _Token_default_instance_;
 }  // namespace appguard
 PROTOBUF_NAMESPACE_OPEN
+template<> ::appguard::AppGuardDecisionRequest* Arena::CreateMaybeMessage<::appguard::AppGuardDecisionRequest>(Arena*);
+template<> ::appguard::AppGuardDecisionResponse* Arena::CreateMaybeMessage<::appguard::AppGuardDecisionResponse>(Arena*);
 template<> ::appguard::AppGuardHttpRequest* Arena::CreateMaybeMessage<::appguard::AppGuardHttpRequest>(Arena*);
+template<> ::appguard::AppGuardHttpRequestBatch* Arena::CreateMaybeMessage<::appguard::AppGuardHttpRequestBatch>(Arena*);
 template<> ::appguard::AppGuardHttpRequest_HeadersEntry_DoNotUse* Arena::CreateMaybeMessage<::appguard::AppGuardHttpRequest_HeadersEntry_DoNotUse>(Arena*);
 template<> ::appguard::AppGuardHttpRequest_QueryEntry_DoNotUse* Arena::CreateMaybeMessage<::appguard::AppGuardHttpRequest_QueryEntry_DoNotUse>(Arena*);
 template<> ::appguard::AppGuardHttpResponse* Arena::CreateMaybeMessage<::appguard::AppGuardHttpResponse>(Arena*);
+template<> ::appguard::AppGuardHttpResponseBatch* Arena::CreateMaybeMessage<::appguard::AppGuardHttpResponseBatch>(Arena*);
 template<> ::appguard::AppGuardHttpResponse_HeadersEntry_DoNotUse* Arena::CreateMaybeMessage<::appguard::AppGuardHttpResponse_HeadersEntry_DoNotUse>(Arena*);
 template<> ::appguard::AppGuardIpInfo* Arena::CreateMaybeMessage<::appguard::AppGuardIpInfo>(Arena*);
 template<> ::appguard::AppGuardResponse* Arena::CreateMaybeMessage<::appguard::AppGuardResponse>(Arena*);
+template<> ::appguard::AppGuardResponseBatch* Arena::CreateMaybeMessage<::appguard::AppGuardResponseBatch>(Arena*);
 template<> ::appguard::AppGuardSmtpRequest* Arena::CreateMaybeMessage<::appguard::AppGuardSmtpRequest>(Arena*);
 template<> ::appguard::AppGuardSmtpRequest_HeadersEntry_DoNotUse* Arena::CreateMaybeMessage<::appguard::AppGuardSmtpRequest_HeadersEntry_DoNotUse>(Arena*);
 template<> ::appguard::AppGuardSmtpResponse* Arena::CreateMaybeMessage<::appguard::AppGuardSmtpResponse>(Arena*);
 template<> ::appguard::AppGuardTcpConnection* Arena::CreateMaybeMessage<::appguard::AppGuardTcpConnection>(Arena*);
+template<> ::appguard::AppGuardTcpConnectionBatch* Arena::CreateMaybeMessage<::appguard::AppGuardTcpConnectionBatch>(Arena*);
 template<> ::appguard::AppGuardTcpInfo* Arena::CreateMaybeMessage<::appguard::AppGuardTcpInfo>(Arena*);
 template<> ::appguard::AppGuardTcpResponse* Arena::CreateMaybeMessage<::appguard::AppGuardTcpResponse>(Arena*);
+template<> ::appguard::AppGuardTcpResponseBatch* Arena::CreateMaybeMessage<::appguard::AppGuardTcpResponseBatch>(Arena*);
 template<> ::appguard::Log* Arena::CreateMaybeMessage<::appguard::Log>(Arena*);
 template<> ::appguard::Logs* Arena::CreateMaybeMessage<::appguard::Logs>(Arena*);
 template<> ::appguard::Token* Arena::CreateMaybeMessage<::appguard::Token>(Arena*);
@@ -2718,23 +2746,23 @@ class AppGuardTcpResponse PROTOBUF_FINAL :
 };
 // -------------------------------------------------------------------
 
-class Token PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:appguard.Token) */ {
+class AppGuardTcpConnectionBatch PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:appguard.AppGuardTcpConnectionBatch) */ {
  public:
-  inline Token() : Token(nullptr) {};
-  virtual ~Token();
+  inline AppGuardTcpConnectionBatch() : AppGuardTcpConnectionBatch(nullptr) {};
+  virtual ~AppGuardTcpConnectionBatch();
 
-  Token(const Token& from);
-  Token(Token&& from) noexcept
-    : Token() {
+  AppGuardTcpConnectionBatch(const AppGuardTcpConnectionBatch& from);
+  AppGuardTcpConnectionBatch(AppGuardTcpConnectionBatch&& from) noexcept
+    : AppGuardTcpConnectionBatch() {
     *this = ::std::move(from);
   }
 
-  inline Token& operator=(const Token& from) {
+  inline AppGuardTcpConnectionBatch& operator=(const AppGuardTcpConnectionBatch& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Token& operator=(Token&& from) noexcept {
+  inline AppGuardTcpConnectionBatch& operator=(AppGuardTcpConnectionBatch&& from) noexcept {
     if (GetArena() == from.GetArena()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -2752,20 +2780,20 @@ class Token PROTOBUF_FINAL :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return GetMetadataStatic().reflection;
   }
-  static const Token& default_instance();
+  static const AppGuardTcpConnectionBatch& default_instance();
 
   static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const Token* internal_default_instance() {
-    return reinterpret_cast<const Token*>(
-               &_Token_default_instance_);
+  static inline const AppGuardTcpConnectionBatch* internal_default_instance() {
+    return reinterpret_cast<const AppGuardTcpConnectionBatch*>(
+               &_AppGuardTcpConnectionBatch_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     15;
 
-  friend void swap(Token& a, Token& b) {
+  friend void swap(AppGuardTcpConnectionBatch& a, AppGuardTcpConnectionBatch& b) {
     a.Swap(&b);
   }
-  inline void Swap(Token* other) {
+  inline void Swap(AppGuardTcpConnectionBatch* other) {
     if (other == this) return;
     if (GetArena() == other->GetArena()) {
       InternalSwap(other);
@@ -2773,7 +2801,7 @@ class Token PROTOBUF_FINAL :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(Token* other) {
+  void UnsafeArenaSwap(AppGuardTcpConnectionBatch* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -2781,17 +2809,17 @@ class Token PROTOBUF_FINAL :
 
   // implements Message ----------------------------------------------
 
-  inline Token* New() const final {
-    return CreateMaybeMessage<Token>(nullptr);
+  inline AppGuardTcpConnectionBatch* New() const final {
+    return CreateMaybeMessage<AppGuardTcpConnectionBatch>(nullptr);
   }
 
-  Token* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<Token>(arena);
+  AppGuardTcpConnectionBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<AppGuardTcpConnectionBatch>(arena);
   }
   void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
   void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const Token& from);
-  void MergeFrom(const Token& from);
+  void CopyFrom(const AppGuardTcpConnectionBatch& from);
+  void MergeFrom(const AppGuardTcpConnectionBatch& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -2805,13 +2833,13 @@ class Token PROTOBUF_FINAL :
   inline void SharedCtor();
   inline void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Token* other);
+  void InternalSwap(AppGuardTcpConnectionBatch* other);
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "appguard.Token";
+    return "appguard.AppGuardTcpConnectionBatch";
   }
   protected:
-  explicit Token(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit AppGuardTcpConnectionBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   private:
   static void ArenaDtor(void* object);
   inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
@@ -2831,8 +2859,27 @@ class Token PROTOBUF_FINAL :
   // accessors -------------------------------------------------------
 
   enum : int {
+    kConnectionsFieldNumber = 2,
     kTokenFieldNumber = 1,
   };
+  // repeated .appguard.AppGuardTcpConnection connections = 2;
+  int connections_size() const;
+  private:
+  int _internal_connections_size() const;
+  public:
+  void clear_connections();
+  ::appguard::AppGuardTcpConnection* mutable_connections(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::appguard::AppGuardTcpConnection >*
+      mutable_connections();
+  private:
+  const ::appguard::AppGuardTcpConnection& _internal_connections(int index) const;
+  ::appguard::AppGuardTcpConnection* _internal_add_connections();
+  public:
+  const ::appguard::AppGuardTcpConnection& connections(int index) const;
+  ::appguard::AppGuardTcpConnection* add_connections();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::appguard::AppGuardTcpConnection >&
+      connections() const;
+
   // string token = 1;
   void clear_token();
   const std::string& token() const;
@@ -2858,1878 +2905,3807 @@ class Token PROTOBUF_FINAL :
   std::string* _internal_mutable_token();
   public:
 
-  // @@protoc_insertion_point(class_scope:appguard.Token)
+  // @@protoc_insertion_point(class_scope:appguard.AppGuardTcpConnectionBatch)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::appguard::AppGuardTcpConnection > connections_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr token_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_appguard_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
 
+class AppGuardTcpResponseBatch PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:appguard.AppGuardTcpResponseBatch) */ {
+ public:
+  inline AppGuardTcpResponseBatch() : AppGuardTcpResponseBatch(nullptr) {};
+  virtual ~AppGuardTcpResponseBatch();
 
-// ===================================================================
+  AppGuardTcpResponseBatch(const AppGuardTcpResponseBatch& from);
+  AppGuardTcpResponseBatch(AppGuardTcpResponseBatch&& from) noexcept
+    : AppGuardTcpResponseBatch() {
+    *this = ::std::move(from);
+  }
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// Logs
+  inline AppGuardTcpResponseBatch& operator=(const AppGuardTcpResponseBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AppGuardTcpResponseBatch& operator=(AppGuardTcpResponseBatch&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// string token = 1;
-inline void Logs::clear_token() {
-  token_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline const std::string& Logs::token() const {
-  // @@protoc_insertion_point(field_get:appguard.Logs.token)
-  return _internal_token();
-}
-inline void Logs::set_token(const std::string& value) {
-  _internal_set_token(value);
-  // @@protoc_insertion_point(field_set:appguard.Logs.token)
-}
-inline std::string* Logs::mutable_token() {
-  // @@protoc_insertion_point(field_mutable:appguard.Logs.token)
-  return _internal_mutable_token();
-}
-inline const std::string& Logs::_internal_token() const {
-  return token_.Get();
-}
-inline void Logs::_internal_set_token(const std::string& value) {
-  
-  token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void Logs::set_token(std::string&& value) {
-  
-  token_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:appguard.Logs.token)
-}
-inline void Logs::set_token(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:appguard.Logs.token)
-}
-inline void Logs::set_token(const char* value,
-    size_t size) {
-  
-  token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:appguard.Logs.token)
-}
-inline std::string* Logs::_internal_mutable_token() {
-  
-  return token_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline std::string* Logs::release_token() {
-  // @@protoc_insertion_point(field_release:appguard.Logs.token)
-  return token_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline void Logs::set_allocated_token(std::string* token) {
-  if (token != nullptr) {
-    
-  } else {
-    
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
   }
-  token_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), token,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:appguard.Logs.token)
-}
-inline std::string* Logs::unsafe_arena_release_token() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.Logs.token)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return token_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void Logs::unsafe_arena_set_allocated_token(
-    std::string* token) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (token != nullptr) {
-    
-  } else {
-    
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
   }
-  token_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      token, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.Logs.token)
-}
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const AppGuardTcpResponseBatch& default_instance();
 
-// repeated .appguard.Log logs = 3;
-inline int Logs::_internal_logs_size() const {
-  return logs_.size();
-}
-inline int Logs::logs_size() const {
-  return _internal_logs_size();
-}
-inline void Logs::clear_logs() {
-  logs_.Clear();
-}
-inline ::appguard::Log* Logs::mutable_logs(int index) {
-  // @@protoc_insertion_point(field_mutable:appguard.Logs.logs)
-  return logs_.Mutable(index);
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::appguard::Log >*
-Logs::mutable_logs() {
-  // @@protoc_insertion_point(field_mutable_list:appguard.Logs.logs)
-  return &logs_;
-}
-inline const ::appguard::Log& Logs::_internal_logs(int index) const {
-  return logs_.Get(index);
-}
-inline const ::appguard::Log& Logs::logs(int index) const {
-  // @@protoc_insertion_point(field_get:appguard.Logs.logs)
-  return _internal_logs(index);
-}
-inline ::appguard::Log* Logs::_internal_add_logs() {
-  return logs_.Add();
-}
-inline ::appguard::Log* Logs::add_logs() {
-  // @@protoc_insertion_point(field_add:appguard.Logs.logs)
-  return _internal_add_logs();
-}
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::appguard::Log >&
-Logs::logs() const {
-  // @@protoc_insertion_point(field_list:appguard.Logs.logs)
-  return logs_;
-}
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const AppGuardTcpResponseBatch* internal_default_instance() {
+    return reinterpret_cast<const AppGuardTcpResponseBatch*>(
+               &_AppGuardTcpResponseBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
 
-// -------------------------------------------------------------------
+  friend void swap(AppGuardTcpResponseBatch& a, AppGuardTcpResponseBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AppGuardTcpResponseBatch* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AppGuardTcpResponseBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
 
-// Log
+  // implements Message ----------------------------------------------
 
-// string timestamp = 1;
-inline void Log::clear_timestamp() {
-  timestamp_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline const std::string& Log::timestamp() const {
-  // @@protoc_insertion_point(field_get:appguard.Log.timestamp)
-  return _internal_timestamp();
-}
-inline void Log::set_timestamp(const std::string& value) {
-  _internal_set_timestamp(value);
-  // @@protoc_insertion_point(field_set:appguard.Log.timestamp)
-}
-inline std::string* Log::mutable_timestamp() {
-  // @@protoc_insertion_point(field_mutable:appguard.Log.timestamp)
-  return _internal_mutable_timestamp();
-}
-inline const std::string& Log::_internal_timestamp() const {
-  return timestamp_.Get();
-}
-inline void Log::_internal_set_timestamp(const std::string& value) {
-  
-  timestamp_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void Log::set_timestamp(std::string&& value) {
-  
-  timestamp_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:appguard.Log.timestamp)
-}
-inline void Log::set_timestamp(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  timestamp_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:appguard.Log.timestamp)
-}
-inline void Log::set_timestamp(const char* value,
-    size_t size) {
-  
-  timestamp_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:appguard.Log.timestamp)
-}
-inline std::string* Log::_internal_mutable_timestamp() {
-  
-  return timestamp_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline std::string* Log::release_timestamp() {
-  // @@protoc_insertion_point(field_release:appguard.Log.timestamp)
-  return timestamp_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline void Log::set_allocated_timestamp(std::string* timestamp) {
-  if (timestamp != nullptr) {
-    
-  } else {
-    
+  inline AppGuardTcpResponseBatch* New() const final {
+    return CreateMaybeMessage<AppGuardTcpResponseBatch>(nullptr);
   }
-  timestamp_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), timestamp,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:appguard.Log.timestamp)
-}
-inline std::string* Log::unsafe_arena_release_timestamp() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.Log.timestamp)
+
+  AppGuardTcpResponseBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<AppGuardTcpResponseBatch>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const AppGuardTcpResponseBatch& from);
+  void MergeFrom(const AppGuardTcpResponseBatch& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AppGuardTcpResponseBatch* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "appguard.AppGuardTcpResponseBatch";
+  }
+  protected:
+  explicit AppGuardTcpResponseBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_appguard_2eproto);
+    return ::descriptor_table_appguard_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResponsesFieldNumber = 1,
+  };
+  // repeated .appguard.AppGuardTcpResponse responses = 1;
+  int responses_size() const;
+  private:
+  int _internal_responses_size() const;
+  public:
+  void clear_responses();
+  ::appguard::AppGuardTcpResponse* mutable_responses(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::appguard::AppGuardTcpResponse >*
+      mutable_responses();
+  private:
+  const ::appguard::AppGuardTcpResponse& _internal_responses(int index) const;
+  ::appguard::AppGuardTcpResponse* _internal_add_responses();
+  public:
+  const ::appguard::AppGuardTcpResponse& responses(int index) const;
+  ::appguard::AppGuardTcpResponse* add_responses();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::appguard::AppGuardTcpResponse >&
+      responses() const;
+
+  // @@protoc_insertion_point(class_scope:appguard.AppGuardTcpResponseBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::appguard::AppGuardTcpResponse > responses_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_appguard_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AppGuardHttpRequestBatch PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:appguard.AppGuardHttpRequestBatch) */ {
+ public:
+  inline AppGuardHttpRequestBatch() : AppGuardHttpRequestBatch(nullptr) {};
+  virtual ~AppGuardHttpRequestBatch();
+
+  AppGuardHttpRequestBatch(const AppGuardHttpRequestBatch& from);
+  AppGuardHttpRequestBatch(AppGuardHttpRequestBatch&& from) noexcept
+    : AppGuardHttpRequestBatch() {
+    *this = ::std::move(from);
+  }
+
+  inline AppGuardHttpRequestBatch& operator=(const AppGuardHttpRequestBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AppGuardHttpRequestBatch& operator=(AppGuardHttpRequestBatch&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const AppGuardHttpRequestBatch& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const AppGuardHttpRequestBatch* internal_default_instance() {
+    return reinterpret_cast<const AppGuardHttpRequestBatch*>(
+               &_AppGuardHttpRequestBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(AppGuardHttpRequestBatch& a, AppGuardHttpRequestBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AppGuardHttpRequestBatch* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AppGuardHttpRequestBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline AppGuardHttpRequestBatch* New() const final {
+    return CreateMaybeMessage<AppGuardHttpRequestBatch>(nullptr);
+  }
+
+  AppGuardHttpRequestBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<AppGuardHttpRequestBatch>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const AppGuardHttpRequestBatch& from);
+  void MergeFrom(const AppGuardHttpRequestBatch& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AppGuardHttpRequestBatch* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "appguard.AppGuardHttpRequestBatch";
+  }
+  protected:
+  explicit AppGuardHttpRequestBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_appguard_2eproto);
+    return ::descriptor_table_appguard_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestsFieldNumber = 2,
+    kTokenFieldNumber = 1,
+  };
+  // repeated .appguard.AppGuardHttpRequest requests = 2;
+  int requests_size() const;
+  private:
+  int _internal_requests_size() const;
+  public:
+  void clear_requests();
+  ::appguard::AppGuardHttpRequest* mutable_requests(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::appguard::AppGuardHttpRequest >*
+      mutable_requests();
+  private:
+  const ::appguard::AppGuardHttpRequest& _internal_requests(int index) const;
+  ::appguard::AppGuardHttpRequest* _internal_add_requests();
+  public:
+  const ::appguard::AppGuardHttpRequest& requests(int index) const;
+  ::appguard::AppGuardHttpRequest* add_requests();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::appguard::AppGuardHttpRequest >&
+      requests() const;
+
+  // string token = 1;
+  void clear_token();
+  const std::string& token() const;
+  void set_token(const std::string& value);
+  void set_token(std::string&& value);
+  void set_token(const char* value);
+  void set_token(const char* value, size_t size);
+  std::string* mutable_token();
+  std::string* release_token();
+  void set_allocated_token(std::string* token);
+  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
+  "    string fields are deprecated and will be removed in a"
+  "    future release.")
+  std::string* unsafe_arena_release_token();
+  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
+  "    string fields are deprecated and will be removed in a"
+  "    future release.")
+  void unsafe_arena_set_allocated_token(
+      std::string* token);
+  private:
+  const std::string& _internal_token() const;
+  void _internal_set_token(const std::string& value);
+  std::string* _internal_mutable_token();
+  public:
+
+  // @@protoc_insertion_point(class_scope:appguard.AppGuardHttpRequestBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::appguard::AppGuardHttpRequest > requests_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr token_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_appguard_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AppGuardHttpResponseBatch PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:appguard.AppGuardHttpResponseBatch) */ {
+ public:
+  inline AppGuardHttpResponseBatch() : AppGuardHttpResponseBatch(nullptr) {};
+  virtual ~AppGuardHttpResponseBatch();
+
+  AppGuardHttpResponseBatch(const AppGuardHttpResponseBatch& from);
+  AppGuardHttpResponseBatch(AppGuardHttpResponseBatch&& from) noexcept
+    : AppGuardHttpResponseBatch() {
+    *this = ::std::move(from);
+  }
+
+  inline AppGuardHttpResponseBatch& operator=(const AppGuardHttpResponseBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AppGuardHttpResponseBatch& operator=(AppGuardHttpResponseBatch&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const AppGuardHttpResponseBatch& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const AppGuardHttpResponseBatch* internal_default_instance() {
+    return reinterpret_cast<const AppGuardHttpResponseBatch*>(
+               &_AppGuardHttpResponseBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(AppGuardHttpResponseBatch& a, AppGuardHttpResponseBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AppGuardHttpResponseBatch* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AppGuardHttpResponseBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline AppGuardHttpResponseBatch* New() const final {
+    return CreateMaybeMessage<AppGuardHttpResponseBatch>(nullptr);
+  }
+
+  AppGuardHttpResponseBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<AppGuardHttpResponseBatch>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const AppGuardHttpResponseBatch& from);
+  void MergeFrom(const AppGuardHttpResponseBatch& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AppGuardHttpResponseBatch* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "appguard.AppGuardHttpResponseBatch";
+  }
+  protected:
+  explicit AppGuardHttpResponseBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_appguard_2eproto);
+    return ::descriptor_table_appguard_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResponsesFieldNumber = 2,
+    kTokenFieldNumber = 1,
+  };
+  // repeated .appguard.AppGuardHttpResponse responses = 2;
+  int responses_size() const;
+  private:
+  int _internal_responses_size() const;
+  public:
+  void clear_responses();
+  ::appguard::AppGuardHttpResponse* mutable_responses(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::appguard::AppGuardHttpResponse >*
+      mutable_responses();
+  private:
+  const ::appguard::AppGuardHttpResponse& _internal_responses(int index) const;
+  ::appguard::AppGuardHttpResponse* _internal_add_responses();
+  public:
+  const ::appguard::AppGuardHttpResponse& responses(int index) const;
+  ::appguard::AppGuardHttpResponse* add_responses();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::appguard::AppGuardHttpResponse >&
+      responses() const;
+
+  // string token = 1;
+  void clear_token();
+  const std::string& token() const;
+  void set_token(const std::string& value);
+  void set_token(std::string&& value);
+  void set_token(const char* value);
+  void set_token(const char* value, size_t size);
+  std::string* mutable_token();
+  std::string* release_token();
+  void set_allocated_token(std::string* token);
+  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
+  "    string fields are deprecated and will be removed in a"
+  "    future release.")
+  std::string* unsafe_arena_release_token();
+  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
+  "    string fields are deprecated and will be removed in a"
+  "    future release.")
+  void unsafe_arena_set_allocated_token(
+      std::string* token);
+  private:
+  const std::string& _internal_token() const;
+  void _internal_set_token(const std::string& value);
+  std::string* _internal_mutable_token();
+  public:
+
+  // @@protoc_insertion_point(class_scope:appguard.AppGuardHttpResponseBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::appguard::AppGuardHttpResponse > responses_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr token_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_appguard_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AppGuardResponseBatch PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:appguard.AppGuardResponseBatch) */ {
+ public:
+  inline AppGuardResponseBatch() : AppGuardResponseBatch(nullptr) {};
+  virtual ~AppGuardResponseBatch();
+
+  AppGuardResponseBatch(const AppGuardResponseBatch& from);
+  AppGuardResponseBatch(AppGuardResponseBatch&& from) noexcept
+    : AppGuardResponseBatch() {
+    *this = ::std::move(from);
+  }
+
+  inline AppGuardResponseBatch& operator=(const AppGuardResponseBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AppGuardResponseBatch& operator=(AppGuardResponseBatch&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const AppGuardResponseBatch& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const AppGuardResponseBatch* internal_default_instance() {
+    return reinterpret_cast<const AppGuardResponseBatch*>(
+               &_AppGuardResponseBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(AppGuardResponseBatch& a, AppGuardResponseBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AppGuardResponseBatch* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AppGuardResponseBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline AppGuardResponseBatch* New() const final {
+    return CreateMaybeMessage<AppGuardResponseBatch>(nullptr);
+  }
+
+  AppGuardResponseBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<AppGuardResponseBatch>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const AppGuardResponseBatch& from);
+  void MergeFrom(const AppGuardResponseBatch& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AppGuardResponseBatch* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "appguard.AppGuardResponseBatch";
+  }
+  protected:
+  explicit AppGuardResponseBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_appguard_2eproto);
+    return ::descriptor_table_appguard_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResponsesFieldNumber = 1,
+  };
+  // repeated .appguard.AppGuardResponse responses = 1;
+  int responses_size() const;
+  private:
+  int _internal_responses_size() const;
+  public:
+  void clear_responses();
+  ::appguard::AppGuardResponse* mutable_responses(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::appguard::AppGuardResponse >*
+      mutable_responses();
+  private:
+  const ::appguard::AppGuardResponse& _internal_responses(int index) const;
+  ::appguard::AppGuardResponse* _internal_add_responses();
+  public:
+  const ::appguard::AppGuardResponse& responses(int index) const;
+  ::appguard::AppGuardResponse* add_responses();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::appguard::AppGuardResponse >&
+      responses() const;
+
+  // @@protoc_insertion_point(class_scope:appguard.AppGuardResponseBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::appguard::AppGuardResponse > responses_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_appguard_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AppGuardDecisionRequest PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:appguard.AppGuardDecisionRequest) */ {
+ public:
+  inline AppGuardDecisionRequest() : AppGuardDecisionRequest(nullptr) {};
+  virtual ~AppGuardDecisionRequest();
+
+  AppGuardDecisionRequest(const AppGuardDecisionRequest& from);
+  AppGuardDecisionRequest(AppGuardDecisionRequest&& from) noexcept
+    : AppGuardDecisionRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline AppGuardDecisionRequest& operator=(const AppGuardDecisionRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AppGuardDecisionRequest& operator=(AppGuardDecisionRequest&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const AppGuardDecisionRequest& default_instance();
+
+  enum PayloadCase {
+    kTcpConnection = 3,
+    kHttpRequest = 4,
+    kHttpResponse = 5,
+    PAYLOAD_NOT_SET = 0,
+  };
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const AppGuardDecisionRequest* internal_default_instance() {
+    return reinterpret_cast<const AppGuardDecisionRequest*>(
+               &_AppGuardDecisionRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(AppGuardDecisionRequest& a, AppGuardDecisionRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AppGuardDecisionRequest* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AppGuardDecisionRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline AppGuardDecisionRequest* New() const final {
+    return CreateMaybeMessage<AppGuardDecisionRequest>(nullptr);
+  }
+
+  AppGuardDecisionRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<AppGuardDecisionRequest>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const AppGuardDecisionRequest& from);
+  void MergeFrom(const AppGuardDecisionRequest& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AppGuardDecisionRequest* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "appguard.AppGuardDecisionRequest";
+  }
+  protected:
+  explicit AppGuardDecisionRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_appguard_2eproto);
+    return ::descriptor_table_appguard_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTokenFieldNumber = 2,
+    kIdFieldNumber = 1,
+    kTcpConnectionFieldNumber = 3,
+    kHttpRequestFieldNumber = 4,
+    kHttpResponseFieldNumber = 5,
+  };
+  // string token = 2;
+  void clear_token();
+  const std::string& token() const;
+  void set_token(const std::string& value);
+  void set_token(std::string&& value);
+  void set_token(const char* value);
+  void set_token(const char* value, size_t size);
+  std::string* mutable_token();
+  std::string* release_token();
+  void set_allocated_token(std::string* token);
+  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
+  "    string fields are deprecated and will be removed in a"
+  "    future release.")
+  std::string* unsafe_arena_release_token();
+  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
+  "    string fields are deprecated and will be removed in a"
+  "    future release.")
+  void unsafe_arena_set_allocated_token(
+      std::string* token);
+  private:
+  const std::string& _internal_token() const;
+  void _internal_set_token(const std::string& value);
+  std::string* _internal_mutable_token();
+  public:
+
+  // uint64 id = 1;
+  void clear_id();
+  ::PROTOBUF_NAMESPACE_ID::uint64 id() const;
+  void set_id(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_id() const;
+  void _internal_set_id(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
+  // .appguard.AppGuardTcpConnection tcp_connection = 3;
+  bool has_tcp_connection() const;
+  private:
+  bool _internal_has_tcp_connection() const;
+  public:
+  void clear_tcp_connection();
+  const ::appguard::AppGuardTcpConnection& tcp_connection() const;
+  ::appguard::AppGuardTcpConnection* release_tcp_connection();
+  ::appguard::AppGuardTcpConnection* mutable_tcp_connection();
+  void set_allocated_tcp_connection(::appguard::AppGuardTcpConnection* tcp_connection);
+  private:
+  const ::appguard::AppGuardTcpConnection& _internal_tcp_connection() const;
+  ::appguard::AppGuardTcpConnection* _internal_mutable_tcp_connection();
+  public:
+  void unsafe_arena_set_allocated_tcp_connection(
+      ::appguard::AppGuardTcpConnection* tcp_connection);
+  ::appguard::AppGuardTcpConnection* unsafe_arena_release_tcp_connection();
+
+  // .appguard.AppGuardHttpRequest http_request = 4;
+  bool has_http_request() const;
+  private:
+  bool _internal_has_http_request() const;
+  public:
+  void clear_http_request();
+  const ::appguard::AppGuardHttpRequest& http_request() const;
+  ::appguard::AppGuardHttpRequest* release_http_request();
+  ::appguard::AppGuardHttpRequest* mutable_http_request();
+  void set_allocated_http_request(::appguard::AppGuardHttpRequest* http_request);
+  private:
+  const ::appguard::AppGuardHttpRequest& _internal_http_request() const;
+  ::appguard::AppGuardHttpRequest* _internal_mutable_http_request();
+  public:
+  void unsafe_arena_set_allocated_http_request(
+      ::appguard::AppGuardHttpRequest* http_request);
+  ::appguard::AppGuardHttpRequest* unsafe_arena_release_http_request();
+
+  // .appguard.AppGuardHttpResponse http_response = 5;
+  bool has_http_response() const;
+  private:
+  bool _internal_has_http_response() const;
+  public:
+  void clear_http_response();
+  const ::appguard::AppGuardHttpResponse& http_response() const;
+  ::appguard::AppGuardHttpResponse* release_http_response();
+  ::appguard::AppGuardHttpResponse* mutable_http_response();
+  void set_allocated_http_response(::appguard::AppGuardHttpResponse* http_response);
+  private:
+  const ::appguard::AppGuardHttpResponse& _internal_http_response() const;
+  ::appguard::AppGuardHttpResponse* _internal_mutable_http_response();
+  public:
+  void unsafe_arena_set_allocated_http_response(
+      ::appguard::AppGuardHttpResponse* http_response);
+  ::appguard::AppGuardHttpResponse* unsafe_arena_release_http_response();
+
+  void clear_payload();
+  PayloadCase payload_case() const;
+  // @@protoc_insertion_point(class_scope:appguard.AppGuardDecisionRequest)
+ private:
+  class _Internal;
+  void set_has_tcp_connection();
+  void set_has_http_request();
+  void set_has_http_response();
+
+  inline bool has_payload() const;
+  inline void clear_has_payload();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr token_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 id_;
+  union PayloadUnion {
+    PayloadUnion() {}
+    ::appguard::AppGuardTcpConnection* tcp_connection_;
+    ::appguard::AppGuardHttpRequest* http_request_;
+    ::appguard::AppGuardHttpResponse* http_response_;
+  } payload_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 _oneof_case_[1];
+
+  friend struct ::TableStruct_appguard_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AppGuardDecisionResponse PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:appguard.AppGuardDecisionResponse) */ {
+ public:
+  inline AppGuardDecisionResponse() : AppGuardDecisionResponse(nullptr) {};
+  virtual ~AppGuardDecisionResponse();
+
+  AppGuardDecisionResponse(const AppGuardDecisionResponse& from);
+  AppGuardDecisionResponse(AppGuardDecisionResponse&& from) noexcept
+    : AppGuardDecisionResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline AppGuardDecisionResponse& operator=(const AppGuardDecisionResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AppGuardDecisionResponse& operator=(AppGuardDecisionResponse&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const AppGuardDecisionResponse& default_instance();
+
+  enum PayloadCase {
+    kTcpResponse = 2,
+    kResponse = 3,
+    PAYLOAD_NOT_SET = 0,
+  };
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const AppGuardDecisionResponse* internal_default_instance() {
+    return reinterpret_cast<const AppGuardDecisionResponse*>(
+               &_AppGuardDecisionResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(AppGuardDecisionResponse& a, AppGuardDecisionResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AppGuardDecisionResponse* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AppGuardDecisionResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline AppGuardDecisionResponse* New() const final {
+    return CreateMaybeMessage<AppGuardDecisionResponse>(nullptr);
+  }
+
+  AppGuardDecisionResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<AppGuardDecisionResponse>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const AppGuardDecisionResponse& from);
+  void MergeFrom(const AppGuardDecisionResponse& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AppGuardDecisionResponse* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "appguard.AppGuardDecisionResponse";
+  }
+  protected:
+  explicit AppGuardDecisionResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_appguard_2eproto);
+    return ::descriptor_table_appguard_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIdFieldNumber = 1,
+    kTcpResponseFieldNumber = 2,
+    kResponseFieldNumber = 3,
+  };
+  // uint64 id = 1;
+  void clear_id();
+  ::PROTOBUF_NAMESPACE_ID::uint64 id() const;
+  void set_id(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_id() const;
+  void _internal_set_id(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
+  // .appguard.AppGuardTcpResponse tcp_response = 2;
+  bool has_tcp_response() const;
+  private:
+  bool _internal_has_tcp_response() const;
+  public:
+  void clear_tcp_response();
+  const ::appguard::AppGuardTcpResponse& tcp_response() const;
+  ::appguard::AppGuardTcpResponse* release_tcp_response();
+  ::appguard::AppGuardTcpResponse* mutable_tcp_response();
+  void set_allocated_tcp_response(::appguard::AppGuardTcpResponse* tcp_response);
+  private:
+  const ::appguard::AppGuardTcpResponse& _internal_tcp_response() const;
+  ::appguard::AppGuardTcpResponse* _internal_mutable_tcp_response();
+  public:
+  void unsafe_arena_set_allocated_tcp_response(
+      ::appguard::AppGuardTcpResponse* tcp_response);
+  ::appguard::AppGuardTcpResponse* unsafe_arena_release_tcp_response();
+
+  // .appguard.AppGuardResponse response = 3;
+  bool has_response() const;
+  private:
+  bool _internal_has_response() const;
+  public:
+  void clear_response();
+  const ::appguard::AppGuardResponse& response() const;
+  ::appguard::AppGuardResponse* release_response();
+  ::appguard::AppGuardResponse* mutable_response();
+  void set_allocated_response(::appguard::AppGuardResponse* response);
+  private:
+  const ::appguard::AppGuardResponse& _internal_response() const;
+  ::appguard::AppGuardResponse* _internal_mutable_response();
+  public:
+  void unsafe_arena_set_allocated_response(
+      ::appguard::AppGuardResponse* response);
+  ::appguard::AppGuardResponse* unsafe_arena_release_response();
+
+  void clear_payload();
+  PayloadCase payload_case() const;
+  // @@protoc_insertion_point(class_scope:appguard.AppGuardDecisionResponse)
+ private:
+  class _Internal;
+  void set_has_tcp_response();
+  void set_has_response();
+
+  inline bool has_payload() const;
+  inline void clear_has_payload();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 id_;
+  union PayloadUnion {
+    PayloadUnion() {}
+    ::appguard::AppGuardTcpResponse* tcp_response_;
+    ::appguard::AppGuardResponse* response_;
+  } payload_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 _oneof_case_[1];
+
+  friend struct ::TableStruct_appguard_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Token PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:appguard.Token) */ {
+ public:
+  inline Token() : Token(nullptr) {};
+  virtual ~Token();
+
+  Token(const Token& from);
+  Token(Token&& from) noexcept
+    : Token() {
+    *this = ::std::move(from);
+  }
+
+  inline Token& operator=(const Token& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Token& operator=(Token&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const Token& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const Token* internal_default_instance() {
+    return reinterpret_cast<const Token*>(
+               &_Token_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(Token& a, Token& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Token* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Token* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline Token* New() const final {
+    return CreateMaybeMessage<Token>(nullptr);
+  }
+
+  Token* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<Token>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const Token& from);
+  void MergeFrom(const Token& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Token* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "appguard.Token";
+  }
+  protected:
+  explicit Token(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_appguard_2eproto);
+    return ::descriptor_table_appguard_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTokenFieldNumber = 1,
+  };
+  // string token = 1;
+  void clear_token();
+  const std::string& token() const;
+  void set_token(const std::string& value);
+  void set_token(std::string&& value);
+  void set_token(const char* value);
+  void set_token(const char* value, size_t size);
+  std::string* mutable_token();
+  std::string* release_token();
+  void set_allocated_token(std::string* token);
+  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
+  "    string fields are deprecated and will be removed in a"
+  "    future release.")
+  std::string* unsafe_arena_release_token();
+  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
+  "    string fields are deprecated and will be removed in a"
+  "    future release.")
+  void unsafe_arena_set_allocated_token(
+      std::string* token);
+  private:
+  const std::string& _internal_token() const;
+  void _internal_set_token(const std::string& value);
+  std::string* _internal_mutable_token();
+  public:
+
+  // @@protoc_insertion_point(class_scope:appguard.Token)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr token_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_appguard_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Logs
+
+// string token = 1;
+inline void Logs::clear_token() {
+  token_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& Logs::token() const {
+  // @@protoc_insertion_point(field_get:appguard.Logs.token)
+  return _internal_token();
+}
+inline void Logs::set_token(const std::string& value) {
+  _internal_set_token(value);
+  // @@protoc_insertion_point(field_set:appguard.Logs.token)
+}
+inline std::string* Logs::mutable_token() {
+  // @@protoc_insertion_point(field_mutable:appguard.Logs.token)
+  return _internal_mutable_token();
+}
+inline const std::string& Logs::_internal_token() const {
+  return token_.Get();
+}
+inline void Logs::_internal_set_token(const std::string& value) {
+  
+  token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void Logs::set_token(std::string&& value) {
+  
+  token_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:appguard.Logs.token)
+}
+inline void Logs::set_token(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:appguard.Logs.token)
+}
+inline void Logs::set_token(const char* value,
+    size_t size) {
+  
+  token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:appguard.Logs.token)
+}
+inline std::string* Logs::_internal_mutable_token() {
+  
+  return token_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* Logs::release_token() {
+  // @@protoc_insertion_point(field_release:appguard.Logs.token)
+  return token_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void Logs::set_allocated_token(std::string* token) {
+  if (token != nullptr) {
+    
+  } else {
+    
+  }
+  token_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), token,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:appguard.Logs.token)
+}
+inline std::string* Logs::unsafe_arena_release_token() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.Logs.token)
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  
+  return token_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      GetArena());
+}
+inline void Logs::unsafe_arena_set_allocated_token(
+    std::string* token) {
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  if (token != nullptr) {
+    
+  } else {
+    
+  }
+  token_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      token, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.Logs.token)
+}
+
+// repeated .appguard.Log logs = 3;
+inline int Logs::_internal_logs_size() const {
+  return logs_.size();
+}
+inline int Logs::logs_size() const {
+  return _internal_logs_size();
+}
+inline void Logs::clear_logs() {
+  logs_.Clear();
+}
+inline ::appguard::Log* Logs::mutable_logs(int index) {
+  // @@protoc_insertion_point(field_mutable:appguard.Logs.logs)
+  return logs_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::appguard::Log >*
+Logs::mutable_logs() {
+  // @@protoc_insertion_point(field_mutable_list:appguard.Logs.logs)
+  return &logs_;
+}
+inline const ::appguard::Log& Logs::_internal_logs(int index) const {
+  return logs_.Get(index);
+}
+inline const ::appguard::Log& Logs::logs(int index) const {
+  // @@protoc_insertion_point(field_get:appguard.Logs.logs)
+  return _internal_logs(index);
+}
+inline ::appguard::Log* Logs::_internal_add_logs() {
+  return logs_.Add();
+}
+inline ::appguard::Log* Logs::add_logs() {
+  // @@protoc_insertion_point(field_add:appguard.Logs.logs)
+  return _internal_add_logs();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::appguard::Log >&
+Logs::logs() const {
+  // @@protoc_insertion_point(field_list:appguard.Logs.logs)
+  return logs_;
+}
+
+// -------------------------------------------------------------------
+
+// Log
+
+// string timestamp = 1;
+inline void Log::clear_timestamp() {
+  timestamp_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& Log::timestamp() const {
+  // @@protoc_insertion_point(field_get:appguard.Log.timestamp)
+  return _internal_timestamp();
+}
+inline void Log::set_timestamp(const std::string& value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:appguard.Log.timestamp)
+}
+inline std::string* Log::mutable_timestamp() {
+  // @@protoc_insertion_point(field_mutable:appguard.Log.timestamp)
+  return _internal_mutable_timestamp();
+}
+inline const std::string& Log::_internal_timestamp() const {
+  return timestamp_.Get();
+}
+inline void Log::_internal_set_timestamp(const std::string& value) {
+  
+  timestamp_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void Log::set_timestamp(std::string&& value) {
+  
+  timestamp_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:appguard.Log.timestamp)
+}
+inline void Log::set_timestamp(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  timestamp_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:appguard.Log.timestamp)
+}
+inline void Log::set_timestamp(const char* value,
+    size_t size) {
+  
+  timestamp_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:appguard.Log.timestamp)
+}
+inline std::string* Log::_internal_mutable_timestamp() {
+  
+  return timestamp_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* Log::release_timestamp() {
+  // @@protoc_insertion_point(field_release:appguard.Log.timestamp)
+  return timestamp_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void Log::set_allocated_timestamp(std::string* timestamp) {
+  if (timestamp != nullptr) {
+    
+  } else {
+    
+  }
+  timestamp_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), timestamp,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:appguard.Log.timestamp)
+}
+inline std::string* Log::unsafe_arena_release_timestamp() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.Log.timestamp)
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  
+  return timestamp_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      GetArena());
+}
+inline void Log::unsafe_arena_set_allocated_timestamp(
+    std::string* timestamp) {
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  if (timestamp != nullptr) {
+    
+  } else {
+    
+  }
+  timestamp_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      timestamp, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.Log.timestamp)
+}
+
+// string level = 2;
+inline void Log::clear_level() {
+  level_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& Log::level() const {
+  // @@protoc_insertion_point(field_get:appguard.Log.level)
+  return _internal_level();
+}
+inline void Log::set_level(const std::string& value) {
+  _internal_set_level(value);
+  // @@protoc_insertion_point(field_set:appguard.Log.level)
+}
+inline std::string* Log::mutable_level() {
+  // @@protoc_insertion_point(field_mutable:appguard.Log.level)
+  return _internal_mutable_level();
+}
+inline const std::string& Log::_internal_level() const {
+  return level_.Get();
+}
+inline void Log::_internal_set_level(const std::string& value) {
+  
+  level_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void Log::set_level(std::string&& value) {
+  
+  level_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:appguard.Log.level)
+}
+inline void Log::set_level(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  level_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:appguard.Log.level)
+}
+inline void Log::set_level(const char* value,
+    size_t size) {
+  
+  level_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:appguard.Log.level)
+}
+inline std::string* Log::_internal_mutable_level() {
+  
+  return level_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* Log::release_level() {
+  // @@protoc_insertion_point(field_release:appguard.Log.level)
+  return level_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void Log::set_allocated_level(std::string* level) {
+  if (level != nullptr) {
+    
+  } else {
+    
+  }
+  level_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), level,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:appguard.Log.level)
+}
+inline std::string* Log::unsafe_arena_release_level() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.Log.level)
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  
+  return level_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      GetArena());
+}
+inline void Log::unsafe_arena_set_allocated_level(
+    std::string* level) {
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  if (level != nullptr) {
+    
+  } else {
+    
+  }
+  level_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      level, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.Log.level)
+}
+
+// string message = 3;
+inline void Log::clear_message() {
+  message_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& Log::message() const {
+  // @@protoc_insertion_point(field_get:appguard.Log.message)
+  return _internal_message();
+}
+inline void Log::set_message(const std::string& value) {
+  _internal_set_message(value);
+  // @@protoc_insertion_point(field_set:appguard.Log.message)
+}
+inline std::string* Log::mutable_message() {
+  // @@protoc_insertion_point(field_mutable:appguard.Log.message)
+  return _internal_mutable_message();
+}
+inline const std::string& Log::_internal_message() const {
+  return message_.Get();
+}
+inline void Log::_internal_set_message(const std::string& value) {
+  
+  message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void Log::set_message(std::string&& value) {
+  
+  message_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:appguard.Log.message)
+}
+inline void Log::set_message(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:appguard.Log.message)
+}
+inline void Log::set_message(const char* value,
+    size_t size) {
+  
+  message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:appguard.Log.message)
+}
+inline std::string* Log::_internal_mutable_message() {
+  
+  return message_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* Log::release_message() {
+  // @@protoc_insertion_point(field_release:appguard.Log.message)
+  return message_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void Log::set_allocated_message(std::string* message) {
+  if (message != nullptr) {
+    
+  } else {
+    
+  }
+  message_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), message,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:appguard.Log.message)
+}
+inline std::string* Log::unsafe_arena_release_message() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.Log.message)
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  
+  return message_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      GetArena());
+}
+inline void Log::unsafe_arena_set_allocated_message(
+    std::string* message) {
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  if (message != nullptr) {
+    
+  } else {
+    
+  }
+  message_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      message, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.Log.message)
+}
+
+// -------------------------------------------------------------------
+
+// AppGuardTcpConnection
+
+// string token = 1;
+inline void AppGuardTcpConnection::clear_token() {
+  token_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& AppGuardTcpConnection::token() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardTcpConnection.token)
+  return _internal_token();
+}
+inline void AppGuardTcpConnection::set_token(const std::string& value) {
+  _internal_set_token(value);
+  // @@protoc_insertion_point(field_set:appguard.AppGuardTcpConnection.token)
+}
+inline std::string* AppGuardTcpConnection::mutable_token() {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardTcpConnection.token)
+  return _internal_mutable_token();
+}
+inline const std::string& AppGuardTcpConnection::_internal_token() const {
+  return token_.Get();
+}
+inline void AppGuardTcpConnection::_internal_set_token(const std::string& value) {
+  
+  token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void AppGuardTcpConnection::set_token(std::string&& value) {
+  
+  token_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardTcpConnection.token)
+}
+inline void AppGuardTcpConnection::set_token(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:appguard.AppGuardTcpConnection.token)
+}
+inline void AppGuardTcpConnection::set_token(const char* value,
+    size_t size) {
+  
+  token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardTcpConnection.token)
+}
+inline std::string* AppGuardTcpConnection::_internal_mutable_token() {
+  
+  return token_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* AppGuardTcpConnection::release_token() {
+  // @@protoc_insertion_point(field_release:appguard.AppGuardTcpConnection.token)
+  return token_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void AppGuardTcpConnection::set_allocated_token(std::string* token) {
+  if (token != nullptr) {
+    
+  } else {
+    
+  }
+  token_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), token,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardTcpConnection.token)
+}
+inline std::string* AppGuardTcpConnection::unsafe_arena_release_token() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardTcpConnection.token)
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  
+  return token_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      GetArena());
+}
+inline void AppGuardTcpConnection::unsafe_arena_set_allocated_token(
+    std::string* token) {
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  if (token != nullptr) {
+    
+  } else {
+    
+  }
+  token_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      token, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardTcpConnection.token)
+}
+
+// string source_ip = 2;
+inline bool AppGuardTcpConnection::_internal_has_source_ip() const {
+  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool AppGuardTcpConnection::has_source_ip() const {
+  return _internal_has_source_ip();
+}
+inline void AppGuardTcpConnection::clear_source_ip() {
+  source_ip_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& AppGuardTcpConnection::source_ip() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardTcpConnection.source_ip)
+  return _internal_source_ip();
+}
+inline void AppGuardTcpConnection::set_source_ip(const std::string& value) {
+  _internal_set_source_ip(value);
+  // @@protoc_insertion_point(field_set:appguard.AppGuardTcpConnection.source_ip)
+}
+inline std::string* AppGuardTcpConnection::mutable_source_ip() {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardTcpConnection.source_ip)
+  return _internal_mutable_source_ip();
+}
+inline const std::string& AppGuardTcpConnection::_internal_source_ip() const {
+  return source_ip_.Get();
+}
+inline void AppGuardTcpConnection::_internal_set_source_ip(const std::string& value) {
+  _has_bits_[0] |= 0x00000001u;
+  source_ip_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void AppGuardTcpConnection::set_source_ip(std::string&& value) {
+  _has_bits_[0] |= 0x00000001u;
+  source_ip_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardTcpConnection.source_ip)
+}
+inline void AppGuardTcpConnection::set_source_ip(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000001u;
+  source_ip_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:appguard.AppGuardTcpConnection.source_ip)
+}
+inline void AppGuardTcpConnection::set_source_ip(const char* value,
+    size_t size) {
+  _has_bits_[0] |= 0x00000001u;
+  source_ip_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardTcpConnection.source_ip)
+}
+inline std::string* AppGuardTcpConnection::_internal_mutable_source_ip() {
+  _has_bits_[0] |= 0x00000001u;
+  return source_ip_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* AppGuardTcpConnection::release_source_ip() {
+  // @@protoc_insertion_point(field_release:appguard.AppGuardTcpConnection.source_ip)
+  if (!_internal_has_source_ip()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000001u;
+  return source_ip_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void AppGuardTcpConnection::set_allocated_source_ip(std::string* source_ip) {
+  if (source_ip != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  source_ip_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), source_ip,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardTcpConnection.source_ip)
+}
+inline std::string* AppGuardTcpConnection::unsafe_arena_release_source_ip() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardTcpConnection.source_ip)
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  _has_bits_[0] &= ~0x00000001u;
+  return source_ip_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      GetArena());
+}
+inline void AppGuardTcpConnection::unsafe_arena_set_allocated_source_ip(
+    std::string* source_ip) {
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  if (source_ip != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  source_ip_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      source_ip, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardTcpConnection.source_ip)
+}
+
+// uint32 source_port = 3;
+inline bool AppGuardTcpConnection::_internal_has_source_port() const {
+  bool value = (_has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool AppGuardTcpConnection::has_source_port() const {
+  return _internal_has_source_port();
+}
+inline void AppGuardTcpConnection::clear_source_port() {
+  source_port_ = 0u;
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 AppGuardTcpConnection::_internal_source_port() const {
+  return source_port_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 AppGuardTcpConnection::source_port() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardTcpConnection.source_port)
+  return _internal_source_port();
+}
+inline void AppGuardTcpConnection::_internal_set_source_port(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _has_bits_[0] |= 0x00000004u;
+  source_port_ = value;
+}
+inline void AppGuardTcpConnection::set_source_port(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_source_port(value);
+  // @@protoc_insertion_point(field_set:appguard.AppGuardTcpConnection.source_port)
+}
+
+// string destination_ip = 4;
+inline bool AppGuardTcpConnection::_internal_has_destination_ip() const {
+  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool AppGuardTcpConnection::has_destination_ip() const {
+  return _internal_has_destination_ip();
+}
+inline void AppGuardTcpConnection::clear_destination_ip() {
+  destination_ip_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& AppGuardTcpConnection::destination_ip() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardTcpConnection.destination_ip)
+  return _internal_destination_ip();
+}
+inline void AppGuardTcpConnection::set_destination_ip(const std::string& value) {
+  _internal_set_destination_ip(value);
+  // @@protoc_insertion_point(field_set:appguard.AppGuardTcpConnection.destination_ip)
+}
+inline std::string* AppGuardTcpConnection::mutable_destination_ip() {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardTcpConnection.destination_ip)
+  return _internal_mutable_destination_ip();
+}
+inline const std::string& AppGuardTcpConnection::_internal_destination_ip() const {
+  return destination_ip_.Get();
+}
+inline void AppGuardTcpConnection::_internal_set_destination_ip(const std::string& value) {
+  _has_bits_[0] |= 0x00000002u;
+  destination_ip_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void AppGuardTcpConnection::set_destination_ip(std::string&& value) {
+  _has_bits_[0] |= 0x00000002u;
+  destination_ip_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardTcpConnection.destination_ip)
+}
+inline void AppGuardTcpConnection::set_destination_ip(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000002u;
+  destination_ip_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:appguard.AppGuardTcpConnection.destination_ip)
+}
+inline void AppGuardTcpConnection::set_destination_ip(const char* value,
+    size_t size) {
+  _has_bits_[0] |= 0x00000002u;
+  destination_ip_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardTcpConnection.destination_ip)
+}
+inline std::string* AppGuardTcpConnection::_internal_mutable_destination_ip() {
+  _has_bits_[0] |= 0x00000002u;
+  return destination_ip_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* AppGuardTcpConnection::release_destination_ip() {
+  // @@protoc_insertion_point(field_release:appguard.AppGuardTcpConnection.destination_ip)
+  if (!_internal_has_destination_ip()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000002u;
+  return destination_ip_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void AppGuardTcpConnection::set_allocated_destination_ip(std::string* destination_ip) {
+  if (destination_ip != nullptr) {
+    _has_bits_[0] |= 0x00000002u;
+  } else {
+    _has_bits_[0] &= ~0x00000002u;
+  }
+  destination_ip_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), destination_ip,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardTcpConnection.destination_ip)
+}
+inline std::string* AppGuardTcpConnection::unsafe_arena_release_destination_ip() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardTcpConnection.destination_ip)
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  _has_bits_[0] &= ~0x00000002u;
+  return destination_ip_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      GetArena());
+}
+inline void AppGuardTcpConnection::unsafe_arena_set_allocated_destination_ip(
+    std::string* destination_ip) {
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  if (destination_ip != nullptr) {
+    _has_bits_[0] |= 0x00000002u;
+  } else {
+    _has_bits_[0] &= ~0x00000002u;
+  }
+  destination_ip_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      destination_ip, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardTcpConnection.destination_ip)
+}
+
+// uint32 destination_port = 5;
+inline bool AppGuardTcpConnection::_internal_has_destination_port() const {
+  bool value = (_has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool AppGuardTcpConnection::has_destination_port() const {
+  return _internal_has_destination_port();
+}
+inline void AppGuardTcpConnection::clear_destination_port() {
+  destination_port_ = 0u;
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 AppGuardTcpConnection::_internal_destination_port() const {
+  return destination_port_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 AppGuardTcpConnection::destination_port() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardTcpConnection.destination_port)
+  return _internal_destination_port();
+}
+inline void AppGuardTcpConnection::_internal_set_destination_port(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _has_bits_[0] |= 0x00000008u;
+  destination_port_ = value;
+}
+inline void AppGuardTcpConnection::set_destination_port(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_destination_port(value);
+  // @@protoc_insertion_point(field_set:appguard.AppGuardTcpConnection.destination_port)
+}
+
+// string protocol = 6;
+inline void AppGuardTcpConnection::clear_protocol() {
+  protocol_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& AppGuardTcpConnection::protocol() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardTcpConnection.protocol)
+  return _internal_protocol();
+}
+inline void AppGuardTcpConnection::set_protocol(const std::string& value) {
+  _internal_set_protocol(value);
+  // @@protoc_insertion_point(field_set:appguard.AppGuardTcpConnection.protocol)
+}
+inline std::string* AppGuardTcpConnection::mutable_protocol() {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardTcpConnection.protocol)
+  return _internal_mutable_protocol();
+}
+inline const std::string& AppGuardTcpConnection::_internal_protocol() const {
+  return protocol_.Get();
+}
+inline void AppGuardTcpConnection::_internal_set_protocol(const std::string& value) {
+  
+  protocol_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void AppGuardTcpConnection::set_protocol(std::string&& value) {
+  
+  protocol_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardTcpConnection.protocol)
+}
+inline void AppGuardTcpConnection::set_protocol(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  protocol_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:appguard.AppGuardTcpConnection.protocol)
+}
+inline void AppGuardTcpConnection::set_protocol(const char* value,
+    size_t size) {
+  
+  protocol_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardTcpConnection.protocol)
+}
+inline std::string* AppGuardTcpConnection::_internal_mutable_protocol() {
+  
+  return protocol_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* AppGuardTcpConnection::release_protocol() {
+  // @@protoc_insertion_point(field_release:appguard.AppGuardTcpConnection.protocol)
+  return protocol_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void AppGuardTcpConnection::set_allocated_protocol(std::string* protocol) {
+  if (protocol != nullptr) {
+    
+  } else {
+    
+  }
+  protocol_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), protocol,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardTcpConnection.protocol)
+}
+inline std::string* AppGuardTcpConnection::unsafe_arena_release_protocol() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardTcpConnection.protocol)
   GOOGLE_DCHECK(GetArena() != nullptr);
   
-  return timestamp_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+  return protocol_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       GetArena());
 }
-inline void Log::unsafe_arena_set_allocated_timestamp(
-    std::string* timestamp) {
+inline void AppGuardTcpConnection::unsafe_arena_set_allocated_protocol(
+    std::string* protocol) {
   GOOGLE_DCHECK(GetArena() != nullptr);
-  if (timestamp != nullptr) {
+  if (protocol != nullptr) {
     
   } else {
     
   }
-  timestamp_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      timestamp, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.Log.timestamp)
+  protocol_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      protocol, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardTcpConnection.protocol)
 }
 
-// string level = 2;
-inline void Log::clear_level() {
-  level_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// -------------------------------------------------------------------
+
+// AppGuardIpInfo
+
+// string ip = 1;
+inline void AppGuardIpInfo::clear_ip() {
+  ip_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline const std::string& Log::level() const {
-  // @@protoc_insertion_point(field_get:appguard.Log.level)
-  return _internal_level();
+inline const std::string& AppGuardIpInfo::ip() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardIpInfo.ip)
+  return _internal_ip();
 }
-inline void Log::set_level(const std::string& value) {
-  _internal_set_level(value);
-  // @@protoc_insertion_point(field_set:appguard.Log.level)
+inline void AppGuardIpInfo::set_ip(const std::string& value) {
+  _internal_set_ip(value);
+  // @@protoc_insertion_point(field_set:appguard.AppGuardIpInfo.ip)
 }
-inline std::string* Log::mutable_level() {
-  // @@protoc_insertion_point(field_mutable:appguard.Log.level)
-  return _internal_mutable_level();
+inline std::string* AppGuardIpInfo::mutable_ip() {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardIpInfo.ip)
+  return _internal_mutable_ip();
 }
-inline const std::string& Log::_internal_level() const {
-  return level_.Get();
+inline const std::string& AppGuardIpInfo::_internal_ip() const {
+  return ip_.Get();
 }
-inline void Log::_internal_set_level(const std::string& value) {
+inline void AppGuardIpInfo::_internal_set_ip(const std::string& value) {
   
-  level_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+  ip_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
 }
-inline void Log::set_level(std::string&& value) {
+inline void AppGuardIpInfo::set_ip(std::string&& value) {
   
-  level_.Set(
+  ip_.Set(
     &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:appguard.Log.level)
+  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardIpInfo.ip)
 }
-inline void Log::set_level(const char* value) {
+inline void AppGuardIpInfo::set_ip(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   
-  level_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+  ip_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
               GetArena());
-  // @@protoc_insertion_point(field_set_char:appguard.Log.level)
+  // @@protoc_insertion_point(field_set_char:appguard.AppGuardIpInfo.ip)
 }
-inline void Log::set_level(const char* value,
+inline void AppGuardIpInfo::set_ip(const char* value,
     size_t size) {
   
-  level_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+  ip_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
       reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:appguard.Log.level)
+  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardIpInfo.ip)
 }
-inline std::string* Log::_internal_mutable_level() {
+inline std::string* AppGuardIpInfo::_internal_mutable_ip() {
   
-  return level_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return ip_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline std::string* Log::release_level() {
-  // @@protoc_insertion_point(field_release:appguard.Log.level)
-  return level_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* AppGuardIpInfo::release_ip() {
+  // @@protoc_insertion_point(field_release:appguard.AppGuardIpInfo.ip)
+  return ip_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void Log::set_allocated_level(std::string* level) {
-  if (level != nullptr) {
+inline void AppGuardIpInfo::set_allocated_ip(std::string* ip) {
+  if (ip != nullptr) {
     
   } else {
     
   }
-  level_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), level,
+  ip_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ip,
       GetArena());
-  // @@protoc_insertion_point(field_set_allocated:appguard.Log.level)
+  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardIpInfo.ip)
 }
-inline std::string* Log::unsafe_arena_release_level() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.Log.level)
+inline std::string* AppGuardIpInfo::unsafe_arena_release_ip() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardIpInfo.ip)
   GOOGLE_DCHECK(GetArena() != nullptr);
   
-  return level_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+  return ip_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       GetArena());
 }
-inline void Log::unsafe_arena_set_allocated_level(
-    std::string* level) {
+inline void AppGuardIpInfo::unsafe_arena_set_allocated_ip(
+    std::string* ip) {
   GOOGLE_DCHECK(GetArena() != nullptr);
-  if (level != nullptr) {
+  if (ip != nullptr) {
     
   } else {
     
   }
-  level_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      level, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.Log.level)
+  ip_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ip, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardIpInfo.ip)
 }
 
-// string message = 3;
-inline void Log::clear_message() {
-  message_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// string country = 2;
+inline bool AppGuardIpInfo::_internal_has_country() const {
+  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline const std::string& Log::message() const {
-  // @@protoc_insertion_point(field_get:appguard.Log.message)
-  return _internal_message();
+inline bool AppGuardIpInfo::has_country() const {
+  return _internal_has_country();
 }
-inline void Log::set_message(const std::string& value) {
-  _internal_set_message(value);
-  // @@protoc_insertion_point(field_set:appguard.Log.message)
+inline void AppGuardIpInfo::clear_country() {
+  country_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _has_bits_[0] &= ~0x00000001u;
 }
-inline std::string* Log::mutable_message() {
-  // @@protoc_insertion_point(field_mutable:appguard.Log.message)
-  return _internal_mutable_message();
+inline const std::string& AppGuardIpInfo::country() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardIpInfo.country)
+  return _internal_country();
 }
-inline const std::string& Log::_internal_message() const {
-  return message_.Get();
+inline void AppGuardIpInfo::set_country(const std::string& value) {
+  _internal_set_country(value);
+  // @@protoc_insertion_point(field_set:appguard.AppGuardIpInfo.country)
 }
-inline void Log::_internal_set_message(const std::string& value) {
-  
-  message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline std::string* AppGuardIpInfo::mutable_country() {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardIpInfo.country)
+  return _internal_mutable_country();
 }
-inline void Log::set_message(std::string&& value) {
-  
-  message_.Set(
+inline const std::string& AppGuardIpInfo::_internal_country() const {
+  return country_.Get();
+}
+inline void AppGuardIpInfo::_internal_set_country(const std::string& value) {
+  _has_bits_[0] |= 0x00000001u;
+  country_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void AppGuardIpInfo::set_country(std::string&& value) {
+  _has_bits_[0] |= 0x00000001u;
+  country_.Set(
     &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:appguard.Log.message)
+  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardIpInfo.country)
 }
-inline void Log::set_message(const char* value) {
+inline void AppGuardIpInfo::set_country(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  
-  message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+  _has_bits_[0] |= 0x00000001u;
+  country_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
               GetArena());
-  // @@protoc_insertion_point(field_set_char:appguard.Log.message)
+  // @@protoc_insertion_point(field_set_char:appguard.AppGuardIpInfo.country)
 }
-inline void Log::set_message(const char* value,
+inline void AppGuardIpInfo::set_country(const char* value,
     size_t size) {
-  
-  message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+  _has_bits_[0] |= 0x00000001u;
+  country_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
       reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:appguard.Log.message)
+  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardIpInfo.country)
 }
-inline std::string* Log::_internal_mutable_message() {
-  
-  return message_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* AppGuardIpInfo::_internal_mutable_country() {
+  _has_bits_[0] |= 0x00000001u;
+  return country_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline std::string* Log::release_message() {
-  // @@protoc_insertion_point(field_release:appguard.Log.message)
-  return message_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* AppGuardIpInfo::release_country() {
+  // @@protoc_insertion_point(field_release:appguard.AppGuardIpInfo.country)
+  if (!_internal_has_country()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000001u;
+  return country_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void Log::set_allocated_message(std::string* message) {
-  if (message != nullptr) {
-    
+inline void AppGuardIpInfo::set_allocated_country(std::string* country) {
+  if (country != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
   } else {
-    
+    _has_bits_[0] &= ~0x00000001u;
   }
-  message_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), message,
+  country_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), country,
       GetArena());
-  // @@protoc_insertion_point(field_set_allocated:appguard.Log.message)
+  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardIpInfo.country)
 }
-inline std::string* Log::unsafe_arena_release_message() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.Log.message)
+inline std::string* AppGuardIpInfo::unsafe_arena_release_country() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardIpInfo.country)
   GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return message_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+  _has_bits_[0] &= ~0x00000001u;
+  return country_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       GetArena());
 }
-inline void Log::unsafe_arena_set_allocated_message(
-    std::string* message) {
+inline void AppGuardIpInfo::unsafe_arena_set_allocated_country(
+    std::string* country) {
   GOOGLE_DCHECK(GetArena() != nullptr);
-  if (message != nullptr) {
-    
+  if (country != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
   } else {
-    
+    _has_bits_[0] &= ~0x00000001u;
   }
-  message_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      message, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.Log.message)
+  country_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      country, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardIpInfo.country)
 }
 
-// -------------------------------------------------------------------
-
-// AppGuardTcpConnection
-
-// string token = 1;
-inline void AppGuardTcpConnection::clear_token() {
-  token_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// string asn = 3;
+inline bool AppGuardIpInfo::_internal_has_asn() const {
+  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline const std::string& AppGuardTcpConnection::token() const {
-  // @@protoc_insertion_point(field_get:appguard.AppGuardTcpConnection.token)
-  return _internal_token();
+inline bool AppGuardIpInfo::has_asn() const {
+  return _internal_has_asn();
 }
-inline void AppGuardTcpConnection::set_token(const std::string& value) {
-  _internal_set_token(value);
-  // @@protoc_insertion_point(field_set:appguard.AppGuardTcpConnection.token)
+inline void AppGuardIpInfo::clear_asn() {
+  asn_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _has_bits_[0] &= ~0x00000002u;
 }
-inline std::string* AppGuardTcpConnection::mutable_token() {
-  // @@protoc_insertion_point(field_mutable:appguard.AppGuardTcpConnection.token)
-  return _internal_mutable_token();
+inline const std::string& AppGuardIpInfo::asn() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardIpInfo.asn)
+  return _internal_asn();
 }
-inline const std::string& AppGuardTcpConnection::_internal_token() const {
-  return token_.Get();
+inline void AppGuardIpInfo::set_asn(const std::string& value) {
+  _internal_set_asn(value);
+  // @@protoc_insertion_point(field_set:appguard.AppGuardIpInfo.asn)
 }
-inline void AppGuardTcpConnection::_internal_set_token(const std::string& value) {
-  
-  token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline std::string* AppGuardIpInfo::mutable_asn() {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardIpInfo.asn)
+  return _internal_mutable_asn();
+}
+inline const std::string& AppGuardIpInfo::_internal_asn() const {
+  return asn_.Get();
+}
+inline void AppGuardIpInfo::_internal_set_asn(const std::string& value) {
+  _has_bits_[0] |= 0x00000002u;
+  asn_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
 }
-inline void AppGuardTcpConnection::set_token(std::string&& value) {
-  
-  token_.Set(
+inline void AppGuardIpInfo::set_asn(std::string&& value) {
+  _has_bits_[0] |= 0x00000002u;
+  asn_.Set(
     &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardTcpConnection.token)
+  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardIpInfo.asn)
 }
-inline void AppGuardTcpConnection::set_token(const char* value) {
+inline void AppGuardIpInfo::set_asn(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  
-  token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+  _has_bits_[0] |= 0x00000002u;
+  asn_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
               GetArena());
-  // @@protoc_insertion_point(field_set_char:appguard.AppGuardTcpConnection.token)
+  // @@protoc_insertion_point(field_set_char:appguard.AppGuardIpInfo.asn)
 }
-inline void AppGuardTcpConnection::set_token(const char* value,
+inline void AppGuardIpInfo::set_asn(const char* value,
     size_t size) {
-  
-  token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+  _has_bits_[0] |= 0x00000002u;
+  asn_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
       reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardTcpConnection.token)
+  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardIpInfo.asn)
 }
-inline std::string* AppGuardTcpConnection::_internal_mutable_token() {
-  
-  return token_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* AppGuardIpInfo::_internal_mutable_asn() {
+  _has_bits_[0] |= 0x00000002u;
+  return asn_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline std::string* AppGuardTcpConnection::release_token() {
-  // @@protoc_insertion_point(field_release:appguard.AppGuardTcpConnection.token)
-  return token_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* AppGuardIpInfo::release_asn() {
+  // @@protoc_insertion_point(field_release:appguard.AppGuardIpInfo.asn)
+  if (!_internal_has_asn()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000002u;
+  return asn_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void AppGuardTcpConnection::set_allocated_token(std::string* token) {
-  if (token != nullptr) {
-    
+inline void AppGuardIpInfo::set_allocated_asn(std::string* asn) {
+  if (asn != nullptr) {
+    _has_bits_[0] |= 0x00000002u;
   } else {
-    
+    _has_bits_[0] &= ~0x00000002u;
   }
-  token_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), token,
+  asn_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), asn,
       GetArena());
-  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardTcpConnection.token)
+  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardIpInfo.asn)
 }
-inline std::string* AppGuardTcpConnection::unsafe_arena_release_token() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardTcpConnection.token)
+inline std::string* AppGuardIpInfo::unsafe_arena_release_asn() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardIpInfo.asn)
   GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return token_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+  _has_bits_[0] &= ~0x00000002u;
+  return asn_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       GetArena());
 }
-inline void AppGuardTcpConnection::unsafe_arena_set_allocated_token(
-    std::string* token) {
+inline void AppGuardIpInfo::unsafe_arena_set_allocated_asn(
+    std::string* asn) {
   GOOGLE_DCHECK(GetArena() != nullptr);
-  if (token != nullptr) {
-    
+  if (asn != nullptr) {
+    _has_bits_[0] |= 0x00000002u;
   } else {
-    
+    _has_bits_[0] &= ~0x00000002u;
   }
-  token_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      token, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardTcpConnection.token)
+  asn_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      asn, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardIpInfo.asn)
 }
 
-// string source_ip = 2;
-inline bool AppGuardTcpConnection::_internal_has_source_ip() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+// string org = 4;
+inline bool AppGuardIpInfo::_internal_has_org() const {
+  bool value = (_has_bits_[0] & 0x00000004u) != 0;
   return value;
 }
-inline bool AppGuardTcpConnection::has_source_ip() const {
-  return _internal_has_source_ip();
+inline bool AppGuardIpInfo::has_org() const {
+  return _internal_has_org();
 }
-inline void AppGuardTcpConnection::clear_source_ip() {
-  source_ip_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  _has_bits_[0] &= ~0x00000001u;
+inline void AppGuardIpInfo::clear_org() {
+  org_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _has_bits_[0] &= ~0x00000004u;
 }
-inline const std::string& AppGuardTcpConnection::source_ip() const {
-  // @@protoc_insertion_point(field_get:appguard.AppGuardTcpConnection.source_ip)
-  return _internal_source_ip();
+inline const std::string& AppGuardIpInfo::org() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardIpInfo.org)
+  return _internal_org();
 }
-inline void AppGuardTcpConnection::set_source_ip(const std::string& value) {
-  _internal_set_source_ip(value);
-  // @@protoc_insertion_point(field_set:appguard.AppGuardTcpConnection.source_ip)
+inline void AppGuardIpInfo::set_org(const std::string& value) {
+  _internal_set_org(value);
+  // @@protoc_insertion_point(field_set:appguard.AppGuardIpInfo.org)
 }
-inline std::string* AppGuardTcpConnection::mutable_source_ip() {
-  // @@protoc_insertion_point(field_mutable:appguard.AppGuardTcpConnection.source_ip)
-  return _internal_mutable_source_ip();
+inline std::string* AppGuardIpInfo::mutable_org() {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardIpInfo.org)
+  return _internal_mutable_org();
 }
-inline const std::string& AppGuardTcpConnection::_internal_source_ip() const {
-  return source_ip_.Get();
+inline const std::string& AppGuardIpInfo::_internal_org() const {
+  return org_.Get();
 }
-inline void AppGuardTcpConnection::_internal_set_source_ip(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  source_ip_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline void AppGuardIpInfo::_internal_set_org(const std::string& value) {
+  _has_bits_[0] |= 0x00000004u;
+  org_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
 }
-inline void AppGuardTcpConnection::set_source_ip(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  source_ip_.Set(
+inline void AppGuardIpInfo::set_org(std::string&& value) {
+  _has_bits_[0] |= 0x00000004u;
+  org_.Set(
     &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardTcpConnection.source_ip)
+  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardIpInfo.org)
 }
-inline void AppGuardTcpConnection::set_source_ip(const char* value) {
+inline void AppGuardIpInfo::set_org(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  source_ip_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+  _has_bits_[0] |= 0x00000004u;
+  org_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
               GetArena());
-  // @@protoc_insertion_point(field_set_char:appguard.AppGuardTcpConnection.source_ip)
+  // @@protoc_insertion_point(field_set_char:appguard.AppGuardIpInfo.org)
 }
-inline void AppGuardTcpConnection::set_source_ip(const char* value,
+inline void AppGuardIpInfo::set_org(const char* value,
     size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  source_ip_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+  _has_bits_[0] |= 0x00000004u;
+  org_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
       reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardTcpConnection.source_ip)
+  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardIpInfo.org)
 }
-inline std::string* AppGuardTcpConnection::_internal_mutable_source_ip() {
-  _has_bits_[0] |= 0x00000001u;
-  return source_ip_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* AppGuardIpInfo::_internal_mutable_org() {
+  _has_bits_[0] |= 0x00000004u;
+  return org_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline std::string* AppGuardTcpConnection::release_source_ip() {
-  // @@protoc_insertion_point(field_release:appguard.AppGuardTcpConnection.source_ip)
-  if (!_internal_has_source_ip()) {
+inline std::string* AppGuardIpInfo::release_org() {
+  // @@protoc_insertion_point(field_release:appguard.AppGuardIpInfo.org)
+  if (!_internal_has_org()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return source_ip_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _has_bits_[0] &= ~0x00000004u;
+  return org_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void AppGuardTcpConnection::set_allocated_source_ip(std::string* source_ip) {
-  if (source_ip != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+inline void AppGuardIpInfo::set_allocated_org(std::string* org) {
+  if (org != nullptr) {
+    _has_bits_[0] |= 0x00000004u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _has_bits_[0] &= ~0x00000004u;
   }
-  source_ip_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), source_ip,
+  org_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), org,
       GetArena());
-  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardTcpConnection.source_ip)
+  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardIpInfo.org)
 }
-inline std::string* AppGuardTcpConnection::unsafe_arena_release_source_ip() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardTcpConnection.source_ip)
+inline std::string* AppGuardIpInfo::unsafe_arena_release_org() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardIpInfo.org)
   GOOGLE_DCHECK(GetArena() != nullptr);
-  _has_bits_[0] &= ~0x00000001u;
-  return source_ip_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+  _has_bits_[0] &= ~0x00000004u;
+  return org_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       GetArena());
 }
-inline void AppGuardTcpConnection::unsafe_arena_set_allocated_source_ip(
-    std::string* source_ip) {
+inline void AppGuardIpInfo::unsafe_arena_set_allocated_org(
+    std::string* org) {
   GOOGLE_DCHECK(GetArena() != nullptr);
-  if (source_ip != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+  if (org != nullptr) {
+    _has_bits_[0] |= 0x00000004u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _has_bits_[0] &= ~0x00000004u;
   }
-  source_ip_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      source_ip, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardTcpConnection.source_ip)
+  org_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      org, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardIpInfo.org)
 }
 
-// uint32 source_port = 3;
-inline bool AppGuardTcpConnection::_internal_has_source_port() const {
-  bool value = (_has_bits_[0] & 0x00000004u) != 0;
+// string continent_code = 5;
+inline bool AppGuardIpInfo::_internal_has_continent_code() const {
+  bool value = (_has_bits_[0] & 0x00000008u) != 0;
   return value;
 }
-inline bool AppGuardTcpConnection::has_source_port() const {
-  return _internal_has_source_port();
+inline bool AppGuardIpInfo::has_continent_code() const {
+  return _internal_has_continent_code();
 }
-inline void AppGuardTcpConnection::clear_source_port() {
-  source_port_ = 0u;
-  _has_bits_[0] &= ~0x00000004u;
+inline void AppGuardIpInfo::clear_continent_code() {
+  continent_code_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _has_bits_[0] &= ~0x00000008u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 AppGuardTcpConnection::_internal_source_port() const {
-  return source_port_;
+inline const std::string& AppGuardIpInfo::continent_code() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardIpInfo.continent_code)
+  return _internal_continent_code();
+}
+inline void AppGuardIpInfo::set_continent_code(const std::string& value) {
+  _internal_set_continent_code(value);
+  // @@protoc_insertion_point(field_set:appguard.AppGuardIpInfo.continent_code)
+}
+inline std::string* AppGuardIpInfo::mutable_continent_code() {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardIpInfo.continent_code)
+  return _internal_mutable_continent_code();
+}
+inline const std::string& AppGuardIpInfo::_internal_continent_code() const {
+  return continent_code_.Get();
+}
+inline void AppGuardIpInfo::_internal_set_continent_code(const std::string& value) {
+  _has_bits_[0] |= 0x00000008u;
+  continent_code_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void AppGuardIpInfo::set_continent_code(std::string&& value) {
+  _has_bits_[0] |= 0x00000008u;
+  continent_code_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardIpInfo.continent_code)
+}
+inline void AppGuardIpInfo::set_continent_code(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _has_bits_[0] |= 0x00000008u;
+  continent_code_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:appguard.AppGuardIpInfo.continent_code)
+}
+inline void AppGuardIpInfo::set_continent_code(const char* value,
+    size_t size) {
+  _has_bits_[0] |= 0x00000008u;
+  continent_code_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardIpInfo.continent_code)
+}
+inline std::string* AppGuardIpInfo::_internal_mutable_continent_code() {
+  _has_bits_[0] |= 0x00000008u;
+  return continent_code_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 AppGuardTcpConnection::source_port() const {
-  // @@protoc_insertion_point(field_get:appguard.AppGuardTcpConnection.source_port)
-  return _internal_source_port();
+inline std::string* AppGuardIpInfo::release_continent_code() {
+  // @@protoc_insertion_point(field_release:appguard.AppGuardIpInfo.continent_code)
+  if (!_internal_has_continent_code()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000008u;
+  return continent_code_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void AppGuardTcpConnection::_internal_set_source_port(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _has_bits_[0] |= 0x00000004u;
-  source_port_ = value;
+inline void AppGuardIpInfo::set_allocated_continent_code(std::string* continent_code) {
+  if (continent_code != nullptr) {
+    _has_bits_[0] |= 0x00000008u;
+  } else {
+    _has_bits_[0] &= ~0x00000008u;
+  }
+  continent_code_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), continent_code,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardIpInfo.continent_code)
 }
-inline void AppGuardTcpConnection::set_source_port(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _internal_set_source_port(value);
-  // @@protoc_insertion_point(field_set:appguard.AppGuardTcpConnection.source_port)
+inline std::string* AppGuardIpInfo::unsafe_arena_release_continent_code() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardIpInfo.continent_code)
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  _has_bits_[0] &= ~0x00000008u;
+  return continent_code_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      GetArena());
+}
+inline void AppGuardIpInfo::unsafe_arena_set_allocated_continent_code(
+    std::string* continent_code) {
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  if (continent_code != nullptr) {
+    _has_bits_[0] |= 0x00000008u;
+  } else {
+    _has_bits_[0] &= ~0x00000008u;
+  }
+  continent_code_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      continent_code, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardIpInfo.continent_code)
 }
 
-// string destination_ip = 4;
-inline bool AppGuardTcpConnection::_internal_has_destination_ip() const {
-  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+// string city = 6;
+inline bool AppGuardIpInfo::_internal_has_city() const {
+  bool value = (_has_bits_[0] & 0x00000010u) != 0;
   return value;
 }
-inline bool AppGuardTcpConnection::has_destination_ip() const {
-  return _internal_has_destination_ip();
+inline bool AppGuardIpInfo::has_city() const {
+  return _internal_has_city();
 }
-inline void AppGuardTcpConnection::clear_destination_ip() {
-  destination_ip_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  _has_bits_[0] &= ~0x00000002u;
+inline void AppGuardIpInfo::clear_city() {
+  city_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _has_bits_[0] &= ~0x00000010u;
 }
-inline const std::string& AppGuardTcpConnection::destination_ip() const {
-  // @@protoc_insertion_point(field_get:appguard.AppGuardTcpConnection.destination_ip)
-  return _internal_destination_ip();
+inline const std::string& AppGuardIpInfo::city() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardIpInfo.city)
+  return _internal_city();
 }
-inline void AppGuardTcpConnection::set_destination_ip(const std::string& value) {
-  _internal_set_destination_ip(value);
-  // @@protoc_insertion_point(field_set:appguard.AppGuardTcpConnection.destination_ip)
+inline void AppGuardIpInfo::set_city(const std::string& value) {
+  _internal_set_city(value);
+  // @@protoc_insertion_point(field_set:appguard.AppGuardIpInfo.city)
 }
-inline std::string* AppGuardTcpConnection::mutable_destination_ip() {
-  // @@protoc_insertion_point(field_mutable:appguard.AppGuardTcpConnection.destination_ip)
-  return _internal_mutable_destination_ip();
+inline std::string* AppGuardIpInfo::mutable_city() {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardIpInfo.city)
+  return _internal_mutable_city();
 }
-inline const std::string& AppGuardTcpConnection::_internal_destination_ip() const {
-  return destination_ip_.Get();
+inline const std::string& AppGuardIpInfo::_internal_city() const {
+  return city_.Get();
 }
-inline void AppGuardTcpConnection::_internal_set_destination_ip(const std::string& value) {
-  _has_bits_[0] |= 0x00000002u;
-  destination_ip_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline void AppGuardIpInfo::_internal_set_city(const std::string& value) {
+  _has_bits_[0] |= 0x00000010u;
+  city_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
 }
-inline void AppGuardTcpConnection::set_destination_ip(std::string&& value) {
-  _has_bits_[0] |= 0x00000002u;
-  destination_ip_.Set(
+inline void AppGuardIpInfo::set_city(std::string&& value) {
+  _has_bits_[0] |= 0x00000010u;
+  city_.Set(
     &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardTcpConnection.destination_ip)
+  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardIpInfo.city)
 }
-inline void AppGuardTcpConnection::set_destination_ip(const char* value) {
+inline void AppGuardIpInfo::set_city(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000002u;
-  destination_ip_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+  _has_bits_[0] |= 0x00000010u;
+  city_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
               GetArena());
-  // @@protoc_insertion_point(field_set_char:appguard.AppGuardTcpConnection.destination_ip)
+  // @@protoc_insertion_point(field_set_char:appguard.AppGuardIpInfo.city)
 }
-inline void AppGuardTcpConnection::set_destination_ip(const char* value,
+inline void AppGuardIpInfo::set_city(const char* value,
     size_t size) {
-  _has_bits_[0] |= 0x00000002u;
-  destination_ip_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+  _has_bits_[0] |= 0x00000010u;
+  city_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
       reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardTcpConnection.destination_ip)
+  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardIpInfo.city)
 }
-inline std::string* AppGuardTcpConnection::_internal_mutable_destination_ip() {
-  _has_bits_[0] |= 0x00000002u;
-  return destination_ip_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* AppGuardIpInfo::_internal_mutable_city() {
+  _has_bits_[0] |= 0x00000010u;
+  return city_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline std::string* AppGuardTcpConnection::release_destination_ip() {
-  // @@protoc_insertion_point(field_release:appguard.AppGuardTcpConnection.destination_ip)
-  if (!_internal_has_destination_ip()) {
+inline std::string* AppGuardIpInfo::release_city() {
+  // @@protoc_insertion_point(field_release:appguard.AppGuardIpInfo.city)
+  if (!_internal_has_city()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000002u;
-  return destination_ip_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _has_bits_[0] &= ~0x00000010u;
+  return city_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void AppGuardTcpConnection::set_allocated_destination_ip(std::string* destination_ip) {
-  if (destination_ip != nullptr) {
-    _has_bits_[0] |= 0x00000002u;
+inline void AppGuardIpInfo::set_allocated_city(std::string* city) {
+  if (city != nullptr) {
+    _has_bits_[0] |= 0x00000010u;
   } else {
-    _has_bits_[0] &= ~0x00000002u;
+    _has_bits_[0] &= ~0x00000010u;
   }
-  destination_ip_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), destination_ip,
+  city_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), city,
       GetArena());
-  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardTcpConnection.destination_ip)
+  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardIpInfo.city)
 }
-inline std::string* AppGuardTcpConnection::unsafe_arena_release_destination_ip() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardTcpConnection.destination_ip)
+inline std::string* AppGuardIpInfo::unsafe_arena_release_city() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardIpInfo.city)
   GOOGLE_DCHECK(GetArena() != nullptr);
-  _has_bits_[0] &= ~0x00000002u;
-  return destination_ip_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+  _has_bits_[0] &= ~0x00000010u;
+  return city_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       GetArena());
 }
-inline void AppGuardTcpConnection::unsafe_arena_set_allocated_destination_ip(
-    std::string* destination_ip) {
+inline void AppGuardIpInfo::unsafe_arena_set_allocated_city(
+    std::string* city) {
   GOOGLE_DCHECK(GetArena() != nullptr);
-  if (destination_ip != nullptr) {
-    _has_bits_[0] |= 0x00000002u;
+  if (city != nullptr) {
+    _has_bits_[0] |= 0x00000010u;
   } else {
-    _has_bits_[0] &= ~0x00000002u;
+    _has_bits_[0] &= ~0x00000010u;
   }
-  destination_ip_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      destination_ip, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardTcpConnection.destination_ip)
+  city_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      city, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardIpInfo.city)
 }
 
-// uint32 destination_port = 5;
-inline bool AppGuardTcpConnection::_internal_has_destination_port() const {
-  bool value = (_has_bits_[0] & 0x00000008u) != 0;
+// string region = 7;
+inline bool AppGuardIpInfo::_internal_has_region() const {
+  bool value = (_has_bits_[0] & 0x00000020u) != 0;
   return value;
 }
-inline bool AppGuardTcpConnection::has_destination_port() const {
-  return _internal_has_destination_port();
-}
-inline void AppGuardTcpConnection::clear_destination_port() {
-  destination_port_ = 0u;
-  _has_bits_[0] &= ~0x00000008u;
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint32 AppGuardTcpConnection::_internal_destination_port() const {
-  return destination_port_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint32 AppGuardTcpConnection::destination_port() const {
-  // @@protoc_insertion_point(field_get:appguard.AppGuardTcpConnection.destination_port)
-  return _internal_destination_port();
-}
-inline void AppGuardTcpConnection::_internal_set_destination_port(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _has_bits_[0] |= 0x00000008u;
-  destination_port_ = value;
-}
-inline void AppGuardTcpConnection::set_destination_port(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _internal_set_destination_port(value);
-  // @@protoc_insertion_point(field_set:appguard.AppGuardTcpConnection.destination_port)
+inline bool AppGuardIpInfo::has_region() const {
+  return _internal_has_region();
 }
-
-// string protocol = 6;
-inline void AppGuardTcpConnection::clear_protocol() {
-  protocol_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline void AppGuardIpInfo::clear_region() {
+  region_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _has_bits_[0] &= ~0x00000020u;
 }
-inline const std::string& AppGuardTcpConnection::protocol() const {
-  // @@protoc_insertion_point(field_get:appguard.AppGuardTcpConnection.protocol)
-  return _internal_protocol();
+inline const std::string& AppGuardIpInfo::region() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardIpInfo.region)
+  return _internal_region();
 }
-inline void AppGuardTcpConnection::set_protocol(const std::string& value) {
-  _internal_set_protocol(value);
-  // @@protoc_insertion_point(field_set:appguard.AppGuardTcpConnection.protocol)
+inline void AppGuardIpInfo::set_region(const std::string& value) {
+  _internal_set_region(value);
+  // @@protoc_insertion_point(field_set:appguard.AppGuardIpInfo.region)
 }
-inline std::string* AppGuardTcpConnection::mutable_protocol() {
-  // @@protoc_insertion_point(field_mutable:appguard.AppGuardTcpConnection.protocol)
-  return _internal_mutable_protocol();
+inline std::string* AppGuardIpInfo::mutable_region() {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardIpInfo.region)
+  return _internal_mutable_region();
 }
-inline const std::string& AppGuardTcpConnection::_internal_protocol() const {
-  return protocol_.Get();
+inline const std::string& AppGuardIpInfo::_internal_region() const {
+  return region_.Get();
 }
-inline void AppGuardTcpConnection::_internal_set_protocol(const std::string& value) {
-  
-  protocol_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline void AppGuardIpInfo::_internal_set_region(const std::string& value) {
+  _has_bits_[0] |= 0x00000020u;
+  region_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
 }
-inline void AppGuardTcpConnection::set_protocol(std::string&& value) {
-  
-  protocol_.Set(
+inline void AppGuardIpInfo::set_region(std::string&& value) {
+  _has_bits_[0] |= 0x00000020u;
+  region_.Set(
     &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardTcpConnection.protocol)
+  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardIpInfo.region)
 }
-inline void AppGuardTcpConnection::set_protocol(const char* value) {
+inline void AppGuardIpInfo::set_region(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  
-  protocol_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+  _has_bits_[0] |= 0x00000020u;
+  region_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
               GetArena());
-  // @@protoc_insertion_point(field_set_char:appguard.AppGuardTcpConnection.protocol)
+  // @@protoc_insertion_point(field_set_char:appguard.AppGuardIpInfo.region)
 }
-inline void AppGuardTcpConnection::set_protocol(const char* value,
+inline void AppGuardIpInfo::set_region(const char* value,
     size_t size) {
-  
-  protocol_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+  _has_bits_[0] |= 0x00000020u;
+  region_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
       reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardTcpConnection.protocol)
+  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardIpInfo.region)
 }
-inline std::string* AppGuardTcpConnection::_internal_mutable_protocol() {
-  
-  return protocol_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* AppGuardIpInfo::_internal_mutable_region() {
+  _has_bits_[0] |= 0x00000020u;
+  return region_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline std::string* AppGuardTcpConnection::release_protocol() {
-  // @@protoc_insertion_point(field_release:appguard.AppGuardTcpConnection.protocol)
-  return protocol_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* AppGuardIpInfo::release_region() {
+  // @@protoc_insertion_point(field_release:appguard.AppGuardIpInfo.region)
+  if (!_internal_has_region()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000020u;
+  return region_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void AppGuardTcpConnection::set_allocated_protocol(std::string* protocol) {
-  if (protocol != nullptr) {
-    
+inline void AppGuardIpInfo::set_allocated_region(std::string* region) {
+  if (region != nullptr) {
+    _has_bits_[0] |= 0x00000020u;
   } else {
-    
+    _has_bits_[0] &= ~0x00000020u;
   }
-  protocol_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), protocol,
+  region_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), region,
       GetArena());
-  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardTcpConnection.protocol)
+  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardIpInfo.region)
 }
-inline std::string* AppGuardTcpConnection::unsafe_arena_release_protocol() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardTcpConnection.protocol)
+inline std::string* AppGuardIpInfo::unsafe_arena_release_region() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardIpInfo.region)
   GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return protocol_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+  _has_bits_[0] &= ~0x00000020u;
+  return region_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       GetArena());
 }
-inline void AppGuardTcpConnection::unsafe_arena_set_allocated_protocol(
-    std::string* protocol) {
+inline void AppGuardIpInfo::unsafe_arena_set_allocated_region(
+    std::string* region) {
   GOOGLE_DCHECK(GetArena() != nullptr);
-  if (protocol != nullptr) {
-    
+  if (region != nullptr) {
+    _has_bits_[0] |= 0x00000020u;
   } else {
-    
+    _has_bits_[0] &= ~0x00000020u;
   }
-  protocol_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      protocol, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardTcpConnection.protocol)
+  region_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      region, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardIpInfo.region)
 }
 
-// -------------------------------------------------------------------
-
-// AppGuardIpInfo
-
-// string ip = 1;
-inline void AppGuardIpInfo::clear_ip() {
-  ip_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// string postal = 8;
+inline bool AppGuardIpInfo::_internal_has_postal() const {
+  bool value = (_has_bits_[0] & 0x00000040u) != 0;
+  return value;
 }
-inline const std::string& AppGuardIpInfo::ip() const {
-  // @@protoc_insertion_point(field_get:appguard.AppGuardIpInfo.ip)
-  return _internal_ip();
+inline bool AppGuardIpInfo::has_postal() const {
+  return _internal_has_postal();
 }
-inline void AppGuardIpInfo::set_ip(const std::string& value) {
-  _internal_set_ip(value);
-  // @@protoc_insertion_point(field_set:appguard.AppGuardIpInfo.ip)
+inline void AppGuardIpInfo::clear_postal() {
+  postal_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _has_bits_[0] &= ~0x00000040u;
 }
-inline std::string* AppGuardIpInfo::mutable_ip() {
-  // @@protoc_insertion_point(field_mutable:appguard.AppGuardIpInfo.ip)
-  return _internal_mutable_ip();
+inline const std::string& AppGuardIpInfo::postal() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardIpInfo.postal)
+  return _internal_postal();
 }
-inline const std::string& AppGuardIpInfo::_internal_ip() const {
-  return ip_.Get();
+inline void AppGuardIpInfo::set_postal(const std::string& value) {
+  _internal_set_postal(value);
+  // @@protoc_insertion_point(field_set:appguard.AppGuardIpInfo.postal)
 }
-inline void AppGuardIpInfo::_internal_set_ip(const std::string& value) {
-  
-  ip_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline std::string* AppGuardIpInfo::mutable_postal() {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardIpInfo.postal)
+  return _internal_mutable_postal();
 }
-inline void AppGuardIpInfo::set_ip(std::string&& value) {
-  
-  ip_.Set(
+inline const std::string& AppGuardIpInfo::_internal_postal() const {
+  return postal_.Get();
+}
+inline void AppGuardIpInfo::_internal_set_postal(const std::string& value) {
+  _has_bits_[0] |= 0x00000040u;
+  postal_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void AppGuardIpInfo::set_postal(std::string&& value) {
+  _has_bits_[0] |= 0x00000040u;
+  postal_.Set(
     &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardIpInfo.ip)
+  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardIpInfo.postal)
 }
-inline void AppGuardIpInfo::set_ip(const char* value) {
+inline void AppGuardIpInfo::set_postal(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  
-  ip_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+  _has_bits_[0] |= 0x00000040u;
+  postal_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
               GetArena());
-  // @@protoc_insertion_point(field_set_char:appguard.AppGuardIpInfo.ip)
+  // @@protoc_insertion_point(field_set_char:appguard.AppGuardIpInfo.postal)
 }
-inline void AppGuardIpInfo::set_ip(const char* value,
+inline void AppGuardIpInfo::set_postal(const char* value,
     size_t size) {
-  
-  ip_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+  _has_bits_[0] |= 0x00000040u;
+  postal_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
       reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardIpInfo.ip)
+  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardIpInfo.postal)
 }
-inline std::string* AppGuardIpInfo::_internal_mutable_ip() {
-  
-  return ip_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* AppGuardIpInfo::_internal_mutable_postal() {
+  _has_bits_[0] |= 0x00000040u;
+  return postal_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline std::string* AppGuardIpInfo::release_ip() {
-  // @@protoc_insertion_point(field_release:appguard.AppGuardIpInfo.ip)
-  return ip_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* AppGuardIpInfo::release_postal() {
+  // @@protoc_insertion_point(field_release:appguard.AppGuardIpInfo.postal)
+  if (!_internal_has_postal()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000040u;
+  return postal_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void AppGuardIpInfo::set_allocated_ip(std::string* ip) {
-  if (ip != nullptr) {
-    
+inline void AppGuardIpInfo::set_allocated_postal(std::string* postal) {
+  if (postal != nullptr) {
+    _has_bits_[0] |= 0x00000040u;
   } else {
-    
+    _has_bits_[0] &= ~0x00000040u;
   }
-  ip_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ip,
+  postal_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), postal,
       GetArena());
-  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardIpInfo.ip)
+  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardIpInfo.postal)
 }
-inline std::string* AppGuardIpInfo::unsafe_arena_release_ip() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardIpInfo.ip)
+inline std::string* AppGuardIpInfo::unsafe_arena_release_postal() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardIpInfo.postal)
   GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return ip_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+  _has_bits_[0] &= ~0x00000040u;
+  return postal_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       GetArena());
 }
-inline void AppGuardIpInfo::unsafe_arena_set_allocated_ip(
-    std::string* ip) {
+inline void AppGuardIpInfo::unsafe_arena_set_allocated_postal(
+    std::string* postal) {
   GOOGLE_DCHECK(GetArena() != nullptr);
-  if (ip != nullptr) {
-    
+  if (postal != nullptr) {
+    _has_bits_[0] |= 0x00000040u;
   } else {
-    
+    _has_bits_[0] &= ~0x00000040u;
   }
-  ip_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ip, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardIpInfo.ip)
+  postal_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      postal, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardIpInfo.postal)
 }
 
-// string country = 2;
-inline bool AppGuardIpInfo::_internal_has_country() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+// string timezone = 9;
+inline bool AppGuardIpInfo::_internal_has_timezone() const {
+  bool value = (_has_bits_[0] & 0x00000080u) != 0;
   return value;
 }
-inline bool AppGuardIpInfo::has_country() const {
-  return _internal_has_country();
+inline bool AppGuardIpInfo::has_timezone() const {
+  return _internal_has_timezone();
 }
-inline void AppGuardIpInfo::clear_country() {
-  country_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  _has_bits_[0] &= ~0x00000001u;
+inline void AppGuardIpInfo::clear_timezone() {
+  timezone_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _has_bits_[0] &= ~0x00000080u;
 }
-inline const std::string& AppGuardIpInfo::country() const {
-  // @@protoc_insertion_point(field_get:appguard.AppGuardIpInfo.country)
-  return _internal_country();
+inline const std::string& AppGuardIpInfo::timezone() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardIpInfo.timezone)
+  return _internal_timezone();
 }
-inline void AppGuardIpInfo::set_country(const std::string& value) {
-  _internal_set_country(value);
-  // @@protoc_insertion_point(field_set:appguard.AppGuardIpInfo.country)
+inline void AppGuardIpInfo::set_timezone(const std::string& value) {
+  _internal_set_timezone(value);
+  // @@protoc_insertion_point(field_set:appguard.AppGuardIpInfo.timezone)
 }
-inline std::string* AppGuardIpInfo::mutable_country() {
-  // @@protoc_insertion_point(field_mutable:appguard.AppGuardIpInfo.country)
-  return _internal_mutable_country();
+inline std::string* AppGuardIpInfo::mutable_timezone() {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardIpInfo.timezone)
+  return _internal_mutable_timezone();
 }
-inline const std::string& AppGuardIpInfo::_internal_country() const {
-  return country_.Get();
+inline const std::string& AppGuardIpInfo::_internal_timezone() const {
+  return timezone_.Get();
 }
-inline void AppGuardIpInfo::_internal_set_country(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  country_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline void AppGuardIpInfo::_internal_set_timezone(const std::string& value) {
+  _has_bits_[0] |= 0x00000080u;
+  timezone_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
 }
-inline void AppGuardIpInfo::set_country(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  country_.Set(
+inline void AppGuardIpInfo::set_timezone(std::string&& value) {
+  _has_bits_[0] |= 0x00000080u;
+  timezone_.Set(
     &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardIpInfo.country)
+  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardIpInfo.timezone)
 }
-inline void AppGuardIpInfo::set_country(const char* value) {
+inline void AppGuardIpInfo::set_timezone(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  country_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+  _has_bits_[0] |= 0x00000080u;
+  timezone_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
               GetArena());
-  // @@protoc_insertion_point(field_set_char:appguard.AppGuardIpInfo.country)
+  // @@protoc_insertion_point(field_set_char:appguard.AppGuardIpInfo.timezone)
 }
-inline void AppGuardIpInfo::set_country(const char* value,
+inline void AppGuardIpInfo::set_timezone(const char* value,
     size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  country_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+  _has_bits_[0] |= 0x00000080u;
+  timezone_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
       reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardIpInfo.country)
+  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardIpInfo.timezone)
 }
-inline std::string* AppGuardIpInfo::_internal_mutable_country() {
-  _has_bits_[0] |= 0x00000001u;
-  return country_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* AppGuardIpInfo::_internal_mutable_timezone() {
+  _has_bits_[0] |= 0x00000080u;
+  return timezone_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline std::string* AppGuardIpInfo::release_country() {
-  // @@protoc_insertion_point(field_release:appguard.AppGuardIpInfo.country)
-  if (!_internal_has_country()) {
+inline std::string* AppGuardIpInfo::release_timezone() {
+  // @@protoc_insertion_point(field_release:appguard.AppGuardIpInfo.timezone)
+  if (!_internal_has_timezone()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return country_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline void AppGuardIpInfo::set_allocated_country(std::string* country) {
-  if (country != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+  _has_bits_[0] &= ~0x00000080u;
+  return timezone_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void AppGuardIpInfo::set_allocated_timezone(std::string* timezone) {
+  if (timezone != nullptr) {
+    _has_bits_[0] |= 0x00000080u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _has_bits_[0] &= ~0x00000080u;
   }
-  country_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), country,
+  timezone_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), timezone,
       GetArena());
-  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardIpInfo.country)
+  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardIpInfo.timezone)
 }
-inline std::string* AppGuardIpInfo::unsafe_arena_release_country() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardIpInfo.country)
+inline std::string* AppGuardIpInfo::unsafe_arena_release_timezone() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardIpInfo.timezone)
   GOOGLE_DCHECK(GetArena() != nullptr);
-  _has_bits_[0] &= ~0x00000001u;
-  return country_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+  _has_bits_[0] &= ~0x00000080u;
+  return timezone_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       GetArena());
 }
-inline void AppGuardIpInfo::unsafe_arena_set_allocated_country(
-    std::string* country) {
+inline void AppGuardIpInfo::unsafe_arena_set_allocated_timezone(
+    std::string* timezone) {
   GOOGLE_DCHECK(GetArena() != nullptr);
-  if (country != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+  if (timezone != nullptr) {
+    _has_bits_[0] |= 0x00000080u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _has_bits_[0] &= ~0x00000080u;
   }
-  country_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      country, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardIpInfo.country)
+  timezone_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      timezone, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardIpInfo.timezone)
 }
 
-// string asn = 3;
-inline bool AppGuardIpInfo::_internal_has_asn() const {
-  bool value = (_has_bits_[0] & 0x00000002u) != 0;
-  return value;
+// -------------------------------------------------------------------
+
+// AppGuardTcpInfo
+
+// .appguard.AppGuardTcpConnection connection = 1;
+inline bool AppGuardTcpInfo::_internal_has_connection() const {
+  return this != internal_default_instance() && connection_ != nullptr;
 }
-inline bool AppGuardIpInfo::has_asn() const {
-  return _internal_has_asn();
+inline bool AppGuardTcpInfo::has_connection() const {
+  return _internal_has_connection();
 }
-inline void AppGuardIpInfo::clear_asn() {
-  asn_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  _has_bits_[0] &= ~0x00000002u;
+inline void AppGuardTcpInfo::clear_connection() {
+  if (GetArena() == nullptr && connection_ != nullptr) {
+    delete connection_;
+  }
+  connection_ = nullptr;
 }
-inline const std::string& AppGuardIpInfo::asn() const {
-  // @@protoc_insertion_point(field_get:appguard.AppGuardIpInfo.asn)
-  return _internal_asn();
+inline const ::appguard::AppGuardTcpConnection& AppGuardTcpInfo::_internal_connection() const {
+  const ::appguard::AppGuardTcpConnection* p = connection_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::appguard::AppGuardTcpConnection*>(
+      &::appguard::_AppGuardTcpConnection_default_instance_);
 }
-inline void AppGuardIpInfo::set_asn(const std::string& value) {
-  _internal_set_asn(value);
-  // @@protoc_insertion_point(field_set:appguard.AppGuardIpInfo.asn)
+inline const ::appguard::AppGuardTcpConnection& AppGuardTcpInfo::connection() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardTcpInfo.connection)
+  return _internal_connection();
 }
-inline std::string* AppGuardIpInfo::mutable_asn() {
-  // @@protoc_insertion_point(field_mutable:appguard.AppGuardIpInfo.asn)
-  return _internal_mutable_asn();
+inline void AppGuardTcpInfo::unsafe_arena_set_allocated_connection(
+    ::appguard::AppGuardTcpConnection* connection) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(connection_);
+  }
+  connection_ = connection;
+  if (connection) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardTcpInfo.connection)
 }
-inline const std::string& AppGuardIpInfo::_internal_asn() const {
-  return asn_.Get();
+inline ::appguard::AppGuardTcpConnection* AppGuardTcpInfo::release_connection() {
+  auto temp = unsafe_arena_release_connection();
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
 }
-inline void AppGuardIpInfo::_internal_set_asn(const std::string& value) {
-  _has_bits_[0] |= 0x00000002u;
-  asn_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline ::appguard::AppGuardTcpConnection* AppGuardTcpInfo::unsafe_arena_release_connection() {
+  // @@protoc_insertion_point(field_release:appguard.AppGuardTcpInfo.connection)
+  
+  ::appguard::AppGuardTcpConnection* temp = connection_;
+  connection_ = nullptr;
+  return temp;
 }
-inline void AppGuardIpInfo::set_asn(std::string&& value) {
-  _has_bits_[0] |= 0x00000002u;
-  asn_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardIpInfo.asn)
+inline ::appguard::AppGuardTcpConnection* AppGuardTcpInfo::_internal_mutable_connection() {
+  
+  if (connection_ == nullptr) {
+    auto* p = CreateMaybeMessage<::appguard::AppGuardTcpConnection>(GetArena());
+    connection_ = p;
+  }
+  return connection_;
 }
-inline void AppGuardIpInfo::set_asn(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000002u;
-  asn_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:appguard.AppGuardIpInfo.asn)
+inline ::appguard::AppGuardTcpConnection* AppGuardTcpInfo::mutable_connection() {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardTcpInfo.connection)
+  return _internal_mutable_connection();
 }
-inline void AppGuardIpInfo::set_asn(const char* value,
-    size_t size) {
-  _has_bits_[0] |= 0x00000002u;
-  asn_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardIpInfo.asn)
+inline void AppGuardTcpInfo::set_allocated_connection(::appguard::AppGuardTcpConnection* connection) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete connection_;
+  }
+  if (connection) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(connection);
+    if (message_arena != submessage_arena) {
+      connection = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, connection, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  connection_ = connection;
+  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardTcpInfo.connection)
 }
-inline std::string* AppGuardIpInfo::_internal_mutable_asn() {
-  _has_bits_[0] |= 0x00000002u;
-  return asn_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+
+// .appguard.AppGuardIpInfo ip_info = 2;
+inline bool AppGuardTcpInfo::_internal_has_ip_info() const {
+  return this != internal_default_instance() && ip_info_ != nullptr;
 }
-inline std::string* AppGuardIpInfo::release_asn() {
-  // @@protoc_insertion_point(field_release:appguard.AppGuardIpInfo.asn)
-  if (!_internal_has_asn()) {
-    return nullptr;
+inline bool AppGuardTcpInfo::has_ip_info() const {
+  return _internal_has_ip_info();
+}
+inline void AppGuardTcpInfo::clear_ip_info() {
+  if (GetArena() == nullptr && ip_info_ != nullptr) {
+    delete ip_info_;
   }
-  _has_bits_[0] &= ~0x00000002u;
-  return asn_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  ip_info_ = nullptr;
 }
-inline void AppGuardIpInfo::set_allocated_asn(std::string* asn) {
-  if (asn != nullptr) {
-    _has_bits_[0] |= 0x00000002u;
+inline const ::appguard::AppGuardIpInfo& AppGuardTcpInfo::_internal_ip_info() const {
+  const ::appguard::AppGuardIpInfo* p = ip_info_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::appguard::AppGuardIpInfo*>(
+      &::appguard::_AppGuardIpInfo_default_instance_);
+}
+inline const ::appguard::AppGuardIpInfo& AppGuardTcpInfo::ip_info() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardTcpInfo.ip_info)
+  return _internal_ip_info();
+}
+inline void AppGuardTcpInfo::unsafe_arena_set_allocated_ip_info(
+    ::appguard::AppGuardIpInfo* ip_info) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(ip_info_);
+  }
+  ip_info_ = ip_info;
+  if (ip_info) {
+    
   } else {
-    _has_bits_[0] &= ~0x00000002u;
+    
   }
-  asn_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), asn,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardIpInfo.asn)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardTcpInfo.ip_info)
 }
-inline std::string* AppGuardIpInfo::unsafe_arena_release_asn() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardIpInfo.asn)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  _has_bits_[0] &= ~0x00000002u;
-  return asn_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+inline ::appguard::AppGuardIpInfo* AppGuardTcpInfo::release_ip_info() {
+  auto temp = unsafe_arena_release_ip_info();
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
 }
-inline void AppGuardIpInfo::unsafe_arena_set_allocated_asn(
-    std::string* asn) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (asn != nullptr) {
-    _has_bits_[0] |= 0x00000002u;
+inline ::appguard::AppGuardIpInfo* AppGuardTcpInfo::unsafe_arena_release_ip_info() {
+  // @@protoc_insertion_point(field_release:appguard.AppGuardTcpInfo.ip_info)
+  
+  ::appguard::AppGuardIpInfo* temp = ip_info_;
+  ip_info_ = nullptr;
+  return temp;
+}
+inline ::appguard::AppGuardIpInfo* AppGuardTcpInfo::_internal_mutable_ip_info() {
+  
+  if (ip_info_ == nullptr) {
+    auto* p = CreateMaybeMessage<::appguard::AppGuardIpInfo>(GetArena());
+    ip_info_ = p;
+  }
+  return ip_info_;
+}
+inline ::appguard::AppGuardIpInfo* AppGuardTcpInfo::mutable_ip_info() {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardTcpInfo.ip_info)
+  return _internal_mutable_ip_info();
+}
+inline void AppGuardTcpInfo::set_allocated_ip_info(::appguard::AppGuardIpInfo* ip_info) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete ip_info_;
+  }
+  if (ip_info) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(ip_info);
+    if (message_arena != submessage_arena) {
+      ip_info = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, ip_info, submessage_arena);
+    }
+    
   } else {
-    _has_bits_[0] &= ~0x00000002u;
+    
   }
-  asn_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      asn, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardIpInfo.asn)
+  ip_info_ = ip_info;
+  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardTcpInfo.ip_info)
+}
+
+// uint64 tcp_id = 3;
+inline void AppGuardTcpInfo::clear_tcp_id() {
+  tcp_id_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 AppGuardTcpInfo::_internal_tcp_id() const {
+  return tcp_id_;
 }
-
-// string org = 4;
-inline bool AppGuardIpInfo::_internal_has_org() const {
-  bool value = (_has_bits_[0] & 0x00000004u) != 0;
-  return value;
+inline ::PROTOBUF_NAMESPACE_ID::uint64 AppGuardTcpInfo::tcp_id() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardTcpInfo.tcp_id)
+  return _internal_tcp_id();
 }
-inline bool AppGuardIpInfo::has_org() const {
-  return _internal_has_org();
+inline void AppGuardTcpInfo::_internal_set_tcp_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  tcp_id_ = value;
 }
-inline void AppGuardIpInfo::clear_org() {
-  org_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  _has_bits_[0] &= ~0x00000004u;
+inline void AppGuardTcpInfo::set_tcp_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_tcp_id(value);
+  // @@protoc_insertion_point(field_set:appguard.AppGuardTcpInfo.tcp_id)
 }
-inline const std::string& AppGuardIpInfo::org() const {
-  // @@protoc_insertion_point(field_get:appguard.AppGuardIpInfo.org)
-  return _internal_org();
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// AppGuardHttpRequest
+
+// string token = 1;
+inline void AppGuardHttpRequest::clear_token() {
+  token_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void AppGuardIpInfo::set_org(const std::string& value) {
-  _internal_set_org(value);
-  // @@protoc_insertion_point(field_set:appguard.AppGuardIpInfo.org)
+inline const std::string& AppGuardHttpRequest::token() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardHttpRequest.token)
+  return _internal_token();
 }
-inline std::string* AppGuardIpInfo::mutable_org() {
-  // @@protoc_insertion_point(field_mutable:appguard.AppGuardIpInfo.org)
-  return _internal_mutable_org();
+inline void AppGuardHttpRequest::set_token(const std::string& value) {
+  _internal_set_token(value);
+  // @@protoc_insertion_point(field_set:appguard.AppGuardHttpRequest.token)
 }
-inline const std::string& AppGuardIpInfo::_internal_org() const {
-  return org_.Get();
+inline std::string* AppGuardHttpRequest::mutable_token() {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardHttpRequest.token)
+  return _internal_mutable_token();
 }
-inline void AppGuardIpInfo::_internal_set_org(const std::string& value) {
-  _has_bits_[0] |= 0x00000004u;
-  org_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline const std::string& AppGuardHttpRequest::_internal_token() const {
+  return token_.Get();
 }
-inline void AppGuardIpInfo::set_org(std::string&& value) {
-  _has_bits_[0] |= 0x00000004u;
-  org_.Set(
+inline void AppGuardHttpRequest::_internal_set_token(const std::string& value) {
+  
+  token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void AppGuardHttpRequest::set_token(std::string&& value) {
+  
+  token_.Set(
     &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardIpInfo.org)
+  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardHttpRequest.token)
 }
-inline void AppGuardIpInfo::set_org(const char* value) {
+inline void AppGuardHttpRequest::set_token(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000004u;
-  org_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+  
+  token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
               GetArena());
-  // @@protoc_insertion_point(field_set_char:appguard.AppGuardIpInfo.org)
+  // @@protoc_insertion_point(field_set_char:appguard.AppGuardHttpRequest.token)
 }
-inline void AppGuardIpInfo::set_org(const char* value,
+inline void AppGuardHttpRequest::set_token(const char* value,
     size_t size) {
-  _has_bits_[0] |= 0x00000004u;
-  org_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+  
+  token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
       reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardIpInfo.org)
+  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardHttpRequest.token)
 }
-inline std::string* AppGuardIpInfo::_internal_mutable_org() {
-  _has_bits_[0] |= 0x00000004u;
-  return org_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* AppGuardHttpRequest::_internal_mutable_token() {
+  
+  return token_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline std::string* AppGuardIpInfo::release_org() {
-  // @@protoc_insertion_point(field_release:appguard.AppGuardIpInfo.org)
-  if (!_internal_has_org()) {
-    return nullptr;
-  }
-  _has_bits_[0] &= ~0x00000004u;
-  return org_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* AppGuardHttpRequest::release_token() {
+  // @@protoc_insertion_point(field_release:appguard.AppGuardHttpRequest.token)
+  return token_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void AppGuardIpInfo::set_allocated_org(std::string* org) {
-  if (org != nullptr) {
-    _has_bits_[0] |= 0x00000004u;
+inline void AppGuardHttpRequest::set_allocated_token(std::string* token) {
+  if (token != nullptr) {
+    
   } else {
-    _has_bits_[0] &= ~0x00000004u;
+    
   }
-  org_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), org,
+  token_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), token,
       GetArena());
-  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardIpInfo.org)
+  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardHttpRequest.token)
 }
-inline std::string* AppGuardIpInfo::unsafe_arena_release_org() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardIpInfo.org)
+inline std::string* AppGuardHttpRequest::unsafe_arena_release_token() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardHttpRequest.token)
   GOOGLE_DCHECK(GetArena() != nullptr);
-  _has_bits_[0] &= ~0x00000004u;
-  return org_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+  
+  return token_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       GetArena());
 }
-inline void AppGuardIpInfo::unsafe_arena_set_allocated_org(
-    std::string* org) {
+inline void AppGuardHttpRequest::unsafe_arena_set_allocated_token(
+    std::string* token) {
   GOOGLE_DCHECK(GetArena() != nullptr);
-  if (org != nullptr) {
-    _has_bits_[0] |= 0x00000004u;
+  if (token != nullptr) {
+    
   } else {
-    _has_bits_[0] &= ~0x00000004u;
+    
   }
-  org_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      org, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardIpInfo.org)
+  token_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      token, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardHttpRequest.token)
 }
 
-// string continent_code = 5;
-inline bool AppGuardIpInfo::_internal_has_continent_code() const {
-  bool value = (_has_bits_[0] & 0x00000008u) != 0;
-  return value;
-}
-inline bool AppGuardIpInfo::has_continent_code() const {
-  return _internal_has_continent_code();
-}
-inline void AppGuardIpInfo::clear_continent_code() {
-  continent_code_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  _has_bits_[0] &= ~0x00000008u;
+// string original_url = 2;
+inline void AppGuardHttpRequest::clear_original_url() {
+  original_url_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline const std::string& AppGuardIpInfo::continent_code() const {
-  // @@protoc_insertion_point(field_get:appguard.AppGuardIpInfo.continent_code)
-  return _internal_continent_code();
+inline const std::string& AppGuardHttpRequest::original_url() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardHttpRequest.original_url)
+  return _internal_original_url();
 }
-inline void AppGuardIpInfo::set_continent_code(const std::string& value) {
-  _internal_set_continent_code(value);
-  // @@protoc_insertion_point(field_set:appguard.AppGuardIpInfo.continent_code)
+inline void AppGuardHttpRequest::set_original_url(const std::string& value) {
+  _internal_set_original_url(value);
+  // @@protoc_insertion_point(field_set:appguard.AppGuardHttpRequest.original_url)
 }
-inline std::string* AppGuardIpInfo::mutable_continent_code() {
-  // @@protoc_insertion_point(field_mutable:appguard.AppGuardIpInfo.continent_code)
-  return _internal_mutable_continent_code();
+inline std::string* AppGuardHttpRequest::mutable_original_url() {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardHttpRequest.original_url)
+  return _internal_mutable_original_url();
 }
-inline const std::string& AppGuardIpInfo::_internal_continent_code() const {
-  return continent_code_.Get();
+inline const std::string& AppGuardHttpRequest::_internal_original_url() const {
+  return original_url_.Get();
 }
-inline void AppGuardIpInfo::_internal_set_continent_code(const std::string& value) {
-  _has_bits_[0] |= 0x00000008u;
-  continent_code_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline void AppGuardHttpRequest::_internal_set_original_url(const std::string& value) {
+  
+  original_url_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
 }
-inline void AppGuardIpInfo::set_continent_code(std::string&& value) {
-  _has_bits_[0] |= 0x00000008u;
-  continent_code_.Set(
+inline void AppGuardHttpRequest::set_original_url(std::string&& value) {
+  
+  original_url_.Set(
     &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardIpInfo.continent_code)
+  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardHttpRequest.original_url)
 }
-inline void AppGuardIpInfo::set_continent_code(const char* value) {
+inline void AppGuardHttpRequest::set_original_url(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000008u;
-  continent_code_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+  
+  original_url_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
               GetArena());
-  // @@protoc_insertion_point(field_set_char:appguard.AppGuardIpInfo.continent_code)
+  // @@protoc_insertion_point(field_set_char:appguard.AppGuardHttpRequest.original_url)
 }
-inline void AppGuardIpInfo::set_continent_code(const char* value,
+inline void AppGuardHttpRequest::set_original_url(const char* value,
     size_t size) {
-  _has_bits_[0] |= 0x00000008u;
-  continent_code_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+  
+  original_url_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
       reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardIpInfo.continent_code)
+  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardHttpRequest.original_url)
 }
-inline std::string* AppGuardIpInfo::_internal_mutable_continent_code() {
-  _has_bits_[0] |= 0x00000008u;
-  return continent_code_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* AppGuardHttpRequest::_internal_mutable_original_url() {
+  
+  return original_url_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline std::string* AppGuardIpInfo::release_continent_code() {
-  // @@protoc_insertion_point(field_release:appguard.AppGuardIpInfo.continent_code)
-  if (!_internal_has_continent_code()) {
-    return nullptr;
-  }
-  _has_bits_[0] &= ~0x00000008u;
-  return continent_code_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* AppGuardHttpRequest::release_original_url() {
+  // @@protoc_insertion_point(field_release:appguard.AppGuardHttpRequest.original_url)
+  return original_url_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void AppGuardIpInfo::set_allocated_continent_code(std::string* continent_code) {
-  if (continent_code != nullptr) {
-    _has_bits_[0] |= 0x00000008u;
+inline void AppGuardHttpRequest::set_allocated_original_url(std::string* original_url) {
+  if (original_url != nullptr) {
+    
   } else {
-    _has_bits_[0] &= ~0x00000008u;
+    
   }
-  continent_code_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), continent_code,
+  original_url_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), original_url,
       GetArena());
-  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardIpInfo.continent_code)
+  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardHttpRequest.original_url)
 }
-inline std::string* AppGuardIpInfo::unsafe_arena_release_continent_code() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardIpInfo.continent_code)
+inline std::string* AppGuardHttpRequest::unsafe_arena_release_original_url() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardHttpRequest.original_url)
   GOOGLE_DCHECK(GetArena() != nullptr);
-  _has_bits_[0] &= ~0x00000008u;
-  return continent_code_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+  
+  return original_url_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       GetArena());
 }
-inline void AppGuardIpInfo::unsafe_arena_set_allocated_continent_code(
-    std::string* continent_code) {
+inline void AppGuardHttpRequest::unsafe_arena_set_allocated_original_url(
+    std::string* original_url) {
   GOOGLE_DCHECK(GetArena() != nullptr);
-  if (continent_code != nullptr) {
-    _has_bits_[0] |= 0x00000008u;
+  if (original_url != nullptr) {
+    
   } else {
-    _has_bits_[0] &= ~0x00000008u;
+    
   }
-  continent_code_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      continent_code, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardIpInfo.continent_code)
+  original_url_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      original_url, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardHttpRequest.original_url)
 }
 
-// string city = 6;
-inline bool AppGuardIpInfo::_internal_has_city() const {
-  bool value = (_has_bits_[0] & 0x00000010u) != 0;
-  return value;
+// map<string, string> headers = 3;
+inline int AppGuardHttpRequest::_internal_headers_size() const {
+  return headers_.size();
 }
-inline bool AppGuardIpInfo::has_city() const {
-  return _internal_has_city();
+inline int AppGuardHttpRequest::headers_size() const {
+  return _internal_headers_size();
 }
-inline void AppGuardIpInfo::clear_city() {
-  city_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  _has_bits_[0] &= ~0x00000010u;
+inline void AppGuardHttpRequest::clear_headers() {
+  headers_.Clear();
 }
-inline const std::string& AppGuardIpInfo::city() const {
-  // @@protoc_insertion_point(field_get:appguard.AppGuardIpInfo.city)
-  return _internal_city();
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+AppGuardHttpRequest::_internal_headers() const {
+  return headers_.GetMap();
 }
-inline void AppGuardIpInfo::set_city(const std::string& value) {
-  _internal_set_city(value);
-  // @@protoc_insertion_point(field_set:appguard.AppGuardIpInfo.city)
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+AppGuardHttpRequest::headers() const {
+  // @@protoc_insertion_point(field_map:appguard.AppGuardHttpRequest.headers)
+  return _internal_headers();
 }
-inline std::string* AppGuardIpInfo::mutable_city() {
-  // @@protoc_insertion_point(field_mutable:appguard.AppGuardIpInfo.city)
-  return _internal_mutable_city();
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+AppGuardHttpRequest::_internal_mutable_headers() {
+  return headers_.MutableMap();
 }
-inline const std::string& AppGuardIpInfo::_internal_city() const {
-  return city_.Get();
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+AppGuardHttpRequest::mutable_headers() {
+  // @@protoc_insertion_point(field_mutable_map:appguard.AppGuardHttpRequest.headers)
+  return _internal_mutable_headers();
 }
-inline void AppGuardIpInfo::_internal_set_city(const std::string& value) {
-  _has_bits_[0] |= 0x00000010u;
-  city_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+
+// string method = 4;
+inline void AppGuardHttpRequest::clear_method() {
+  method_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void AppGuardIpInfo::set_city(std::string&& value) {
-  _has_bits_[0] |= 0x00000010u;
-  city_.Set(
+inline const std::string& AppGuardHttpRequest::method() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardHttpRequest.method)
+  return _internal_method();
+}
+inline void AppGuardHttpRequest::set_method(const std::string& value) {
+  _internal_set_method(value);
+  // @@protoc_insertion_point(field_set:appguard.AppGuardHttpRequest.method)
+}
+inline std::string* AppGuardHttpRequest::mutable_method() {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardHttpRequest.method)
+  return _internal_mutable_method();
+}
+inline const std::string& AppGuardHttpRequest::_internal_method() const {
+  return method_.Get();
+}
+inline void AppGuardHttpRequest::_internal_set_method(const std::string& value) {
+  
+  method_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void AppGuardHttpRequest::set_method(std::string&& value) {
+  
+  method_.Set(
     &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardIpInfo.city)
+  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardHttpRequest.method)
 }
-inline void AppGuardIpInfo::set_city(const char* value) {
+inline void AppGuardHttpRequest::set_method(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000010u;
-  city_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+  
+  method_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
               GetArena());
-  // @@protoc_insertion_point(field_set_char:appguard.AppGuardIpInfo.city)
+  // @@protoc_insertion_point(field_set_char:appguard.AppGuardHttpRequest.method)
 }
-inline void AppGuardIpInfo::set_city(const char* value,
+inline void AppGuardHttpRequest::set_method(const char* value,
     size_t size) {
-  _has_bits_[0] |= 0x00000010u;
-  city_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+  
+  method_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
       reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardIpInfo.city)
+  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardHttpRequest.method)
 }
-inline std::string* AppGuardIpInfo::_internal_mutable_city() {
-  _has_bits_[0] |= 0x00000010u;
-  return city_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* AppGuardHttpRequest::_internal_mutable_method() {
+  
+  return method_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline std::string* AppGuardIpInfo::release_city() {
-  // @@protoc_insertion_point(field_release:appguard.AppGuardIpInfo.city)
-  if (!_internal_has_city()) {
-    return nullptr;
-  }
-  _has_bits_[0] &= ~0x00000010u;
-  return city_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* AppGuardHttpRequest::release_method() {
+  // @@protoc_insertion_point(field_release:appguard.AppGuardHttpRequest.method)
+  return method_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void AppGuardIpInfo::set_allocated_city(std::string* city) {
-  if (city != nullptr) {
-    _has_bits_[0] |= 0x00000010u;
+inline void AppGuardHttpRequest::set_allocated_method(std::string* method) {
+  if (method != nullptr) {
+    
   } else {
-    _has_bits_[0] &= ~0x00000010u;
+    
   }
-  city_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), city,
+  method_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), method,
       GetArena());
-  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardIpInfo.city)
+  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardHttpRequest.method)
 }
-inline std::string* AppGuardIpInfo::unsafe_arena_release_city() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardIpInfo.city)
+inline std::string* AppGuardHttpRequest::unsafe_arena_release_method() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardHttpRequest.method)
   GOOGLE_DCHECK(GetArena() != nullptr);
-  _has_bits_[0] &= ~0x00000010u;
-  return city_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+  
+  return method_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       GetArena());
 }
-inline void AppGuardIpInfo::unsafe_arena_set_allocated_city(
-    std::string* city) {
+inline void AppGuardHttpRequest::unsafe_arena_set_allocated_method(
+    std::string* method) {
   GOOGLE_DCHECK(GetArena() != nullptr);
-  if (city != nullptr) {
-    _has_bits_[0] |= 0x00000010u;
+  if (method != nullptr) {
+    
   } else {
-    _has_bits_[0] &= ~0x00000010u;
+    
   }
-  city_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      city, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardIpInfo.city)
+  method_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      method, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardHttpRequest.method)
 }
 
-// string region = 7;
-inline bool AppGuardIpInfo::_internal_has_region() const {
-  bool value = (_has_bits_[0] & 0x00000020u) != 0;
+// string body = 5;
+inline bool AppGuardHttpRequest::_internal_has_body() const {
+  bool value = (_has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool AppGuardIpInfo::has_region() const {
-  return _internal_has_region();
+inline bool AppGuardHttpRequest::has_body() const {
+  return _internal_has_body();
 }
-inline void AppGuardIpInfo::clear_region() {
-  region_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  _has_bits_[0] &= ~0x00000020u;
+inline void AppGuardHttpRequest::clear_body() {
+  body_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& AppGuardIpInfo::region() const {
-  // @@protoc_insertion_point(field_get:appguard.AppGuardIpInfo.region)
-  return _internal_region();
+inline const std::string& AppGuardHttpRequest::body() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardHttpRequest.body)
+  return _internal_body();
 }
-inline void AppGuardIpInfo::set_region(const std::string& value) {
-  _internal_set_region(value);
-  // @@protoc_insertion_point(field_set:appguard.AppGuardIpInfo.region)
+inline void AppGuardHttpRequest::set_body(const std::string& value) {
+  _internal_set_body(value);
+  // @@protoc_insertion_point(field_set:appguard.AppGuardHttpRequest.body)
 }
-inline std::string* AppGuardIpInfo::mutable_region() {
-  // @@protoc_insertion_point(field_mutable:appguard.AppGuardIpInfo.region)
-  return _internal_mutable_region();
+inline std::string* AppGuardHttpRequest::mutable_body() {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardHttpRequest.body)
+  return _internal_mutable_body();
 }
-inline const std::string& AppGuardIpInfo::_internal_region() const {
-  return region_.Get();
+inline const std::string& AppGuardHttpRequest::_internal_body() const {
+  return body_.Get();
 }
-inline void AppGuardIpInfo::_internal_set_region(const std::string& value) {
-  _has_bits_[0] |= 0x00000020u;
-  region_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline void AppGuardHttpRequest::_internal_set_body(const std::string& value) {
+  _has_bits_[0] |= 0x00000001u;
+  body_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
 }
-inline void AppGuardIpInfo::set_region(std::string&& value) {
-  _has_bits_[0] |= 0x00000020u;
-  region_.Set(
+inline void AppGuardHttpRequest::set_body(std::string&& value) {
+  _has_bits_[0] |= 0x00000001u;
+  body_.Set(
     &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardIpInfo.region)
+  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardHttpRequest.body)
 }
-inline void AppGuardIpInfo::set_region(const char* value) {
+inline void AppGuardHttpRequest::set_body(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000020u;
-  region_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+  _has_bits_[0] |= 0x00000001u;
+  body_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
               GetArena());
-  // @@protoc_insertion_point(field_set_char:appguard.AppGuardIpInfo.region)
+  // @@protoc_insertion_point(field_set_char:appguard.AppGuardHttpRequest.body)
 }
-inline void AppGuardIpInfo::set_region(const char* value,
+inline void AppGuardHttpRequest::set_body(const char* value,
     size_t size) {
-  _has_bits_[0] |= 0x00000020u;
-  region_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+  _has_bits_[0] |= 0x00000001u;
+  body_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
       reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardIpInfo.region)
+  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardHttpRequest.body)
 }
-inline std::string* AppGuardIpInfo::_internal_mutable_region() {
-  _has_bits_[0] |= 0x00000020u;
-  return region_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* AppGuardHttpRequest::_internal_mutable_body() {
+  _has_bits_[0] |= 0x00000001u;
+  return body_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline std::string* AppGuardIpInfo::release_region() {
-  // @@protoc_insertion_point(field_release:appguard.AppGuardIpInfo.region)
-  if (!_internal_has_region()) {
+inline std::string* AppGuardHttpRequest::release_body() {
+  // @@protoc_insertion_point(field_release:appguard.AppGuardHttpRequest.body)
+  if (!_internal_has_body()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000020u;
-  return region_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _has_bits_[0] &= ~0x00000001u;
+  return body_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void AppGuardIpInfo::set_allocated_region(std::string* region) {
-  if (region != nullptr) {
-    _has_bits_[0] |= 0x00000020u;
+inline void AppGuardHttpRequest::set_allocated_body(std::string* body) {
+  if (body != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000020u;
+    _has_bits_[0] &= ~0x00000001u;
   }
-  region_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), region,
+  body_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), body,
       GetArena());
-  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardIpInfo.region)
+  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardHttpRequest.body)
 }
-inline std::string* AppGuardIpInfo::unsafe_arena_release_region() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardIpInfo.region)
+inline std::string* AppGuardHttpRequest::unsafe_arena_release_body() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardHttpRequest.body)
   GOOGLE_DCHECK(GetArena() != nullptr);
-  _has_bits_[0] &= ~0x00000020u;
-  return region_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+  _has_bits_[0] &= ~0x00000001u;
+  return body_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       GetArena());
 }
-inline void AppGuardIpInfo::unsafe_arena_set_allocated_region(
-    std::string* region) {
+inline void AppGuardHttpRequest::unsafe_arena_set_allocated_body(
+    std::string* body) {
   GOOGLE_DCHECK(GetArena() != nullptr);
-  if (region != nullptr) {
-    _has_bits_[0] |= 0x00000020u;
+  if (body != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000020u;
+    _has_bits_[0] &= ~0x00000001u;
   }
-  region_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      region, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardIpInfo.region)
+  body_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      body, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardHttpRequest.body)
 }
 
-// string postal = 8;
-inline bool AppGuardIpInfo::_internal_has_postal() const {
-  bool value = (_has_bits_[0] & 0x00000040u) != 0;
-  return value;
+// map<string, string> query = 6;
+inline int AppGuardHttpRequest::_internal_query_size() const {
+  return query_.size();
 }
-inline bool AppGuardIpInfo::has_postal() const {
-  return _internal_has_postal();
+inline int AppGuardHttpRequest::query_size() const {
+  return _internal_query_size();
 }
-inline void AppGuardIpInfo::clear_postal() {
-  postal_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  _has_bits_[0] &= ~0x00000040u;
+inline void AppGuardHttpRequest::clear_query() {
+  query_.Clear();
 }
-inline const std::string& AppGuardIpInfo::postal() const {
-  // @@protoc_insertion_point(field_get:appguard.AppGuardIpInfo.postal)
-  return _internal_postal();
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+AppGuardHttpRequest::_internal_query() const {
+  return query_.GetMap();
 }
-inline void AppGuardIpInfo::set_postal(const std::string& value) {
-  _internal_set_postal(value);
-  // @@protoc_insertion_point(field_set:appguard.AppGuardIpInfo.postal)
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+AppGuardHttpRequest::query() const {
+  // @@protoc_insertion_point(field_map:appguard.AppGuardHttpRequest.query)
+  return _internal_query();
 }
-inline std::string* AppGuardIpInfo::mutable_postal() {
-  // @@protoc_insertion_point(field_mutable:appguard.AppGuardIpInfo.postal)
-  return _internal_mutable_postal();
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+AppGuardHttpRequest::_internal_mutable_query() {
+  return query_.MutableMap();
 }
-inline const std::string& AppGuardIpInfo::_internal_postal() const {
-  return postal_.Get();
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+AppGuardHttpRequest::mutable_query() {
+  // @@protoc_insertion_point(field_mutable_map:appguard.AppGuardHttpRequest.query)
+  return _internal_mutable_query();
 }
-inline void AppGuardIpInfo::_internal_set_postal(const std::string& value) {
-  _has_bits_[0] |= 0x00000040u;
-  postal_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+
+// .appguard.AppGuardTcpInfo tcp_info = 100;
+inline bool AppGuardHttpRequest::_internal_has_tcp_info() const {
+  return this != internal_default_instance() && tcp_info_ != nullptr;
 }
-inline void AppGuardIpInfo::set_postal(std::string&& value) {
-  _has_bits_[0] |= 0x00000040u;
-  postal_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardIpInfo.postal)
+inline bool AppGuardHttpRequest::has_tcp_info() const {
+  return _internal_has_tcp_info();
 }
-inline void AppGuardIpInfo::set_postal(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000040u;
-  postal_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:appguard.AppGuardIpInfo.postal)
+inline void AppGuardHttpRequest::clear_tcp_info() {
+  if (GetArena() == nullptr && tcp_info_ != nullptr) {
+    delete tcp_info_;
+  }
+  tcp_info_ = nullptr;
 }
-inline void AppGuardIpInfo::set_postal(const char* value,
-    size_t size) {
-  _has_bits_[0] |= 0x00000040u;
-  postal_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardIpInfo.postal)
+inline const ::appguard::AppGuardTcpInfo& AppGuardHttpRequest::_internal_tcp_info() const {
+  const ::appguard::AppGuardTcpInfo* p = tcp_info_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::appguard::AppGuardTcpInfo*>(
+      &::appguard::_AppGuardTcpInfo_default_instance_);
 }
-inline std::string* AppGuardIpInfo::_internal_mutable_postal() {
-  _has_bits_[0] |= 0x00000040u;
-  return postal_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline const ::appguard::AppGuardTcpInfo& AppGuardHttpRequest::tcp_info() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardHttpRequest.tcp_info)
+  return _internal_tcp_info();
 }
-inline std::string* AppGuardIpInfo::release_postal() {
-  // @@protoc_insertion_point(field_release:appguard.AppGuardIpInfo.postal)
-  if (!_internal_has_postal()) {
-    return nullptr;
+inline void AppGuardHttpRequest::unsafe_arena_set_allocated_tcp_info(
+    ::appguard::AppGuardTcpInfo* tcp_info) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(tcp_info_);
   }
-  _has_bits_[0] &= ~0x00000040u;
-  return postal_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline void AppGuardIpInfo::set_allocated_postal(std::string* postal) {
-  if (postal != nullptr) {
-    _has_bits_[0] |= 0x00000040u;
+  tcp_info_ = tcp_info;
+  if (tcp_info) {
+    
   } else {
-    _has_bits_[0] &= ~0x00000040u;
+    
   }
-  postal_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), postal,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardIpInfo.postal)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardHttpRequest.tcp_info)
 }
-inline std::string* AppGuardIpInfo::unsafe_arena_release_postal() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardIpInfo.postal)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  _has_bits_[0] &= ~0x00000040u;
-  return postal_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+inline ::appguard::AppGuardTcpInfo* AppGuardHttpRequest::release_tcp_info() {
+  auto temp = unsafe_arena_release_tcp_info();
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
 }
-inline void AppGuardIpInfo::unsafe_arena_set_allocated_postal(
-    std::string* postal) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (postal != nullptr) {
-    _has_bits_[0] |= 0x00000040u;
-  } else {
-    _has_bits_[0] &= ~0x00000040u;
+inline ::appguard::AppGuardTcpInfo* AppGuardHttpRequest::unsafe_arena_release_tcp_info() {
+  // @@protoc_insertion_point(field_release:appguard.AppGuardHttpRequest.tcp_info)
+  
+  ::appguard::AppGuardTcpInfo* temp = tcp_info_;
+  tcp_info_ = nullptr;
+  return temp;
+}
+inline ::appguard::AppGuardTcpInfo* AppGuardHttpRequest::_internal_mutable_tcp_info() {
+  
+  if (tcp_info_ == nullptr) {
+    auto* p = CreateMaybeMessage<::appguard::AppGuardTcpInfo>(GetArena());
+    tcp_info_ = p;
   }
-  postal_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      postal, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardIpInfo.postal)
+  return tcp_info_;
 }
-
-// string timezone = 9;
-inline bool AppGuardIpInfo::_internal_has_timezone() const {
-  bool value = (_has_bits_[0] & 0x00000080u) != 0;
-  return value;
+inline ::appguard::AppGuardTcpInfo* AppGuardHttpRequest::mutable_tcp_info() {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardHttpRequest.tcp_info)
+  return _internal_mutable_tcp_info();
 }
-inline bool AppGuardIpInfo::has_timezone() const {
-  return _internal_has_timezone();
+inline void AppGuardHttpRequest::set_allocated_tcp_info(::appguard::AppGuardTcpInfo* tcp_info) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete tcp_info_;
+  }
+  if (tcp_info) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(tcp_info);
+    if (message_arena != submessage_arena) {
+      tcp_info = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, tcp_info, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  tcp_info_ = tcp_info;
+  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardHttpRequest.tcp_info)
 }
-inline void AppGuardIpInfo::clear_timezone() {
-  timezone_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  _has_bits_[0] &= ~0x00000080u;
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// AppGuardHttpResponse
+
+// string token = 1;
+inline void AppGuardHttpResponse::clear_token() {
+  token_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline const std::string& AppGuardIpInfo::timezone() const {
-  // @@protoc_insertion_point(field_get:appguard.AppGuardIpInfo.timezone)
-  return _internal_timezone();
+inline const std::string& AppGuardHttpResponse::token() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardHttpResponse.token)
+  return _internal_token();
 }
-inline void AppGuardIpInfo::set_timezone(const std::string& value) {
-  _internal_set_timezone(value);
-  // @@protoc_insertion_point(field_set:appguard.AppGuardIpInfo.timezone)
+inline void AppGuardHttpResponse::set_token(const std::string& value) {
+  _internal_set_token(value);
+  // @@protoc_insertion_point(field_set:appguard.AppGuardHttpResponse.token)
 }
-inline std::string* AppGuardIpInfo::mutable_timezone() {
-  // @@protoc_insertion_point(field_mutable:appguard.AppGuardIpInfo.timezone)
-  return _internal_mutable_timezone();
+inline std::string* AppGuardHttpResponse::mutable_token() {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardHttpResponse.token)
+  return _internal_mutable_token();
 }
-inline const std::string& AppGuardIpInfo::_internal_timezone() const {
-  return timezone_.Get();
+inline const std::string& AppGuardHttpResponse::_internal_token() const {
+  return token_.Get();
 }
-inline void AppGuardIpInfo::_internal_set_timezone(const std::string& value) {
-  _has_bits_[0] |= 0x00000080u;
-  timezone_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline void AppGuardHttpResponse::_internal_set_token(const std::string& value) {
+  
+  token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
 }
-inline void AppGuardIpInfo::set_timezone(std::string&& value) {
-  _has_bits_[0] |= 0x00000080u;
-  timezone_.Set(
+inline void AppGuardHttpResponse::set_token(std::string&& value) {
+  
+  token_.Set(
     &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardIpInfo.timezone)
+  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardHttpResponse.token)
 }
-inline void AppGuardIpInfo::set_timezone(const char* value) {
+inline void AppGuardHttpResponse::set_token(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000080u;
-  timezone_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+  
+  token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
               GetArena());
-  // @@protoc_insertion_point(field_set_char:appguard.AppGuardIpInfo.timezone)
+  // @@protoc_insertion_point(field_set_char:appguard.AppGuardHttpResponse.token)
 }
-inline void AppGuardIpInfo::set_timezone(const char* value,
+inline void AppGuardHttpResponse::set_token(const char* value,
     size_t size) {
-  _has_bits_[0] |= 0x00000080u;
-  timezone_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+  
+  token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
       reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardIpInfo.timezone)
+  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardHttpResponse.token)
 }
-inline std::string* AppGuardIpInfo::_internal_mutable_timezone() {
-  _has_bits_[0] |= 0x00000080u;
-  return timezone_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* AppGuardHttpResponse::_internal_mutable_token() {
+  
+  return token_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline std::string* AppGuardIpInfo::release_timezone() {
-  // @@protoc_insertion_point(field_release:appguard.AppGuardIpInfo.timezone)
-  if (!_internal_has_timezone()) {
-    return nullptr;
-  }
-  _has_bits_[0] &= ~0x00000080u;
-  return timezone_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* AppGuardHttpResponse::release_token() {
+  // @@protoc_insertion_point(field_release:appguard.AppGuardHttpResponse.token)
+  return token_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void AppGuardIpInfo::set_allocated_timezone(std::string* timezone) {
-  if (timezone != nullptr) {
-    _has_bits_[0] |= 0x00000080u;
+inline void AppGuardHttpResponse::set_allocated_token(std::string* token) {
+  if (token != nullptr) {
+    
   } else {
-    _has_bits_[0] &= ~0x00000080u;
+    
   }
-  timezone_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), timezone,
+  token_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), token,
       GetArena());
-  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardIpInfo.timezone)
+  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardHttpResponse.token)
 }
-inline std::string* AppGuardIpInfo::unsafe_arena_release_timezone() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardIpInfo.timezone)
+inline std::string* AppGuardHttpResponse::unsafe_arena_release_token() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardHttpResponse.token)
   GOOGLE_DCHECK(GetArena() != nullptr);
-  _has_bits_[0] &= ~0x00000080u;
-  return timezone_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+  
+  return token_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       GetArena());
 }
-inline void AppGuardIpInfo::unsafe_arena_set_allocated_timezone(
-    std::string* timezone) {
+inline void AppGuardHttpResponse::unsafe_arena_set_allocated_token(
+    std::string* token) {
   GOOGLE_DCHECK(GetArena() != nullptr);
-  if (timezone != nullptr) {
-    _has_bits_[0] |= 0x00000080u;
+  if (token != nullptr) {
+    
   } else {
-    _has_bits_[0] &= ~0x00000080u;
+    
   }
-  timezone_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      timezone, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardIpInfo.timezone)
+  token_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      token, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardHttpResponse.token)
 }
 
-// -------------------------------------------------------------------
-
-// AppGuardTcpInfo
-
-// .appguard.AppGuardTcpConnection connection = 1;
-inline bool AppGuardTcpInfo::_internal_has_connection() const {
-  return this != internal_default_instance() && connection_ != nullptr;
+// uint32 code = 2;
+inline void AppGuardHttpResponse::clear_code() {
+  code_ = 0u;
 }
-inline bool AppGuardTcpInfo::has_connection() const {
-  return _internal_has_connection();
+inline ::PROTOBUF_NAMESPACE_ID::uint32 AppGuardHttpResponse::_internal_code() const {
+  return code_;
 }
-inline void AppGuardTcpInfo::clear_connection() {
-  if (GetArena() == nullptr && connection_ != nullptr) {
-    delete connection_;
-  }
-  connection_ = nullptr;
+inline ::PROTOBUF_NAMESPACE_ID::uint32 AppGuardHttpResponse::code() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardHttpResponse.code)
+  return _internal_code();
 }
-inline const ::appguard::AppGuardTcpConnection& AppGuardTcpInfo::_internal_connection() const {
-  const ::appguard::AppGuardTcpConnection* p = connection_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::appguard::AppGuardTcpConnection*>(
-      &::appguard::_AppGuardTcpConnection_default_instance_);
+inline void AppGuardHttpResponse::_internal_set_code(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  code_ = value;
 }
-inline const ::appguard::AppGuardTcpConnection& AppGuardTcpInfo::connection() const {
-  // @@protoc_insertion_point(field_get:appguard.AppGuardTcpInfo.connection)
-  return _internal_connection();
+inline void AppGuardHttpResponse::set_code(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_code(value);
+  // @@protoc_insertion_point(field_set:appguard.AppGuardHttpResponse.code)
 }
-inline void AppGuardTcpInfo::unsafe_arena_set_allocated_connection(
-    ::appguard::AppGuardTcpConnection* connection) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(connection_);
-  }
-  connection_ = connection;
-  if (connection) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardTcpInfo.connection)
+
+// map<string, string> headers = 3;
+inline int AppGuardHttpResponse::_internal_headers_size() const {
+  return headers_.size();
 }
-inline ::appguard::AppGuardTcpConnection* AppGuardTcpInfo::release_connection() {
-  auto temp = unsafe_arena_release_connection();
-  if (GetArena() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-  return temp;
+inline int AppGuardHttpResponse::headers_size() const {
+  return _internal_headers_size();
 }
-inline ::appguard::AppGuardTcpConnection* AppGuardTcpInfo::unsafe_arena_release_connection() {
-  // @@protoc_insertion_point(field_release:appguard.AppGuardTcpInfo.connection)
-  
-  ::appguard::AppGuardTcpConnection* temp = connection_;
-  connection_ = nullptr;
-  return temp;
+inline void AppGuardHttpResponse::clear_headers() {
+  headers_.Clear();
 }
-inline ::appguard::AppGuardTcpConnection* AppGuardTcpInfo::_internal_mutable_connection() {
-  
-  if (connection_ == nullptr) {
-    auto* p = CreateMaybeMessage<::appguard::AppGuardTcpConnection>(GetArena());
-    connection_ = p;
-  }
-  return connection_;
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+AppGuardHttpResponse::_internal_headers() const {
+  return headers_.GetMap();
 }
-inline ::appguard::AppGuardTcpConnection* AppGuardTcpInfo::mutable_connection() {
-  // @@protoc_insertion_point(field_mutable:appguard.AppGuardTcpInfo.connection)
-  return _internal_mutable_connection();
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+AppGuardHttpResponse::headers() const {
+  // @@protoc_insertion_point(field_map:appguard.AppGuardHttpResponse.headers)
+  return _internal_headers();
 }
-inline void AppGuardTcpInfo::set_allocated_connection(::appguard::AppGuardTcpConnection* connection) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
-  if (message_arena == nullptr) {
-    delete connection_;
-  }
-  if (connection) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(connection);
-    if (message_arena != submessage_arena) {
-      connection = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, connection, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  connection_ = connection;
-  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardTcpInfo.connection)
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+AppGuardHttpResponse::_internal_mutable_headers() {
+  return headers_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+AppGuardHttpResponse::mutable_headers() {
+  // @@protoc_insertion_point(field_mutable_map:appguard.AppGuardHttpResponse.headers)
+  return _internal_mutable_headers();
 }
 
-// .appguard.AppGuardIpInfo ip_info = 2;
-inline bool AppGuardTcpInfo::_internal_has_ip_info() const {
-  return this != internal_default_instance() && ip_info_ != nullptr;
+// .appguard.AppGuardTcpInfo tcp_info = 100;
+inline bool AppGuardHttpResponse::_internal_has_tcp_info() const {
+  return this != internal_default_instance() && tcp_info_ != nullptr;
 }
-inline bool AppGuardTcpInfo::has_ip_info() const {
-  return _internal_has_ip_info();
+inline bool AppGuardHttpResponse::has_tcp_info() const {
+  return _internal_has_tcp_info();
 }
-inline void AppGuardTcpInfo::clear_ip_info() {
-  if (GetArena() == nullptr && ip_info_ != nullptr) {
-    delete ip_info_;
+inline void AppGuardHttpResponse::clear_tcp_info() {
+  if (GetArena() == nullptr && tcp_info_ != nullptr) {
+    delete tcp_info_;
   }
-  ip_info_ = nullptr;
+  tcp_info_ = nullptr;
 }
-inline const ::appguard::AppGuardIpInfo& AppGuardTcpInfo::_internal_ip_info() const {
-  const ::appguard::AppGuardIpInfo* p = ip_info_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::appguard::AppGuardIpInfo*>(
-      &::appguard::_AppGuardIpInfo_default_instance_);
+inline const ::appguard::AppGuardTcpInfo& AppGuardHttpResponse::_internal_tcp_info() const {
+  const ::appguard::AppGuardTcpInfo* p = tcp_info_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::appguard::AppGuardTcpInfo*>(
+      &::appguard::_AppGuardTcpInfo_default_instance_);
 }
-inline const ::appguard::AppGuardIpInfo& AppGuardTcpInfo::ip_info() const {
-  // @@protoc_insertion_point(field_get:appguard.AppGuardTcpInfo.ip_info)
-  return _internal_ip_info();
+inline const ::appguard::AppGuardTcpInfo& AppGuardHttpResponse::tcp_info() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardHttpResponse.tcp_info)
+  return _internal_tcp_info();
 }
-inline void AppGuardTcpInfo::unsafe_arena_set_allocated_ip_info(
-    ::appguard::AppGuardIpInfo* ip_info) {
+inline void AppGuardHttpResponse::unsafe_arena_set_allocated_tcp_info(
+    ::appguard::AppGuardTcpInfo* tcp_info) {
   if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(ip_info_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(tcp_info_);
   }
-  ip_info_ = ip_info;
-  if (ip_info) {
+  tcp_info_ = tcp_info;
+  if (tcp_info) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardTcpInfo.ip_info)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardHttpResponse.tcp_info)
 }
-inline ::appguard::AppGuardIpInfo* AppGuardTcpInfo::release_ip_info() {
-  auto temp = unsafe_arena_release_ip_info();
+inline ::appguard::AppGuardTcpInfo* AppGuardHttpResponse::release_tcp_info() {
+  auto temp = unsafe_arena_release_tcp_info();
   if (GetArena() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
   return temp;
 }
-inline ::appguard::AppGuardIpInfo* AppGuardTcpInfo::unsafe_arena_release_ip_info() {
-  // @@protoc_insertion_point(field_release:appguard.AppGuardTcpInfo.ip_info)
+inline ::appguard::AppGuardTcpInfo* AppGuardHttpResponse::unsafe_arena_release_tcp_info() {
+  // @@protoc_insertion_point(field_release:appguard.AppGuardHttpResponse.tcp_info)
   
-  ::appguard::AppGuardIpInfo* temp = ip_info_;
-  ip_info_ = nullptr;
+  ::appguard::AppGuardTcpInfo* temp = tcp_info_;
+  tcp_info_ = nullptr;
   return temp;
 }
-inline ::appguard::AppGuardIpInfo* AppGuardTcpInfo::_internal_mutable_ip_info() {
+inline ::appguard::AppGuardTcpInfo* AppGuardHttpResponse::_internal_mutable_tcp_info() {
   
-  if (ip_info_ == nullptr) {
-    auto* p = CreateMaybeMessage<::appguard::AppGuardIpInfo>(GetArena());
-    ip_info_ = p;
+  if (tcp_info_ == nullptr) {
+    auto* p = CreateMaybeMessage<::appguard::AppGuardTcpInfo>(GetArena());
+    tcp_info_ = p;
   }
-  return ip_info_;
+  return tcp_info_;
 }
-inline ::appguard::AppGuardIpInfo* AppGuardTcpInfo::mutable_ip_info() {
-  // @@protoc_insertion_point(field_mutable:appguard.AppGuardTcpInfo.ip_info)
-  return _internal_mutable_ip_info();
+inline ::appguard::AppGuardTcpInfo* AppGuardHttpResponse::mutable_tcp_info() {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardHttpResponse.tcp_info)
+  return _internal_mutable_tcp_info();
 }
-inline void AppGuardTcpInfo::set_allocated_ip_info(::appguard::AppGuardIpInfo* ip_info) {
+inline void AppGuardHttpResponse::set_allocated_tcp_info(::appguard::AppGuardTcpInfo* tcp_info) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
   if (message_arena == nullptr) {
-    delete ip_info_;
+    delete tcp_info_;
   }
-  if (ip_info) {
+  if (tcp_info) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(ip_info);
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(tcp_info);
     if (message_arena != submessage_arena) {
-      ip_info = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, ip_info, submessage_arena);
+      tcp_info = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, tcp_info, submessage_arena);
     }
     
   } else {
     
   }
-  ip_info_ = ip_info;
-  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardTcpInfo.ip_info)
-}
-
-// uint64 tcp_id = 3;
-inline void AppGuardTcpInfo::clear_tcp_id() {
-  tcp_id_ = PROTOBUF_ULONGLONG(0);
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint64 AppGuardTcpInfo::_internal_tcp_id() const {
-  return tcp_id_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint64 AppGuardTcpInfo::tcp_id() const {
-  // @@protoc_insertion_point(field_get:appguard.AppGuardTcpInfo.tcp_id)
-  return _internal_tcp_id();
-}
-inline void AppGuardTcpInfo::_internal_set_tcp_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  
-  tcp_id_ = value;
-}
-inline void AppGuardTcpInfo::set_tcp_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_set_tcp_id(value);
-  // @@protoc_insertion_point(field_set:appguard.AppGuardTcpInfo.tcp_id)
+  tcp_info_ = tcp_info;
+  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardHttpResponse.tcp_info)
 }
 
 // -------------------------------------------------------------------
 
 // -------------------------------------------------------------------
 
-// -------------------------------------------------------------------
-
-// AppGuardHttpRequest
+// AppGuardSmtpRequest
 
 // string token = 1;
-inline void AppGuardHttpRequest::clear_token() {
+inline void AppGuardSmtpRequest::clear_token() {
   token_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline const std::string& AppGuardHttpRequest::token() const {
-  // @@protoc_insertion_point(field_get:appguard.AppGuardHttpRequest.token)
+inline const std::string& AppGuardSmtpRequest::token() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardSmtpRequest.token)
   return _internal_token();
 }
-inline void AppGuardHttpRequest::set_token(const std::string& value) {
+inline void AppGuardSmtpRequest::set_token(const std::string& value) {
   _internal_set_token(value);
-  // @@protoc_insertion_point(field_set:appguard.AppGuardHttpRequest.token)
+  // @@protoc_insertion_point(field_set:appguard.AppGuardSmtpRequest.token)
 }
-inline std::string* AppGuardHttpRequest::mutable_token() {
-  // @@protoc_insertion_point(field_mutable:appguard.AppGuardHttpRequest.token)
+inline std::string* AppGuardSmtpRequest::mutable_token() {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardSmtpRequest.token)
   return _internal_mutable_token();
 }
-inline const std::string& AppGuardHttpRequest::_internal_token() const {
+inline const std::string& AppGuardSmtpRequest::_internal_token() const {
   return token_.Get();
 }
-inline void AppGuardHttpRequest::_internal_set_token(const std::string& value) {
+inline void AppGuardSmtpRequest::_internal_set_token(const std::string& value) {
   
   token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
 }
-inline void AppGuardHttpRequest::set_token(std::string&& value) {
+inline void AppGuardSmtpRequest::set_token(std::string&& value) {
   
   token_.Set(
     &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardHttpRequest.token)
+  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardSmtpRequest.token)
 }
-inline void AppGuardHttpRequest::set_token(const char* value) {
+inline void AppGuardSmtpRequest::set_token(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   
   token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
               GetArena());
-  // @@protoc_insertion_point(field_set_char:appguard.AppGuardHttpRequest.token)
+  // @@protoc_insertion_point(field_set_char:appguard.AppGuardSmtpRequest.token)
 }
-inline void AppGuardHttpRequest::set_token(const char* value,
+inline void AppGuardSmtpRequest::set_token(const char* value,
     size_t size) {
   
   token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
       reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardHttpRequest.token)
+  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardSmtpRequest.token)
 }
-inline std::string* AppGuardHttpRequest::_internal_mutable_token() {
+inline std::string* AppGuardSmtpRequest::_internal_mutable_token() {
   
   return token_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline std::string* AppGuardHttpRequest::release_token() {
-  // @@protoc_insertion_point(field_release:appguard.AppGuardHttpRequest.token)
+inline std::string* AppGuardSmtpRequest::release_token() {
+  // @@protoc_insertion_point(field_release:appguard.AppGuardSmtpRequest.token)
   return token_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void AppGuardHttpRequest::set_allocated_token(std::string* token) {
+inline void AppGuardSmtpRequest::set_allocated_token(std::string* token) {
   if (token != nullptr) {
     
   } else {
@@ -4737,16 +6713,16 @@ inline void AppGuardHttpRequest::set_allocated_token(std::string* token) {
   }
   token_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), token,
       GetArena());
-  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardHttpRequest.token)
+  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardSmtpRequest.token)
 }
-inline std::string* AppGuardHttpRequest::unsafe_arena_release_token() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardHttpRequest.token)
+inline std::string* AppGuardSmtpRequest::unsafe_arena_release_token() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardSmtpRequest.token)
   GOOGLE_DCHECK(GetArena() != nullptr);
   
   return token_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       GetArena());
 }
-inline void AppGuardHttpRequest::unsafe_arena_set_allocated_token(
+inline void AppGuardSmtpRequest::unsafe_arena_set_allocated_token(
     std::string* token) {
   GOOGLE_DCHECK(GetArena() != nullptr);
   if (token != nullptr) {
@@ -4756,345 +6732,457 @@ inline void AppGuardHttpRequest::unsafe_arena_set_allocated_token(
   }
   token_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       token, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardHttpRequest.token)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardSmtpRequest.token)
 }
 
-// string original_url = 2;
-inline void AppGuardHttpRequest::clear_original_url() {
-  original_url_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// map<string, string> headers = 2;
+inline int AppGuardSmtpRequest::_internal_headers_size() const {
+  return headers_.size();
 }
-inline const std::string& AppGuardHttpRequest::original_url() const {
-  // @@protoc_insertion_point(field_get:appguard.AppGuardHttpRequest.original_url)
-  return _internal_original_url();
+inline int AppGuardSmtpRequest::headers_size() const {
+  return _internal_headers_size();
 }
-inline void AppGuardHttpRequest::set_original_url(const std::string& value) {
-  _internal_set_original_url(value);
-  // @@protoc_insertion_point(field_set:appguard.AppGuardHttpRequest.original_url)
+inline void AppGuardSmtpRequest::clear_headers() {
+  headers_.Clear();
 }
-inline std::string* AppGuardHttpRequest::mutable_original_url() {
-  // @@protoc_insertion_point(field_mutable:appguard.AppGuardHttpRequest.original_url)
-  return _internal_mutable_original_url();
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+AppGuardSmtpRequest::_internal_headers() const {
+  return headers_.GetMap();
 }
-inline const std::string& AppGuardHttpRequest::_internal_original_url() const {
-  return original_url_.Get();
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+AppGuardSmtpRequest::headers() const {
+  // @@protoc_insertion_point(field_map:appguard.AppGuardSmtpRequest.headers)
+  return _internal_headers();
 }
-inline void AppGuardHttpRequest::_internal_set_original_url(const std::string& value) {
-  
-  original_url_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+AppGuardSmtpRequest::_internal_mutable_headers() {
+  return headers_.MutableMap();
 }
-inline void AppGuardHttpRequest::set_original_url(std::string&& value) {
-  
-  original_url_.Set(
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+AppGuardSmtpRequest::mutable_headers() {
+  // @@protoc_insertion_point(field_mutable_map:appguard.AppGuardSmtpRequest.headers)
+  return _internal_mutable_headers();
+}
+
+// string body = 3;
+inline bool AppGuardSmtpRequest::_internal_has_body() const {
+  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool AppGuardSmtpRequest::has_body() const {
+  return _internal_has_body();
+}
+inline void AppGuardSmtpRequest::clear_body() {
+  body_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& AppGuardSmtpRequest::body() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardSmtpRequest.body)
+  return _internal_body();
+}
+inline void AppGuardSmtpRequest::set_body(const std::string& value) {
+  _internal_set_body(value);
+  // @@protoc_insertion_point(field_set:appguard.AppGuardSmtpRequest.body)
+}
+inline std::string* AppGuardSmtpRequest::mutable_body() {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardSmtpRequest.body)
+  return _internal_mutable_body();
+}
+inline const std::string& AppGuardSmtpRequest::_internal_body() const {
+  return body_.Get();
+}
+inline void AppGuardSmtpRequest::_internal_set_body(const std::string& value) {
+  _has_bits_[0] |= 0x00000001u;
+  body_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void AppGuardSmtpRequest::set_body(std::string&& value) {
+  _has_bits_[0] |= 0x00000001u;
+  body_.Set(
     &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardHttpRequest.original_url)
+  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardSmtpRequest.body)
 }
-inline void AppGuardHttpRequest::set_original_url(const char* value) {
+inline void AppGuardSmtpRequest::set_body(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  
-  original_url_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+  _has_bits_[0] |= 0x00000001u;
+  body_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
               GetArena());
-  // @@protoc_insertion_point(field_set_char:appguard.AppGuardHttpRequest.original_url)
+  // @@protoc_insertion_point(field_set_char:appguard.AppGuardSmtpRequest.body)
 }
-inline void AppGuardHttpRequest::set_original_url(const char* value,
+inline void AppGuardSmtpRequest::set_body(const char* value,
     size_t size) {
-  
-  original_url_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+  _has_bits_[0] |= 0x00000001u;
+  body_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
       reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardHttpRequest.original_url)
+  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardSmtpRequest.body)
 }
-inline std::string* AppGuardHttpRequest::_internal_mutable_original_url() {
-  
-  return original_url_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* AppGuardSmtpRequest::_internal_mutable_body() {
+  _has_bits_[0] |= 0x00000001u;
+  return body_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline std::string* AppGuardHttpRequest::release_original_url() {
-  // @@protoc_insertion_point(field_release:appguard.AppGuardHttpRequest.original_url)
-  return original_url_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* AppGuardSmtpRequest::release_body() {
+  // @@protoc_insertion_point(field_release:appguard.AppGuardSmtpRequest.body)
+  if (!_internal_has_body()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000001u;
+  return body_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void AppGuardHttpRequest::set_allocated_original_url(std::string* original_url) {
-  if (original_url != nullptr) {
-    
+inline void AppGuardSmtpRequest::set_allocated_body(std::string* body) {
+  if (body != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
   } else {
-    
+    _has_bits_[0] &= ~0x00000001u;
   }
-  original_url_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), original_url,
+  body_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), body,
       GetArena());
-  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardHttpRequest.original_url)
+  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardSmtpRequest.body)
 }
-inline std::string* AppGuardHttpRequest::unsafe_arena_release_original_url() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardHttpRequest.original_url)
+inline std::string* AppGuardSmtpRequest::unsafe_arena_release_body() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardSmtpRequest.body)
   GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return original_url_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+  _has_bits_[0] &= ~0x00000001u;
+  return body_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       GetArena());
 }
-inline void AppGuardHttpRequest::unsafe_arena_set_allocated_original_url(
-    std::string* original_url) {
+inline void AppGuardSmtpRequest::unsafe_arena_set_allocated_body(
+    std::string* body) {
   GOOGLE_DCHECK(GetArena() != nullptr);
-  if (original_url != nullptr) {
+  if (body != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  body_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      body, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardSmtpRequest.body)
+}
+
+// .appguard.AppGuardTcpInfo tcp_info = 100;
+inline bool AppGuardSmtpRequest::_internal_has_tcp_info() const {
+  return this != internal_default_instance() && tcp_info_ != nullptr;
+}
+inline bool AppGuardSmtpRequest::has_tcp_info() const {
+  return _internal_has_tcp_info();
+}
+inline void AppGuardSmtpRequest::clear_tcp_info() {
+  if (GetArena() == nullptr && tcp_info_ != nullptr) {
+    delete tcp_info_;
+  }
+  tcp_info_ = nullptr;
+}
+inline const ::appguard::AppGuardTcpInfo& AppGuardSmtpRequest::_internal_tcp_info() const {
+  const ::appguard::AppGuardTcpInfo* p = tcp_info_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::appguard::AppGuardTcpInfo*>(
+      &::appguard::_AppGuardTcpInfo_default_instance_);
+}
+inline const ::appguard::AppGuardTcpInfo& AppGuardSmtpRequest::tcp_info() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardSmtpRequest.tcp_info)
+  return _internal_tcp_info();
+}
+inline void AppGuardSmtpRequest::unsafe_arena_set_allocated_tcp_info(
+    ::appguard::AppGuardTcpInfo* tcp_info) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(tcp_info_);
+  }
+  tcp_info_ = tcp_info;
+  if (tcp_info) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardSmtpRequest.tcp_info)
+}
+inline ::appguard::AppGuardTcpInfo* AppGuardSmtpRequest::release_tcp_info() {
+  auto temp = unsafe_arena_release_tcp_info();
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::appguard::AppGuardTcpInfo* AppGuardSmtpRequest::unsafe_arena_release_tcp_info() {
+  // @@protoc_insertion_point(field_release:appguard.AppGuardSmtpRequest.tcp_info)
+  
+  ::appguard::AppGuardTcpInfo* temp = tcp_info_;
+  tcp_info_ = nullptr;
+  return temp;
+}
+inline ::appguard::AppGuardTcpInfo* AppGuardSmtpRequest::_internal_mutable_tcp_info() {
+  
+  if (tcp_info_ == nullptr) {
+    auto* p = CreateMaybeMessage<::appguard::AppGuardTcpInfo>(GetArena());
+    tcp_info_ = p;
+  }
+  return tcp_info_;
+}
+inline ::appguard::AppGuardTcpInfo* AppGuardSmtpRequest::mutable_tcp_info() {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardSmtpRequest.tcp_info)
+  return _internal_mutable_tcp_info();
+}
+inline void AppGuardSmtpRequest::set_allocated_tcp_info(::appguard::AppGuardTcpInfo* tcp_info) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete tcp_info_;
+  }
+  if (tcp_info) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(tcp_info);
+    if (message_arena != submessage_arena) {
+      tcp_info = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, tcp_info, submessage_arena);
+    }
     
   } else {
     
   }
-  original_url_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      original_url, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardHttpRequest.original_url)
+  tcp_info_ = tcp_info;
+  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardSmtpRequest.tcp_info)
 }
 
-// map<string, string> headers = 3;
-inline int AppGuardHttpRequest::_internal_headers_size() const {
-  return headers_.size();
-}
-inline int AppGuardHttpRequest::headers_size() const {
-  return _internal_headers_size();
-}
-inline void AppGuardHttpRequest::clear_headers() {
-  headers_.Clear();
-}
-inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
-AppGuardHttpRequest::_internal_headers() const {
-  return headers_.GetMap();
-}
-inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
-AppGuardHttpRequest::headers() const {
-  // @@protoc_insertion_point(field_map:appguard.AppGuardHttpRequest.headers)
-  return _internal_headers();
-}
-inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
-AppGuardHttpRequest::_internal_mutable_headers() {
-  return headers_.MutableMap();
-}
-inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
-AppGuardHttpRequest::mutable_headers() {
-  // @@protoc_insertion_point(field_mutable_map:appguard.AppGuardHttpRequest.headers)
-  return _internal_mutable_headers();
-}
+// -------------------------------------------------------------------
 
-// string method = 4;
-inline void AppGuardHttpRequest::clear_method() {
-  method_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// AppGuardSmtpResponse
+
+// string token = 1;
+inline void AppGuardSmtpResponse::clear_token() {
+  token_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline const std::string& AppGuardHttpRequest::method() const {
-  // @@protoc_insertion_point(field_get:appguard.AppGuardHttpRequest.method)
-  return _internal_method();
+inline const std::string& AppGuardSmtpResponse::token() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardSmtpResponse.token)
+  return _internal_token();
 }
-inline void AppGuardHttpRequest::set_method(const std::string& value) {
-  _internal_set_method(value);
-  // @@protoc_insertion_point(field_set:appguard.AppGuardHttpRequest.method)
+inline void AppGuardSmtpResponse::set_token(const std::string& value) {
+  _internal_set_token(value);
+  // @@protoc_insertion_point(field_set:appguard.AppGuardSmtpResponse.token)
 }
-inline std::string* AppGuardHttpRequest::mutable_method() {
-  // @@protoc_insertion_point(field_mutable:appguard.AppGuardHttpRequest.method)
-  return _internal_mutable_method();
+inline std::string* AppGuardSmtpResponse::mutable_token() {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardSmtpResponse.token)
+  return _internal_mutable_token();
 }
-inline const std::string& AppGuardHttpRequest::_internal_method() const {
-  return method_.Get();
+inline const std::string& AppGuardSmtpResponse::_internal_token() const {
+  return token_.Get();
 }
-inline void AppGuardHttpRequest::_internal_set_method(const std::string& value) {
+inline void AppGuardSmtpResponse::_internal_set_token(const std::string& value) {
   
-  method_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+  token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
 }
-inline void AppGuardHttpRequest::set_method(std::string&& value) {
+inline void AppGuardSmtpResponse::set_token(std::string&& value) {
   
-  method_.Set(
+  token_.Set(
     &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardHttpRequest.method)
+  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardSmtpResponse.token)
 }
-inline void AppGuardHttpRequest::set_method(const char* value) {
+inline void AppGuardSmtpResponse::set_token(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   
-  method_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+  token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
               GetArena());
-  // @@protoc_insertion_point(field_set_char:appguard.AppGuardHttpRequest.method)
+  // @@protoc_insertion_point(field_set_char:appguard.AppGuardSmtpResponse.token)
 }
-inline void AppGuardHttpRequest::set_method(const char* value,
+inline void AppGuardSmtpResponse::set_token(const char* value,
     size_t size) {
   
-  method_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+  token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
       reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardHttpRequest.method)
+  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardSmtpResponse.token)
 }
-inline std::string* AppGuardHttpRequest::_internal_mutable_method() {
+inline std::string* AppGuardSmtpResponse::_internal_mutable_token() {
   
-  return method_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return token_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline std::string* AppGuardHttpRequest::release_method() {
-  // @@protoc_insertion_point(field_release:appguard.AppGuardHttpRequest.method)
-  return method_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* AppGuardSmtpResponse::release_token() {
+  // @@protoc_insertion_point(field_release:appguard.AppGuardSmtpResponse.token)
+  return token_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void AppGuardHttpRequest::set_allocated_method(std::string* method) {
-  if (method != nullptr) {
+inline void AppGuardSmtpResponse::set_allocated_token(std::string* token) {
+  if (token != nullptr) {
     
   } else {
     
   }
-  method_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), method,
+  token_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), token,
       GetArena());
-  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardHttpRequest.method)
+  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardSmtpResponse.token)
 }
-inline std::string* AppGuardHttpRequest::unsafe_arena_release_method() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardHttpRequest.method)
+inline std::string* AppGuardSmtpResponse::unsafe_arena_release_token() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardSmtpResponse.token)
   GOOGLE_DCHECK(GetArena() != nullptr);
   
-  return method_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+  return token_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       GetArena());
 }
-inline void AppGuardHttpRequest::unsafe_arena_set_allocated_method(
-    std::string* method) {
+inline void AppGuardSmtpResponse::unsafe_arena_set_allocated_token(
+    std::string* token) {
   GOOGLE_DCHECK(GetArena() != nullptr);
-  if (method != nullptr) {
+  if (token != nullptr) {
     
   } else {
     
   }
-  method_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      method, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardHttpRequest.method)
+  token_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      token, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardSmtpResponse.token)
 }
 
-// string body = 5;
-inline bool AppGuardHttpRequest::_internal_has_body() const {
+// uint32 code = 2;
+inline bool AppGuardSmtpResponse::_internal_has_code() const {
   bool value = (_has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool AppGuardHttpRequest::has_body() const {
-  return _internal_has_body();
+inline bool AppGuardSmtpResponse::has_code() const {
+  return _internal_has_code();
 }
-inline void AppGuardHttpRequest::clear_body() {
-  body_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline void AppGuardSmtpResponse::clear_code() {
+  code_ = 0u;
   _has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& AppGuardHttpRequest::body() const {
-  // @@protoc_insertion_point(field_get:appguard.AppGuardHttpRequest.body)
-  return _internal_body();
+inline ::PROTOBUF_NAMESPACE_ID::uint32 AppGuardSmtpResponse::_internal_code() const {
+  return code_;
 }
-inline void AppGuardHttpRequest::set_body(const std::string& value) {
-  _internal_set_body(value);
-  // @@protoc_insertion_point(field_set:appguard.AppGuardHttpRequest.body)
+inline ::PROTOBUF_NAMESPACE_ID::uint32 AppGuardSmtpResponse::code() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardSmtpResponse.code)
+  return _internal_code();
 }
-inline std::string* AppGuardHttpRequest::mutable_body() {
-  // @@protoc_insertion_point(field_mutable:appguard.AppGuardHttpRequest.body)
-  return _internal_mutable_body();
+inline void AppGuardSmtpResponse::_internal_set_code(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _has_bits_[0] |= 0x00000001u;
+  code_ = value;
 }
-inline const std::string& AppGuardHttpRequest::_internal_body() const {
-  return body_.Get();
+inline void AppGuardSmtpResponse::set_code(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_code(value);
+  // @@protoc_insertion_point(field_set:appguard.AppGuardSmtpResponse.code)
 }
-inline void AppGuardHttpRequest::_internal_set_body(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  body_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+
+// .appguard.AppGuardTcpInfo tcp_info = 100;
+inline bool AppGuardSmtpResponse::_internal_has_tcp_info() const {
+  return this != internal_default_instance() && tcp_info_ != nullptr;
 }
-inline void AppGuardHttpRequest::set_body(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  body_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardHttpRequest.body)
+inline bool AppGuardSmtpResponse::has_tcp_info() const {
+  return _internal_has_tcp_info();
 }
-inline void AppGuardHttpRequest::set_body(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  body_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:appguard.AppGuardHttpRequest.body)
+inline void AppGuardSmtpResponse::clear_tcp_info() {
+  if (GetArena() == nullptr && tcp_info_ != nullptr) {
+    delete tcp_info_;
+  }
+  tcp_info_ = nullptr;
 }
-inline void AppGuardHttpRequest::set_body(const char* value,
-    size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  body_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardHttpRequest.body)
+inline const ::appguard::AppGuardTcpInfo& AppGuardSmtpResponse::_internal_tcp_info() const {
+  const ::appguard::AppGuardTcpInfo* p = tcp_info_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::appguard::AppGuardTcpInfo*>(
+      &::appguard::_AppGuardTcpInfo_default_instance_);
 }
-inline std::string* AppGuardHttpRequest::_internal_mutable_body() {
-  _has_bits_[0] |= 0x00000001u;
-  return body_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline const ::appguard::AppGuardTcpInfo& AppGuardSmtpResponse::tcp_info() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardSmtpResponse.tcp_info)
+  return _internal_tcp_info();
 }
-inline std::string* AppGuardHttpRequest::release_body() {
-  // @@protoc_insertion_point(field_release:appguard.AppGuardHttpRequest.body)
-  if (!_internal_has_body()) {
-    return nullptr;
+inline void AppGuardSmtpResponse::unsafe_arena_set_allocated_tcp_info(
+    ::appguard::AppGuardTcpInfo* tcp_info) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(tcp_info_);
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return body_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline void AppGuardHttpRequest::set_allocated_body(std::string* body) {
-  if (body != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+  tcp_info_ = tcp_info;
+  if (tcp_info) {
+    
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    
   }
-  body_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), body,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardHttpRequest.body)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardSmtpResponse.tcp_info)
 }
-inline std::string* AppGuardHttpRequest::unsafe_arena_release_body() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardHttpRequest.body)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  _has_bits_[0] &= ~0x00000001u;
-  return body_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+inline ::appguard::AppGuardTcpInfo* AppGuardSmtpResponse::release_tcp_info() {
+  auto temp = unsafe_arena_release_tcp_info();
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::appguard::AppGuardTcpInfo* AppGuardSmtpResponse::unsafe_arena_release_tcp_info() {
+  // @@protoc_insertion_point(field_release:appguard.AppGuardSmtpResponse.tcp_info)
+  
+  ::appguard::AppGuardTcpInfo* temp = tcp_info_;
+  tcp_info_ = nullptr;
+  return temp;
+}
+inline ::appguard::AppGuardTcpInfo* AppGuardSmtpResponse::_internal_mutable_tcp_info() {
+  
+  if (tcp_info_ == nullptr) {
+    auto* p = CreateMaybeMessage<::appguard::AppGuardTcpInfo>(GetArena());
+    tcp_info_ = p;
+  }
+  return tcp_info_;
 }
-inline void AppGuardHttpRequest::unsafe_arena_set_allocated_body(
-    std::string* body) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (body != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+inline ::appguard::AppGuardTcpInfo* AppGuardSmtpResponse::mutable_tcp_info() {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardSmtpResponse.tcp_info)
+  return _internal_mutable_tcp_info();
+}
+inline void AppGuardSmtpResponse::set_allocated_tcp_info(::appguard::AppGuardTcpInfo* tcp_info) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete tcp_info_;
+  }
+  if (tcp_info) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(tcp_info);
+    if (message_arena != submessage_arena) {
+      tcp_info = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, tcp_info, submessage_arena);
+    }
+    
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    
   }
-  body_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      body, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardHttpRequest.body)
+  tcp_info_ = tcp_info;
+  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardSmtpResponse.tcp_info)
 }
 
-// map<string, string> query = 6;
-inline int AppGuardHttpRequest::_internal_query_size() const {
-  return query_.size();
-}
-inline int AppGuardHttpRequest::query_size() const {
-  return _internal_query_size();
-}
-inline void AppGuardHttpRequest::clear_query() {
-  query_.Clear();
+// -------------------------------------------------------------------
+
+// AppGuardResponse
+
+// .appguard_commands.FirewallPolicy policy = 2;
+inline void AppGuardResponse::clear_policy() {
+  policy_ = 0;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
-AppGuardHttpRequest::_internal_query() const {
-  return query_.GetMap();
+inline ::appguard_commands::FirewallPolicy AppGuardResponse::_internal_policy() const {
+  return static_cast< ::appguard_commands::FirewallPolicy >(policy_);
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
-AppGuardHttpRequest::query() const {
-  // @@protoc_insertion_point(field_map:appguard.AppGuardHttpRequest.query)
-  return _internal_query();
+inline ::appguard_commands::FirewallPolicy AppGuardResponse::policy() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardResponse.policy)
+  return _internal_policy();
 }
-inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
-AppGuardHttpRequest::_internal_mutable_query() {
-  return query_.MutableMap();
+inline void AppGuardResponse::_internal_set_policy(::appguard_commands::FirewallPolicy value) {
+  
+  policy_ = value;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
-AppGuardHttpRequest::mutable_query() {
-  // @@protoc_insertion_point(field_mutable_map:appguard.AppGuardHttpRequest.query)
-  return _internal_mutable_query();
+inline void AppGuardResponse::set_policy(::appguard_commands::FirewallPolicy value) {
+  _internal_set_policy(value);
+  // @@protoc_insertion_point(field_set:appguard.AppGuardResponse.policy)
 }
 
-// .appguard.AppGuardTcpInfo tcp_info = 100;
-inline bool AppGuardHttpRequest::_internal_has_tcp_info() const {
+// -------------------------------------------------------------------
+
+// AppGuardTcpResponse
+
+// .appguard.AppGuardTcpInfo tcp_info = 1;
+inline bool AppGuardTcpResponse::_internal_has_tcp_info() const {
   return this != internal_default_instance() && tcp_info_ != nullptr;
 }
-inline bool AppGuardHttpRequest::has_tcp_info() const {
+inline bool AppGuardTcpResponse::has_tcp_info() const {
   return _internal_has_tcp_info();
 }
-inline void AppGuardHttpRequest::clear_tcp_info() {
+inline void AppGuardTcpResponse::clear_tcp_info() {
   if (GetArena() == nullptr && tcp_info_ != nullptr) {
     delete tcp_info_;
   }
   tcp_info_ = nullptr;
 }
-inline const ::appguard::AppGuardTcpInfo& AppGuardHttpRequest::_internal_tcp_info() const {
+inline const ::appguard::AppGuardTcpInfo& AppGuardTcpResponse::_internal_tcp_info() const {
   const ::appguard::AppGuardTcpInfo* p = tcp_info_;
   return p != nullptr ? *p : *reinterpret_cast<const ::appguard::AppGuardTcpInfo*>(
       &::appguard::_AppGuardTcpInfo_default_instance_);
 }
-inline const ::appguard::AppGuardTcpInfo& AppGuardHttpRequest::tcp_info() const {
-  // @@protoc_insertion_point(field_get:appguard.AppGuardHttpRequest.tcp_info)
+inline const ::appguard::AppGuardTcpInfo& AppGuardTcpResponse::tcp_info() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardTcpResponse.tcp_info)
   return _internal_tcp_info();
 }
-inline void AppGuardHttpRequest::unsafe_arena_set_allocated_tcp_info(
+inline void AppGuardTcpResponse::unsafe_arena_set_allocated_tcp_info(
     ::appguard::AppGuardTcpInfo* tcp_info) {
   if (GetArena() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(tcp_info_);
@@ -5105,23 +7193,23 @@ inline void AppGuardHttpRequest::unsafe_arena_set_allocated_tcp_info(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardHttpRequest.tcp_info)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardTcpResponse.tcp_info)
 }
-inline ::appguard::AppGuardTcpInfo* AppGuardHttpRequest::release_tcp_info() {
+inline ::appguard::AppGuardTcpInfo* AppGuardTcpResponse::release_tcp_info() {
   auto temp = unsafe_arena_release_tcp_info();
   if (GetArena() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
   return temp;
 }
-inline ::appguard::AppGuardTcpInfo* AppGuardHttpRequest::unsafe_arena_release_tcp_info() {
-  // @@protoc_insertion_point(field_release:appguard.AppGuardHttpRequest.tcp_info)
+inline ::appguard::AppGuardTcpInfo* AppGuardTcpResponse::unsafe_arena_release_tcp_info() {
+  // @@protoc_insertion_point(field_release:appguard.AppGuardTcpResponse.tcp_info)
   
   ::appguard::AppGuardTcpInfo* temp = tcp_info_;
   tcp_info_ = nullptr;
   return temp;
 }
-inline ::appguard::AppGuardTcpInfo* AppGuardHttpRequest::_internal_mutable_tcp_info() {
+inline ::appguard::AppGuardTcpInfo* AppGuardTcpResponse::_internal_mutable_tcp_info() {
   
   if (tcp_info_ == nullptr) {
     auto* p = CreateMaybeMessage<::appguard::AppGuardTcpInfo>(GetArena());
@@ -5129,11 +7217,11 @@ inline ::appguard::AppGuardTcpInfo* AppGuardHttpRequest::_internal_mutable_tcp_i
   }
   return tcp_info_;
 }
-inline ::appguard::AppGuardTcpInfo* AppGuardHttpRequest::mutable_tcp_info() {
-  // @@protoc_insertion_point(field_mutable:appguard.AppGuardHttpRequest.tcp_info)
+inline ::appguard::AppGuardTcpInfo* AppGuardTcpResponse::mutable_tcp_info() {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardTcpResponse.tcp_info)
   return _internal_mutable_tcp_info();
 }
-inline void AppGuardHttpRequest::set_allocated_tcp_info(::appguard::AppGuardTcpInfo* tcp_info) {
+inline void AppGuardTcpResponse::set_allocated_tcp_info(::appguard::AppGuardTcpInfo* tcp_info) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
   if (message_arena == nullptr) {
     delete tcp_info_;
@@ -5150,67 +7238,65 @@ inline void AppGuardHttpRequest::set_allocated_tcp_info(::appguard::AppGuardTcpI
     
   }
   tcp_info_ = tcp_info;
-  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardHttpRequest.tcp_info)
+  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardTcpResponse.tcp_info)
 }
 
 // -------------------------------------------------------------------
 
-// -------------------------------------------------------------------
-
-// AppGuardHttpResponse
+// AppGuardTcpConnectionBatch
 
 // string token = 1;
-inline void AppGuardHttpResponse::clear_token() {
+inline void AppGuardTcpConnectionBatch::clear_token() {
   token_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline const std::string& AppGuardHttpResponse::token() const {
-  // @@protoc_insertion_point(field_get:appguard.AppGuardHttpResponse.token)
+inline const std::string& AppGuardTcpConnectionBatch::token() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardTcpConnectionBatch.token)
   return _internal_token();
 }
-inline void AppGuardHttpResponse::set_token(const std::string& value) {
+inline void AppGuardTcpConnectionBatch::set_token(const std::string& value) {
   _internal_set_token(value);
-  // @@protoc_insertion_point(field_set:appguard.AppGuardHttpResponse.token)
+  // @@protoc_insertion_point(field_set:appguard.AppGuardTcpConnectionBatch.token)
 }
-inline std::string* AppGuardHttpResponse::mutable_token() {
-  // @@protoc_insertion_point(field_mutable:appguard.AppGuardHttpResponse.token)
+inline std::string* AppGuardTcpConnectionBatch::mutable_token() {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardTcpConnectionBatch.token)
   return _internal_mutable_token();
 }
-inline const std::string& AppGuardHttpResponse::_internal_token() const {
+inline const std::string& AppGuardTcpConnectionBatch::_internal_token() const {
   return token_.Get();
 }
-inline void AppGuardHttpResponse::_internal_set_token(const std::string& value) {
+inline void AppGuardTcpConnectionBatch::_internal_set_token(const std::string& value) {
   
   token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
 }
-inline void AppGuardHttpResponse::set_token(std::string&& value) {
+inline void AppGuardTcpConnectionBatch::set_token(std::string&& value) {
   
   token_.Set(
     &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardHttpResponse.token)
+  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardTcpConnectionBatch.token)
 }
-inline void AppGuardHttpResponse::set_token(const char* value) {
+inline void AppGuardTcpConnectionBatch::set_token(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   
   token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
               GetArena());
-  // @@protoc_insertion_point(field_set_char:appguard.AppGuardHttpResponse.token)
+  // @@protoc_insertion_point(field_set_char:appguard.AppGuardTcpConnectionBatch.token)
 }
-inline void AppGuardHttpResponse::set_token(const char* value,
+inline void AppGuardTcpConnectionBatch::set_token(const char* value,
     size_t size) {
   
   token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
       reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardHttpResponse.token)
+  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardTcpConnectionBatch.token)
 }
-inline std::string* AppGuardHttpResponse::_internal_mutable_token() {
+inline std::string* AppGuardTcpConnectionBatch::_internal_mutable_token() {
   
   return token_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline std::string* AppGuardHttpResponse::release_token() {
-  // @@protoc_insertion_point(field_release:appguard.AppGuardHttpResponse.token)
+inline std::string* AppGuardTcpConnectionBatch::release_token() {
+  // @@protoc_insertion_point(field_release:appguard.AppGuardTcpConnectionBatch.token)
   return token_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void AppGuardHttpResponse::set_allocated_token(std::string* token) {
+inline void AppGuardTcpConnectionBatch::set_allocated_token(std::string* token) {
   if (token != nullptr) {
     
   } else {
@@ -5218,16 +7304,16 @@ inline void AppGuardHttpResponse::set_allocated_token(std::string* token) {
   }
   token_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), token,
       GetArena());
-  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardHttpResponse.token)
+  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardTcpConnectionBatch.token)
 }
-inline std::string* AppGuardHttpResponse::unsafe_arena_release_token() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardHttpResponse.token)
+inline std::string* AppGuardTcpConnectionBatch::unsafe_arena_release_token() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardTcpConnectionBatch.token)
   GOOGLE_DCHECK(GetArena() != nullptr);
   
   return token_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       GetArena());
 }
-inline void AppGuardHttpResponse::unsafe_arena_set_allocated_token(
+inline void AppGuardTcpConnectionBatch::unsafe_arena_set_allocated_token(
     std::string* token) {
   GOOGLE_DCHECK(GetArena() != nullptr);
   if (token != nullptr) {
@@ -5237,197 +7323,147 @@ inline void AppGuardHttpResponse::unsafe_arena_set_allocated_token(
   }
   token_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       token, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardHttpResponse.token)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardTcpConnectionBatch.token)
 }
 
-// uint32 code = 2;
-inline void AppGuardHttpResponse::clear_code() {
-  code_ = 0u;
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint32 AppGuardHttpResponse::_internal_code() const {
-  return code_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint32 AppGuardHttpResponse::code() const {
-  // @@protoc_insertion_point(field_get:appguard.AppGuardHttpResponse.code)
-  return _internal_code();
+// repeated .appguard.AppGuardTcpConnection connections = 2;
+inline int AppGuardTcpConnectionBatch::_internal_connections_size() const {
+  return connections_.size();
 }
-inline void AppGuardHttpResponse::_internal_set_code(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  
-  code_ = value;
+inline int AppGuardTcpConnectionBatch::connections_size() const {
+  return _internal_connections_size();
 }
-inline void AppGuardHttpResponse::set_code(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _internal_set_code(value);
-  // @@protoc_insertion_point(field_set:appguard.AppGuardHttpResponse.code)
+inline void AppGuardTcpConnectionBatch::clear_connections() {
+  connections_.Clear();
 }
-
-// map<string, string> headers = 3;
-inline int AppGuardHttpResponse::_internal_headers_size() const {
-  return headers_.size();
+inline ::appguard::AppGuardTcpConnection* AppGuardTcpConnectionBatch::mutable_connections(int index) {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardTcpConnectionBatch.connections)
+  return connections_.Mutable(index);
 }
-inline int AppGuardHttpResponse::headers_size() const {
-  return _internal_headers_size();
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::appguard::AppGuardTcpConnection >*
+AppGuardTcpConnectionBatch::mutable_connections() {
+  // @@protoc_insertion_point(field_mutable_list:appguard.AppGuardTcpConnectionBatch.connections)
+  return &connections_;
 }
-inline void AppGuardHttpResponse::clear_headers() {
-  headers_.Clear();
+inline const ::appguard::AppGuardTcpConnection& AppGuardTcpConnectionBatch::_internal_connections(int index) const {
+  return connections_.Get(index);
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
-AppGuardHttpResponse::_internal_headers() const {
-  return headers_.GetMap();
+inline const ::appguard::AppGuardTcpConnection& AppGuardTcpConnectionBatch::connections(int index) const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardTcpConnectionBatch.connections)
+  return _internal_connections(index);
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
-AppGuardHttpResponse::headers() const {
-  // @@protoc_insertion_point(field_map:appguard.AppGuardHttpResponse.headers)
-  return _internal_headers();
+inline ::appguard::AppGuardTcpConnection* AppGuardTcpConnectionBatch::_internal_add_connections() {
+  return connections_.Add();
 }
-inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
-AppGuardHttpResponse::_internal_mutable_headers() {
-  return headers_.MutableMap();
+inline ::appguard::AppGuardTcpConnection* AppGuardTcpConnectionBatch::add_connections() {
+  // @@protoc_insertion_point(field_add:appguard.AppGuardTcpConnectionBatch.connections)
+  return _internal_add_connections();
 }
-inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
-AppGuardHttpResponse::mutable_headers() {
-  // @@protoc_insertion_point(field_mutable_map:appguard.AppGuardHttpResponse.headers)
-  return _internal_mutable_headers();
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::appguard::AppGuardTcpConnection >&
+AppGuardTcpConnectionBatch::connections() const {
+  // @@protoc_insertion_point(field_list:appguard.AppGuardTcpConnectionBatch.connections)
+  return connections_;
 }
 
-// .appguard.AppGuardTcpInfo tcp_info = 100;
-inline bool AppGuardHttpResponse::_internal_has_tcp_info() const {
-  return this != internal_default_instance() && tcp_info_ != nullptr;
-}
-inline bool AppGuardHttpResponse::has_tcp_info() const {
-  return _internal_has_tcp_info();
-}
-inline void AppGuardHttpResponse::clear_tcp_info() {
-  if (GetArena() == nullptr && tcp_info_ != nullptr) {
-    delete tcp_info_;
-  }
-  tcp_info_ = nullptr;
-}
-inline const ::appguard::AppGuardTcpInfo& AppGuardHttpResponse::_internal_tcp_info() const {
-  const ::appguard::AppGuardTcpInfo* p = tcp_info_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::appguard::AppGuardTcpInfo*>(
-      &::appguard::_AppGuardTcpInfo_default_instance_);
-}
-inline const ::appguard::AppGuardTcpInfo& AppGuardHttpResponse::tcp_info() const {
-  // @@protoc_insertion_point(field_get:appguard.AppGuardHttpResponse.tcp_info)
-  return _internal_tcp_info();
-}
-inline void AppGuardHttpResponse::unsafe_arena_set_allocated_tcp_info(
-    ::appguard::AppGuardTcpInfo* tcp_info) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(tcp_info_);
-  }
-  tcp_info_ = tcp_info;
-  if (tcp_info) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardHttpResponse.tcp_info)
-}
-inline ::appguard::AppGuardTcpInfo* AppGuardHttpResponse::release_tcp_info() {
-  auto temp = unsafe_arena_release_tcp_info();
-  if (GetArena() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-  return temp;
-}
-inline ::appguard::AppGuardTcpInfo* AppGuardHttpResponse::unsafe_arena_release_tcp_info() {
-  // @@protoc_insertion_point(field_release:appguard.AppGuardHttpResponse.tcp_info)
-  
-  ::appguard::AppGuardTcpInfo* temp = tcp_info_;
-  tcp_info_ = nullptr;
-  return temp;
+// -------------------------------------------------------------------
+
+// AppGuardTcpResponseBatch
+
+// repeated .appguard.AppGuardTcpResponse responses = 1;
+inline int AppGuardTcpResponseBatch::_internal_responses_size() const {
+  return responses_.size();
 }
-inline ::appguard::AppGuardTcpInfo* AppGuardHttpResponse::_internal_mutable_tcp_info() {
-  
-  if (tcp_info_ == nullptr) {
-    auto* p = CreateMaybeMessage<::appguard::AppGuardTcpInfo>(GetArena());
-    tcp_info_ = p;
-  }
-  return tcp_info_;
+inline int AppGuardTcpResponseBatch::responses_size() const {
+  return _internal_responses_size();
 }
-inline ::appguard::AppGuardTcpInfo* AppGuardHttpResponse::mutable_tcp_info() {
-  // @@protoc_insertion_point(field_mutable:appguard.AppGuardHttpResponse.tcp_info)
-  return _internal_mutable_tcp_info();
+inline void AppGuardTcpResponseBatch::clear_responses() {
+  responses_.Clear();
 }
-inline void AppGuardHttpResponse::set_allocated_tcp_info(::appguard::AppGuardTcpInfo* tcp_info) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
-  if (message_arena == nullptr) {
-    delete tcp_info_;
-  }
-  if (tcp_info) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(tcp_info);
-    if (message_arena != submessage_arena) {
-      tcp_info = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, tcp_info, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  tcp_info_ = tcp_info;
-  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardHttpResponse.tcp_info)
+inline ::appguard::AppGuardTcpResponse* AppGuardTcpResponseBatch::mutable_responses(int index) {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardTcpResponseBatch.responses)
+  return responses_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::appguard::AppGuardTcpResponse >*
+AppGuardTcpResponseBatch::mutable_responses() {
+  // @@protoc_insertion_point(field_mutable_list:appguard.AppGuardTcpResponseBatch.responses)
+  return &responses_;
+}
+inline const ::appguard::AppGuardTcpResponse& AppGuardTcpResponseBatch::_internal_responses(int index) const {
+  return responses_.Get(index);
+}
+inline const ::appguard::AppGuardTcpResponse& AppGuardTcpResponseBatch::responses(int index) const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardTcpResponseBatch.responses)
+  return _internal_responses(index);
+}
+inline ::appguard::AppGuardTcpResponse* AppGuardTcpResponseBatch::_internal_add_responses() {
+  return responses_.Add();
+}
+inline ::appguard::AppGuardTcpResponse* AppGuardTcpResponseBatch::add_responses() {
+  // @@protoc_insertion_point(field_add:appguard.AppGuardTcpResponseBatch.responses)
+  return _internal_add_responses();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::appguard::AppGuardTcpResponse >&
+AppGuardTcpResponseBatch::responses() const {
+  // @@protoc_insertion_point(field_list:appguard.AppGuardTcpResponseBatch.responses)
+  return responses_;
 }
 
 // -------------------------------------------------------------------
 
-// -------------------------------------------------------------------
-
-// AppGuardSmtpRequest
+// AppGuardHttpRequestBatch
 
 // string token = 1;
-inline void AppGuardSmtpRequest::clear_token() {
+inline void AppGuardHttpRequestBatch::clear_token() {
   token_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline const std::string& AppGuardSmtpRequest::token() const {
-  // @@protoc_insertion_point(field_get:appguard.AppGuardSmtpRequest.token)
+inline const std::string& AppGuardHttpRequestBatch::token() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardHttpRequestBatch.token)
   return _internal_token();
 }
-inline void AppGuardSmtpRequest::set_token(const std::string& value) {
+inline void AppGuardHttpRequestBatch::set_token(const std::string& value) {
   _internal_set_token(value);
-  // @@protoc_insertion_point(field_set:appguard.AppGuardSmtpRequest.token)
+  // @@protoc_insertion_point(field_set:appguard.AppGuardHttpRequestBatch.token)
 }
-inline std::string* AppGuardSmtpRequest::mutable_token() {
-  // @@protoc_insertion_point(field_mutable:appguard.AppGuardSmtpRequest.token)
+inline std::string* AppGuardHttpRequestBatch::mutable_token() {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardHttpRequestBatch.token)
   return _internal_mutable_token();
 }
-inline const std::string& AppGuardSmtpRequest::_internal_token() const {
+inline const std::string& AppGuardHttpRequestBatch::_internal_token() const {
   return token_.Get();
 }
-inline void AppGuardSmtpRequest::_internal_set_token(const std::string& value) {
+inline void AppGuardHttpRequestBatch::_internal_set_token(const std::string& value) {
   
   token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
 }
-inline void AppGuardSmtpRequest::set_token(std::string&& value) {
+inline void AppGuardHttpRequestBatch::set_token(std::string&& value) {
   
   token_.Set(
     &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardSmtpRequest.token)
+  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardHttpRequestBatch.token)
 }
-inline void AppGuardSmtpRequest::set_token(const char* value) {
+inline void AppGuardHttpRequestBatch::set_token(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   
   token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
               GetArena());
-  // @@protoc_insertion_point(field_set_char:appguard.AppGuardSmtpRequest.token)
+  // @@protoc_insertion_point(field_set_char:appguard.AppGuardHttpRequestBatch.token)
 }
-inline void AppGuardSmtpRequest::set_token(const char* value,
+inline void AppGuardHttpRequestBatch::set_token(const char* value,
     size_t size) {
   
   token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
       reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardSmtpRequest.token)
+  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardHttpRequestBatch.token)
 }
-inline std::string* AppGuardSmtpRequest::_internal_mutable_token() {
+inline std::string* AppGuardHttpRequestBatch::_internal_mutable_token() {
   
   return token_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline std::string* AppGuardSmtpRequest::release_token() {
-  // @@protoc_insertion_point(field_release:appguard.AppGuardSmtpRequest.token)
+inline std::string* AppGuardHttpRequestBatch::release_token() {
+  // @@protoc_insertion_point(field_release:appguard.AppGuardHttpRequestBatch.token)
   return token_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void AppGuardSmtpRequest::set_allocated_token(std::string* token) {
+inline void AppGuardHttpRequestBatch::set_allocated_token(std::string* token) {
   if (token != nullptr) {
     
   } else {
@@ -5435,16 +7471,16 @@ inline void AppGuardSmtpRequest::set_allocated_token(std::string* token) {
   }
   token_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), token,
       GetArena());
-  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardSmtpRequest.token)
+  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardHttpRequestBatch.token)
 }
-inline std::string* AppGuardSmtpRequest::unsafe_arena_release_token() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardSmtpRequest.token)
+inline std::string* AppGuardHttpRequestBatch::unsafe_arena_release_token() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardHttpRequestBatch.token)
   GOOGLE_DCHECK(GetArena() != nullptr);
   
   return token_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       GetArena());
 }
-inline void AppGuardSmtpRequest::unsafe_arena_set_allocated_token(
+inline void AppGuardHttpRequestBatch::unsafe_arena_set_allocated_token(
     std::string* token) {
   GOOGLE_DCHECK(GetArena() != nullptr);
   if (token != nullptr) {
@@ -5454,268 +7490,291 @@ inline void AppGuardSmtpRequest::unsafe_arena_set_allocated_token(
   }
   token_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       token, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardSmtpRequest.token)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardHttpRequestBatch.token)
 }
 
-// map<string, string> headers = 2;
-inline int AppGuardSmtpRequest::_internal_headers_size() const {
-  return headers_.size();
+// repeated .appguard.AppGuardHttpRequest requests = 2;
+inline int AppGuardHttpRequestBatch::_internal_requests_size() const {
+  return requests_.size();
 }
-inline int AppGuardSmtpRequest::headers_size() const {
-  return _internal_headers_size();
+inline int AppGuardHttpRequestBatch::requests_size() const {
+  return _internal_requests_size();
 }
-inline void AppGuardSmtpRequest::clear_headers() {
-  headers_.Clear();
+inline void AppGuardHttpRequestBatch::clear_requests() {
+  requests_.Clear();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
-AppGuardSmtpRequest::_internal_headers() const {
-  return headers_.GetMap();
+inline ::appguard::AppGuardHttpRequest* AppGuardHttpRequestBatch::mutable_requests(int index) {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardHttpRequestBatch.requests)
+  return requests_.Mutable(index);
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
-AppGuardSmtpRequest::headers() const {
-  // @@protoc_insertion_point(field_map:appguard.AppGuardSmtpRequest.headers)
-  return _internal_headers();
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::appguard::AppGuardHttpRequest >*
+AppGuardHttpRequestBatch::mutable_requests() {
+  // @@protoc_insertion_point(field_mutable_list:appguard.AppGuardHttpRequestBatch.requests)
+  return &requests_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
-AppGuardSmtpRequest::_internal_mutable_headers() {
-  return headers_.MutableMap();
+inline const ::appguard::AppGuardHttpRequest& AppGuardHttpRequestBatch::_internal_requests(int index) const {
+  return requests_.Get(index);
 }
-inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
-AppGuardSmtpRequest::mutable_headers() {
-  // @@protoc_insertion_point(field_mutable_map:appguard.AppGuardSmtpRequest.headers)
-  return _internal_mutable_headers();
+inline const ::appguard::AppGuardHttpRequest& AppGuardHttpRequestBatch::requests(int index) const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardHttpRequestBatch.requests)
+  return _internal_requests(index);
 }
-
-// string body = 3;
-inline bool AppGuardSmtpRequest::_internal_has_body() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
-  return value;
+inline ::appguard::AppGuardHttpRequest* AppGuardHttpRequestBatch::_internal_add_requests() {
+  return requests_.Add();
 }
-inline bool AppGuardSmtpRequest::has_body() const {
-  return _internal_has_body();
+inline ::appguard::AppGuardHttpRequest* AppGuardHttpRequestBatch::add_requests() {
+  // @@protoc_insertion_point(field_add:appguard.AppGuardHttpRequestBatch.requests)
+  return _internal_add_requests();
 }
-inline void AppGuardSmtpRequest::clear_body() {
-  body_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  _has_bits_[0] &= ~0x00000001u;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::appguard::AppGuardHttpRequest >&
+AppGuardHttpRequestBatch::requests() const {
+  // @@protoc_insertion_point(field_list:appguard.AppGuardHttpRequestBatch.requests)
+  return requests_;
 }
-inline const std::string& AppGuardSmtpRequest::body() const {
-  // @@protoc_insertion_point(field_get:appguard.AppGuardSmtpRequest.body)
-  return _internal_body();
+
+// -------------------------------------------------------------------
+
+// AppGuardHttpResponseBatch
+
+// string token = 1;
+inline void AppGuardHttpResponseBatch::clear_token() {
+  token_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void AppGuardSmtpRequest::set_body(const std::string& value) {
-  _internal_set_body(value);
-  // @@protoc_insertion_point(field_set:appguard.AppGuardSmtpRequest.body)
+inline const std::string& AppGuardHttpResponseBatch::token() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardHttpResponseBatch.token)
+  return _internal_token();
 }
-inline std::string* AppGuardSmtpRequest::mutable_body() {
-  // @@protoc_insertion_point(field_mutable:appguard.AppGuardSmtpRequest.body)
-  return _internal_mutable_body();
+inline void AppGuardHttpResponseBatch::set_token(const std::string& value) {
+  _internal_set_token(value);
+  // @@protoc_insertion_point(field_set:appguard.AppGuardHttpResponseBatch.token)
 }
-inline const std::string& AppGuardSmtpRequest::_internal_body() const {
-  return body_.Get();
+inline std::string* AppGuardHttpResponseBatch::mutable_token() {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardHttpResponseBatch.token)
+  return _internal_mutable_token();
 }
-inline void AppGuardSmtpRequest::_internal_set_body(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  body_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline const std::string& AppGuardHttpResponseBatch::_internal_token() const {
+  return token_.Get();
 }
-inline void AppGuardSmtpRequest::set_body(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  body_.Set(
+inline void AppGuardHttpResponseBatch::_internal_set_token(const std::string& value) {
+  
+  token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void AppGuardHttpResponseBatch::set_token(std::string&& value) {
+  
+  token_.Set(
     &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardSmtpRequest.body)
+  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardHttpResponseBatch.token)
 }
-inline void AppGuardSmtpRequest::set_body(const char* value) {
+inline void AppGuardHttpResponseBatch::set_token(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  body_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+  
+  token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
               GetArena());
-  // @@protoc_insertion_point(field_set_char:appguard.AppGuardSmtpRequest.body)
+  // @@protoc_insertion_point(field_set_char:appguard.AppGuardHttpResponseBatch.token)
 }
-inline void AppGuardSmtpRequest::set_body(const char* value,
+inline void AppGuardHttpResponseBatch::set_token(const char* value,
     size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  body_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+  
+  token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
       reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardSmtpRequest.body)
+  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardHttpResponseBatch.token)
 }
-inline std::string* AppGuardSmtpRequest::_internal_mutable_body() {
-  _has_bits_[0] |= 0x00000001u;
-  return body_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* AppGuardHttpResponseBatch::_internal_mutable_token() {
+  
+  return token_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline std::string* AppGuardSmtpRequest::release_body() {
-  // @@protoc_insertion_point(field_release:appguard.AppGuardSmtpRequest.body)
-  if (!_internal_has_body()) {
-    return nullptr;
-  }
-  _has_bits_[0] &= ~0x00000001u;
-  return body_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* AppGuardHttpResponseBatch::release_token() {
+  // @@protoc_insertion_point(field_release:appguard.AppGuardHttpResponseBatch.token)
+  return token_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void AppGuardSmtpRequest::set_allocated_body(std::string* body) {
-  if (body != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+inline void AppGuardHttpResponseBatch::set_allocated_token(std::string* token) {
+  if (token != nullptr) {
+    
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    
   }
-  body_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), body,
+  token_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), token,
       GetArena());
-  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardSmtpRequest.body)
+  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardHttpResponseBatch.token)
 }
-inline std::string* AppGuardSmtpRequest::unsafe_arena_release_body() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardSmtpRequest.body)
+inline std::string* AppGuardHttpResponseBatch::unsafe_arena_release_token() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardHttpResponseBatch.token)
   GOOGLE_DCHECK(GetArena() != nullptr);
-  _has_bits_[0] &= ~0x00000001u;
-  return body_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+  
+  return token_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       GetArena());
 }
-inline void AppGuardSmtpRequest::unsafe_arena_set_allocated_body(
-    std::string* body) {
+inline void AppGuardHttpResponseBatch::unsafe_arena_set_allocated_token(
+    std::string* token) {
   GOOGLE_DCHECK(GetArena() != nullptr);
-  if (body != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+  if (token != nullptr) {
+    
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    
   }
-  body_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      body, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardSmtpRequest.body)
+  token_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      token, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardHttpResponseBatch.token)
 }
 
-// .appguard.AppGuardTcpInfo tcp_info = 100;
-inline bool AppGuardSmtpRequest::_internal_has_tcp_info() const {
-  return this != internal_default_instance() && tcp_info_ != nullptr;
+// repeated .appguard.AppGuardHttpResponse responses = 2;
+inline int AppGuardHttpResponseBatch::_internal_responses_size() const {
+  return responses_.size();
 }
-inline bool AppGuardSmtpRequest::has_tcp_info() const {
-  return _internal_has_tcp_info();
+inline int AppGuardHttpResponseBatch::responses_size() const {
+  return _internal_responses_size();
 }
-inline void AppGuardSmtpRequest::clear_tcp_info() {
-  if (GetArena() == nullptr && tcp_info_ != nullptr) {
-    delete tcp_info_;
-  }
-  tcp_info_ = nullptr;
+inline void AppGuardHttpResponseBatch::clear_responses() {
+  responses_.Clear();
 }
-inline const ::appguard::AppGuardTcpInfo& AppGuardSmtpRequest::_internal_tcp_info() const {
-  const ::appguard::AppGuardTcpInfo* p = tcp_info_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::appguard::AppGuardTcpInfo*>(
-      &::appguard::_AppGuardTcpInfo_default_instance_);
+inline ::appguard::AppGuardHttpResponse* AppGuardHttpResponseBatch::mutable_responses(int index) {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardHttpResponseBatch.responses)
+  return responses_.Mutable(index);
 }
-inline const ::appguard::AppGuardTcpInfo& AppGuardSmtpRequest::tcp_info() const {
-  // @@protoc_insertion_point(field_get:appguard.AppGuardSmtpRequest.tcp_info)
-  return _internal_tcp_info();
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::appguard::AppGuardHttpResponse >*
+AppGuardHttpResponseBatch::mutable_responses() {
+  // @@protoc_insertion_point(field_mutable_list:appguard.AppGuardHttpResponseBatch.responses)
+  return &responses_;
 }
-inline void AppGuardSmtpRequest::unsafe_arena_set_allocated_tcp_info(
-    ::appguard::AppGuardTcpInfo* tcp_info) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(tcp_info_);
-  }
-  tcp_info_ = tcp_info;
-  if (tcp_info) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardSmtpRequest.tcp_info)
+inline const ::appguard::AppGuardHttpResponse& AppGuardHttpResponseBatch::_internal_responses(int index) const {
+  return responses_.Get(index);
 }
-inline ::appguard::AppGuardTcpInfo* AppGuardSmtpRequest::release_tcp_info() {
-  auto temp = unsafe_arena_release_tcp_info();
-  if (GetArena() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-  return temp;
+inline const ::appguard::AppGuardHttpResponse& AppGuardHttpResponseBatch::responses(int index) const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardHttpResponseBatch.responses)
+  return _internal_responses(index);
 }
-inline ::appguard::AppGuardTcpInfo* AppGuardSmtpRequest::unsafe_arena_release_tcp_info() {
-  // @@protoc_insertion_point(field_release:appguard.AppGuardSmtpRequest.tcp_info)
-  
-  ::appguard::AppGuardTcpInfo* temp = tcp_info_;
-  tcp_info_ = nullptr;
-  return temp;
+inline ::appguard::AppGuardHttpResponse* AppGuardHttpResponseBatch::_internal_add_responses() {
+  return responses_.Add();
 }
-inline ::appguard::AppGuardTcpInfo* AppGuardSmtpRequest::_internal_mutable_tcp_info() {
-  
-  if (tcp_info_ == nullptr) {
-    auto* p = CreateMaybeMessage<::appguard::AppGuardTcpInfo>(GetArena());
-    tcp_info_ = p;
-  }
-  return tcp_info_;
+inline ::appguard::AppGuardHttpResponse* AppGuardHttpResponseBatch::add_responses() {
+  // @@protoc_insertion_point(field_add:appguard.AppGuardHttpResponseBatch.responses)
+  return _internal_add_responses();
 }
-inline ::appguard::AppGuardTcpInfo* AppGuardSmtpRequest::mutable_tcp_info() {
-  // @@protoc_insertion_point(field_mutable:appguard.AppGuardSmtpRequest.tcp_info)
-  return _internal_mutable_tcp_info();
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::appguard::AppGuardHttpResponse >&
+AppGuardHttpResponseBatch::responses() const {
+  // @@protoc_insertion_point(field_list:appguard.AppGuardHttpResponseBatch.responses)
+  return responses_;
 }
-inline void AppGuardSmtpRequest::set_allocated_tcp_info(::appguard::AppGuardTcpInfo* tcp_info) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
-  if (message_arena == nullptr) {
-    delete tcp_info_;
-  }
-  if (tcp_info) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(tcp_info);
-    if (message_arena != submessage_arena) {
-      tcp_info = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, tcp_info, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  tcp_info_ = tcp_info;
-  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardSmtpRequest.tcp_info)
+
+// -------------------------------------------------------------------
+
+// AppGuardResponseBatch
+
+// repeated .appguard.AppGuardResponse responses = 1;
+inline int AppGuardResponseBatch::_internal_responses_size() const {
+  return responses_.size();
+}
+inline int AppGuardResponseBatch::responses_size() const {
+  return _internal_responses_size();
+}
+inline void AppGuardResponseBatch::clear_responses() {
+  responses_.Clear();
+}
+inline ::appguard::AppGuardResponse* AppGuardResponseBatch::mutable_responses(int index) {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardResponseBatch.responses)
+  return responses_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::appguard::AppGuardResponse >*
+AppGuardResponseBatch::mutable_responses() {
+  // @@protoc_insertion_point(field_mutable_list:appguard.AppGuardResponseBatch.responses)
+  return &responses_;
+}
+inline const ::appguard::AppGuardResponse& AppGuardResponseBatch::_internal_responses(int index) const {
+  return responses_.Get(index);
+}
+inline const ::appguard::AppGuardResponse& AppGuardResponseBatch::responses(int index) const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardResponseBatch.responses)
+  return _internal_responses(index);
+}
+inline ::appguard::AppGuardResponse* AppGuardResponseBatch::_internal_add_responses() {
+  return responses_.Add();
+}
+inline ::appguard::AppGuardResponse* AppGuardResponseBatch::add_responses() {
+  // @@protoc_insertion_point(field_add:appguard.AppGuardResponseBatch.responses)
+  return _internal_add_responses();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::appguard::AppGuardResponse >&
+AppGuardResponseBatch::responses() const {
+  // @@protoc_insertion_point(field_list:appguard.AppGuardResponseBatch.responses)
+  return responses_;
 }
 
 // -------------------------------------------------------------------
 
-// AppGuardSmtpResponse
+// AppGuardDecisionRequest
 
-// string token = 1;
-inline void AppGuardSmtpResponse::clear_token() {
+// uint64 id = 1;
+inline void AppGuardDecisionRequest::clear_id() {
+  id_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 AppGuardDecisionRequest::_internal_id() const {
+  return id_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 AppGuardDecisionRequest::id() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardDecisionRequest.id)
+  return _internal_id();
+}
+inline void AppGuardDecisionRequest::_internal_set_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  id_ = value;
+}
+inline void AppGuardDecisionRequest::set_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:appguard.AppGuardDecisionRequest.id)
+}
+
+// string token = 2;
+inline void AppGuardDecisionRequest::clear_token() {
   token_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline const std::string& AppGuardSmtpResponse::token() const {
-  // @@protoc_insertion_point(field_get:appguard.AppGuardSmtpResponse.token)
+inline const std::string& AppGuardDecisionRequest::token() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardDecisionRequest.token)
   return _internal_token();
 }
-inline void AppGuardSmtpResponse::set_token(const std::string& value) {
+inline void AppGuardDecisionRequest::set_token(const std::string& value) {
   _internal_set_token(value);
-  // @@protoc_insertion_point(field_set:appguard.AppGuardSmtpResponse.token)
+  // @@protoc_insertion_point(field_set:appguard.AppGuardDecisionRequest.token)
 }
-inline std::string* AppGuardSmtpResponse::mutable_token() {
-  // @@protoc_insertion_point(field_mutable:appguard.AppGuardSmtpResponse.token)
+inline std::string* AppGuardDecisionRequest::mutable_token() {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardDecisionRequest.token)
   return _internal_mutable_token();
 }
-inline const std::string& AppGuardSmtpResponse::_internal_token() const {
+inline const std::string& AppGuardDecisionRequest::_internal_token() const {
   return token_.Get();
 }
-inline void AppGuardSmtpResponse::_internal_set_token(const std::string& value) {
+inline void AppGuardDecisionRequest::_internal_set_token(const std::string& value) {
   
   token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
 }
-inline void AppGuardSmtpResponse::set_token(std::string&& value) {
+inline void AppGuardDecisionRequest::set_token(std::string&& value) {
   
   token_.Set(
     &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardSmtpResponse.token)
+  // @@protoc_insertion_point(field_set_rvalue:appguard.AppGuardDecisionRequest.token)
 }
-inline void AppGuardSmtpResponse::set_token(const char* value) {
+inline void AppGuardDecisionRequest::set_token(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   
   token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
               GetArena());
-  // @@protoc_insertion_point(field_set_char:appguard.AppGuardSmtpResponse.token)
+  // @@protoc_insertion_point(field_set_char:appguard.AppGuardDecisionRequest.token)
 }
-inline void AppGuardSmtpResponse::set_token(const char* value,
+inline void AppGuardDecisionRequest::set_token(const char* value,
     size_t size) {
   
   token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
       reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardSmtpResponse.token)
+  // @@protoc_insertion_point(field_set_pointer:appguard.AppGuardDecisionRequest.token)
 }
-inline std::string* AppGuardSmtpResponse::_internal_mutable_token() {
+inline std::string* AppGuardDecisionRequest::_internal_mutable_token() {
   
   return token_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline std::string* AppGuardSmtpResponse::release_token() {
-  // @@protoc_insertion_point(field_release:appguard.AppGuardSmtpResponse.token)
+inline std::string* AppGuardDecisionRequest::release_token() {
+  // @@protoc_insertion_point(field_release:appguard.AppGuardDecisionRequest.token)
   return token_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void AppGuardSmtpResponse::set_allocated_token(std::string* token) {
+inline void AppGuardDecisionRequest::set_allocated_token(std::string* token) {
   if (token != nullptr) {
     
   } else {
@@ -5723,16 +7782,16 @@ inline void AppGuardSmtpResponse::set_allocated_token(std::string* token) {
   }
   token_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), token,
       GetArena());
-  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardSmtpResponse.token)
+  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardDecisionRequest.token)
 }
-inline std::string* AppGuardSmtpResponse::unsafe_arena_release_token() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardSmtpResponse.token)
+inline std::string* AppGuardDecisionRequest::unsafe_arena_release_token() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardDecisionRequest.token)
   GOOGLE_DCHECK(GetArena() != nullptr);
   
   return token_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       GetArena());
 }
-inline void AppGuardSmtpResponse::unsafe_arena_set_allocated_token(
+inline void AppGuardDecisionRequest::unsafe_arena_set_allocated_token(
     std::string* token) {
   GOOGLE_DCHECK(GetArena() != nullptr);
   if (token != nullptr) {
@@ -5742,227 +7801,416 @@ inline void AppGuardSmtpResponse::unsafe_arena_set_allocated_token(
   }
   token_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       token, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardSmtpResponse.token)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardDecisionRequest.token)
 }
 
-// uint32 code = 2;
-inline bool AppGuardSmtpResponse::_internal_has_code() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
-  return value;
+// .appguard.AppGuardTcpConnection tcp_connection = 3;
+inline bool AppGuardDecisionRequest::_internal_has_tcp_connection() const {
+  return payload_case() == kTcpConnection;
 }
-inline bool AppGuardSmtpResponse::has_code() const {
-  return _internal_has_code();
+inline bool AppGuardDecisionRequest::has_tcp_connection() const {
+  return _internal_has_tcp_connection();
 }
-inline void AppGuardSmtpResponse::clear_code() {
-  code_ = 0u;
-  _has_bits_[0] &= ~0x00000001u;
+inline void AppGuardDecisionRequest::set_has_tcp_connection() {
+  _oneof_case_[0] = kTcpConnection;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 AppGuardSmtpResponse::_internal_code() const {
-  return code_;
+inline void AppGuardDecisionRequest::clear_tcp_connection() {
+  if (_internal_has_tcp_connection()) {
+    if (GetArena() == nullptr) {
+      delete payload_.tcp_connection_;
+    }
+    clear_has_payload();
+  }
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 AppGuardSmtpResponse::code() const {
-  // @@protoc_insertion_point(field_get:appguard.AppGuardSmtpResponse.code)
-  return _internal_code();
+inline ::appguard::AppGuardTcpConnection* AppGuardDecisionRequest::release_tcp_connection() {
+  // @@protoc_insertion_point(field_release:appguard.AppGuardDecisionRequest.tcp_connection)
+  if (_internal_has_tcp_connection()) {
+    clear_has_payload();
+      ::appguard::AppGuardTcpConnection* temp = payload_.tcp_connection_;
+    if (GetArena() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    payload_.tcp_connection_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline void AppGuardSmtpResponse::_internal_set_code(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _has_bits_[0] |= 0x00000001u;
-  code_ = value;
+inline const ::appguard::AppGuardTcpConnection& AppGuardDecisionRequest::_internal_tcp_connection() const {
+  return _internal_has_tcp_connection()
+      ? *payload_.tcp_connection_
+      : *reinterpret_cast< ::appguard::AppGuardTcpConnection*>(&::appguard::_AppGuardTcpConnection_default_instance_);
 }
-inline void AppGuardSmtpResponse::set_code(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _internal_set_code(value);
-  // @@protoc_insertion_point(field_set:appguard.AppGuardSmtpResponse.code)
+inline const ::appguard::AppGuardTcpConnection& AppGuardDecisionRequest::tcp_connection() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardDecisionRequest.tcp_connection)
+  return _internal_tcp_connection();
 }
-
-// .appguard.AppGuardTcpInfo tcp_info = 100;
-inline bool AppGuardSmtpResponse::_internal_has_tcp_info() const {
-  return this != internal_default_instance() && tcp_info_ != nullptr;
+inline ::appguard::AppGuardTcpConnection* AppGuardDecisionRequest::unsafe_arena_release_tcp_connection() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardDecisionRequest.tcp_connection)
+  if (_internal_has_tcp_connection()) {
+    clear_has_payload();
+    ::appguard::AppGuardTcpConnection* temp = payload_.tcp_connection_;
+    payload_.tcp_connection_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline bool AppGuardSmtpResponse::has_tcp_info() const {
-  return _internal_has_tcp_info();
+inline void AppGuardDecisionRequest::unsafe_arena_set_allocated_tcp_connection(::appguard::AppGuardTcpConnection* tcp_connection) {
+  clear_payload();
+  if (tcp_connection) {
+    set_has_tcp_connection();
+    payload_.tcp_connection_ = tcp_connection;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardDecisionRequest.tcp_connection)
 }
-inline void AppGuardSmtpResponse::clear_tcp_info() {
-  if (GetArena() == nullptr && tcp_info_ != nullptr) {
-    delete tcp_info_;
+inline ::appguard::AppGuardTcpConnection* AppGuardDecisionRequest::_internal_mutable_tcp_connection() {
+  if (!_internal_has_tcp_connection()) {
+    clear_payload();
+    set_has_tcp_connection();
+    payload_.tcp_connection_ = CreateMaybeMessage< ::appguard::AppGuardTcpConnection >(GetArena());
   }
-  tcp_info_ = nullptr;
+  return payload_.tcp_connection_;
 }
-inline const ::appguard::AppGuardTcpInfo& AppGuardSmtpResponse::_internal_tcp_info() const {
-  const ::appguard::AppGuardTcpInfo* p = tcp_info_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::appguard::AppGuardTcpInfo*>(
-      &::appguard::_AppGuardTcpInfo_default_instance_);
+inline ::appguard::AppGuardTcpConnection* AppGuardDecisionRequest::mutable_tcp_connection() {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardDecisionRequest.tcp_connection)
+  return _internal_mutable_tcp_connection();
 }
-inline const ::appguard::AppGuardTcpInfo& AppGuardSmtpResponse::tcp_info() const {
-  // @@protoc_insertion_point(field_get:appguard.AppGuardSmtpResponse.tcp_info)
-  return _internal_tcp_info();
+
+// .appguard.AppGuardHttpRequest http_request = 4;
+inline bool AppGuardDecisionRequest::_internal_has_http_request() const {
+  return payload_case() == kHttpRequest;
 }
-inline void AppGuardSmtpResponse::unsafe_arena_set_allocated_tcp_info(
-    ::appguard::AppGuardTcpInfo* tcp_info) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(tcp_info_);
+inline bool AppGuardDecisionRequest::has_http_request() const {
+  return _internal_has_http_request();
+}
+inline void AppGuardDecisionRequest::set_has_http_request() {
+  _oneof_case_[0] = kHttpRequest;
+}
+inline void AppGuardDecisionRequest::clear_http_request() {
+  if (_internal_has_http_request()) {
+    if (GetArena() == nullptr) {
+      delete payload_.http_request_;
+    }
+    clear_has_payload();
   }
-  tcp_info_ = tcp_info;
-  if (tcp_info) {
-    
+}
+inline ::appguard::AppGuardHttpRequest* AppGuardDecisionRequest::release_http_request() {
+  // @@protoc_insertion_point(field_release:appguard.AppGuardDecisionRequest.http_request)
+  if (_internal_has_http_request()) {
+    clear_has_payload();
+      ::appguard::AppGuardHttpRequest* temp = payload_.http_request_;
+    if (GetArena() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    payload_.http_request_ = nullptr;
+    return temp;
   } else {
-    
+    return nullptr;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardSmtpResponse.tcp_info)
 }
-inline ::appguard::AppGuardTcpInfo* AppGuardSmtpResponse::release_tcp_info() {
-  auto temp = unsafe_arena_release_tcp_info();
-  if (GetArena() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+inline const ::appguard::AppGuardHttpRequest& AppGuardDecisionRequest::_internal_http_request() const {
+  return _internal_has_http_request()
+      ? *payload_.http_request_
+      : *reinterpret_cast< ::appguard::AppGuardHttpRequest*>(&::appguard::_AppGuardHttpRequest_default_instance_);
+}
+inline const ::appguard::AppGuardHttpRequest& AppGuardDecisionRequest::http_request() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardDecisionRequest.http_request)
+  return _internal_http_request();
+}
+inline ::appguard::AppGuardHttpRequest* AppGuardDecisionRequest::unsafe_arena_release_http_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardDecisionRequest.http_request)
+  if (_internal_has_http_request()) {
+    clear_has_payload();
+    ::appguard::AppGuardHttpRequest* temp = payload_.http_request_;
+    payload_.http_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
   }
-  return temp;
 }
-inline ::appguard::AppGuardTcpInfo* AppGuardSmtpResponse::unsafe_arena_release_tcp_info() {
-  // @@protoc_insertion_point(field_release:appguard.AppGuardSmtpResponse.tcp_info)
-  
-  ::appguard::AppGuardTcpInfo* temp = tcp_info_;
-  tcp_info_ = nullptr;
-  return temp;
+inline void AppGuardDecisionRequest::unsafe_arena_set_allocated_http_request(::appguard::AppGuardHttpRequest* http_request) {
+  clear_payload();
+  if (http_request) {
+    set_has_http_request();
+    payload_.http_request_ = http_request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardDecisionRequest.http_request)
 }
-inline ::appguard::AppGuardTcpInfo* AppGuardSmtpResponse::_internal_mutable_tcp_info() {
-  
-  if (tcp_info_ == nullptr) {
-    auto* p = CreateMaybeMessage<::appguard::AppGuardTcpInfo>(GetArena());
-    tcp_info_ = p;
+inline ::appguard::AppGuardHttpRequest* AppGuardDecisionRequest::_internal_mutable_http_request() {
+  if (!_internal_has_http_request()) {
+    clear_payload();
+    set_has_http_request();
+    payload_.http_request_ = CreateMaybeMessage< ::appguard::AppGuardHttpRequest >(GetArena());
   }
-  return tcp_info_;
+  return payload_.http_request_;
 }
-inline ::appguard::AppGuardTcpInfo* AppGuardSmtpResponse::mutable_tcp_info() {
-  // @@protoc_insertion_point(field_mutable:appguard.AppGuardSmtpResponse.tcp_info)
-  return _internal_mutable_tcp_info();
+inline ::appguard::AppGuardHttpRequest* AppGuardDecisionRequest::mutable_http_request() {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardDecisionRequest.http_request)
+  return _internal_mutable_http_request();
 }
-inline void AppGuardSmtpResponse::set_allocated_tcp_info(::appguard::AppGuardTcpInfo* tcp_info) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
-  if (message_arena == nullptr) {
-    delete tcp_info_;
+
+// .appguard.AppGuardHttpResponse http_response = 5;
+inline bool AppGuardDecisionRequest::_internal_has_http_response() const {
+  return payload_case() == kHttpResponse;
+}
+inline bool AppGuardDecisionRequest::has_http_response() const {
+  return _internal_has_http_response();
+}
+inline void AppGuardDecisionRequest::set_has_http_response() {
+  _oneof_case_[0] = kHttpResponse;
+}
+inline void AppGuardDecisionRequest::clear_http_response() {
+  if (_internal_has_http_response()) {
+    if (GetArena() == nullptr) {
+      delete payload_.http_response_;
+    }
+    clear_has_payload();
   }
-  if (tcp_info) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(tcp_info);
-    if (message_arena != submessage_arena) {
-      tcp_info = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, tcp_info, submessage_arena);
+}
+inline ::appguard::AppGuardHttpResponse* AppGuardDecisionRequest::release_http_response() {
+  // @@protoc_insertion_point(field_release:appguard.AppGuardDecisionRequest.http_response)
+  if (_internal_has_http_response()) {
+    clear_has_payload();
+      ::appguard::AppGuardHttpResponse* temp = payload_.http_response_;
+    if (GetArena() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
     }
-    
+    payload_.http_response_ = nullptr;
+    return temp;
   } else {
-    
+    return nullptr;
   }
-  tcp_info_ = tcp_info;
-  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardSmtpResponse.tcp_info)
+}
+inline const ::appguard::AppGuardHttpResponse& AppGuardDecisionRequest::_internal_http_response() const {
+  return _internal_has_http_response()
+      ? *payload_.http_response_
+      : *reinterpret_cast< ::appguard::AppGuardHttpResponse*>(&::appguard::_AppGuardHttpResponse_default_instance_);
+}
+inline const ::appguard::AppGuardHttpResponse& AppGuardDecisionRequest::http_response() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardDecisionRequest.http_response)
+  return _internal_http_response();
+}
+inline ::appguard::AppGuardHttpResponse* AppGuardDecisionRequest::unsafe_arena_release_http_response() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardDecisionRequest.http_response)
+  if (_internal_has_http_response()) {
+    clear_has_payload();
+    ::appguard::AppGuardHttpResponse* temp = payload_.http_response_;
+    payload_.http_response_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void AppGuardDecisionRequest::unsafe_arena_set_allocated_http_response(::appguard::AppGuardHttpResponse* http_response) {
+  clear_payload();
+  if (http_response) {
+    set_has_http_response();
+    payload_.http_response_ = http_response;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardDecisionRequest.http_response)
+}
+inline ::appguard::AppGuardHttpResponse* AppGuardDecisionRequest::_internal_mutable_http_response() {
+  if (!_internal_has_http_response()) {
+    clear_payload();
+    set_has_http_response();
+    payload_.http_response_ = CreateMaybeMessage< ::appguard::AppGuardHttpResponse >(GetArena());
+  }
+  return payload_.http_response_;
+}
+inline ::appguard::AppGuardHttpResponse* AppGuardDecisionRequest::mutable_http_response() {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardDecisionRequest.http_response)
+  return _internal_mutable_http_response();
 }
 
+inline bool AppGuardDecisionRequest::has_payload() const {
+  return payload_case() != PAYLOAD_NOT_SET;
+}
+inline void AppGuardDecisionRequest::clear_has_payload() {
+  _oneof_case_[0] = PAYLOAD_NOT_SET;
+}
+inline AppGuardDecisionRequest::PayloadCase AppGuardDecisionRequest::payload_case() const {
+  return AppGuardDecisionRequest::PayloadCase(_oneof_case_[0]);
+}
 // -------------------------------------------------------------------
 
-// AppGuardResponse
+// AppGuardDecisionResponse
 
-// .appguard_commands.FirewallPolicy policy = 2;
-inline void AppGuardResponse::clear_policy() {
-  policy_ = 0;
+// uint64 id = 1;
+inline void AppGuardDecisionResponse::clear_id() {
+  id_ = PROTOBUF_ULONGLONG(0);
 }
-inline ::appguard_commands::FirewallPolicy AppGuardResponse::_internal_policy() const {
-  return static_cast< ::appguard_commands::FirewallPolicy >(policy_);
+inline ::PROTOBUF_NAMESPACE_ID::uint64 AppGuardDecisionResponse::_internal_id() const {
+  return id_;
 }
-inline ::appguard_commands::FirewallPolicy AppGuardResponse::policy() const {
-  // @@protoc_insertion_point(field_get:appguard.AppGuardResponse.policy)
-  return _internal_policy();
+inline ::PROTOBUF_NAMESPACE_ID::uint64 AppGuardDecisionResponse::id() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardDecisionResponse.id)
+  return _internal_id();
 }
-inline void AppGuardResponse::_internal_set_policy(::appguard_commands::FirewallPolicy value) {
+inline void AppGuardDecisionResponse::_internal_set_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
   
-  policy_ = value;
+  id_ = value;
 }
-inline void AppGuardResponse::set_policy(::appguard_commands::FirewallPolicy value) {
-  _internal_set_policy(value);
-  // @@protoc_insertion_point(field_set:appguard.AppGuardResponse.policy)
+inline void AppGuardDecisionResponse::set_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:appguard.AppGuardDecisionResponse.id)
 }
 
-// -------------------------------------------------------------------
-
-// AppGuardTcpResponse
-
-// .appguard.AppGuardTcpInfo tcp_info = 1;
-inline bool AppGuardTcpResponse::_internal_has_tcp_info() const {
-  return this != internal_default_instance() && tcp_info_ != nullptr;
+// .appguard.AppGuardTcpResponse tcp_response = 2;
+inline bool AppGuardDecisionResponse::_internal_has_tcp_response() const {
+  return payload_case() == kTcpResponse;
 }
-inline bool AppGuardTcpResponse::has_tcp_info() const {
-  return _internal_has_tcp_info();
+inline bool AppGuardDecisionResponse::has_tcp_response() const {
+  return _internal_has_tcp_response();
 }
-inline void AppGuardTcpResponse::clear_tcp_info() {
-  if (GetArena() == nullptr && tcp_info_ != nullptr) {
-    delete tcp_info_;
+inline void AppGuardDecisionResponse::set_has_tcp_response() {
+  _oneof_case_[0] = kTcpResponse;
+}
+inline void AppGuardDecisionResponse::clear_tcp_response() {
+  if (_internal_has_tcp_response()) {
+    if (GetArena() == nullptr) {
+      delete payload_.tcp_response_;
+    }
+    clear_has_payload();
   }
-  tcp_info_ = nullptr;
 }
-inline const ::appguard::AppGuardTcpInfo& AppGuardTcpResponse::_internal_tcp_info() const {
-  const ::appguard::AppGuardTcpInfo* p = tcp_info_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::appguard::AppGuardTcpInfo*>(
-      &::appguard::_AppGuardTcpInfo_default_instance_);
+inline ::appguard::AppGuardTcpResponse* AppGuardDecisionResponse::release_tcp_response() {
+  // @@protoc_insertion_point(field_release:appguard.AppGuardDecisionResponse.tcp_response)
+  if (_internal_has_tcp_response()) {
+    clear_has_payload();
+      ::appguard::AppGuardTcpResponse* temp = payload_.tcp_response_;
+    if (GetArena() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    payload_.tcp_response_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline const ::appguard::AppGuardTcpInfo& AppGuardTcpResponse::tcp_info() const {
-  // @@protoc_insertion_point(field_get:appguard.AppGuardTcpResponse.tcp_info)
-  return _internal_tcp_info();
+inline const ::appguard::AppGuardTcpResponse& AppGuardDecisionResponse::_internal_tcp_response() const {
+  return _internal_has_tcp_response()
+      ? *payload_.tcp_response_
+      : *reinterpret_cast< ::appguard::AppGuardTcpResponse*>(&::appguard::_AppGuardTcpResponse_default_instance_);
 }
-inline void AppGuardTcpResponse::unsafe_arena_set_allocated_tcp_info(
-    ::appguard::AppGuardTcpInfo* tcp_info) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(tcp_info_);
-  }
-  tcp_info_ = tcp_info;
-  if (tcp_info) {
-    
+inline const ::appguard::AppGuardTcpResponse& AppGuardDecisionResponse::tcp_response() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardDecisionResponse.tcp_response)
+  return _internal_tcp_response();
+}
+inline ::appguard::AppGuardTcpResponse* AppGuardDecisionResponse::unsafe_arena_release_tcp_response() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardDecisionResponse.tcp_response)
+  if (_internal_has_tcp_response()) {
+    clear_has_payload();
+    ::appguard::AppGuardTcpResponse* temp = payload_.tcp_response_;
+    payload_.tcp_response_ = nullptr;
+    return temp;
   } else {
-    
+    return nullptr;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardTcpResponse.tcp_info)
 }
-inline ::appguard::AppGuardTcpInfo* AppGuardTcpResponse::release_tcp_info() {
-  auto temp = unsafe_arena_release_tcp_info();
-  if (GetArena() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+inline void AppGuardDecisionResponse::unsafe_arena_set_allocated_tcp_response(::appguard::AppGuardTcpResponse* tcp_response) {
+  clear_payload();
+  if (tcp_response) {
+    set_has_tcp_response();
+    payload_.tcp_response_ = tcp_response;
   }
-  return temp;
-}
-inline ::appguard::AppGuardTcpInfo* AppGuardTcpResponse::unsafe_arena_release_tcp_info() {
-  // @@protoc_insertion_point(field_release:appguard.AppGuardTcpResponse.tcp_info)
-  
-  ::appguard::AppGuardTcpInfo* temp = tcp_info_;
-  tcp_info_ = nullptr;
-  return temp;
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardDecisionResponse.tcp_response)
 }
-inline ::appguard::AppGuardTcpInfo* AppGuardTcpResponse::_internal_mutable_tcp_info() {
-  
-  if (tcp_info_ == nullptr) {
-    auto* p = CreateMaybeMessage<::appguard::AppGuardTcpInfo>(GetArena());
-    tcp_info_ = p;
+inline ::appguard::AppGuardTcpResponse* AppGuardDecisionResponse::_internal_mutable_tcp_response() {
+  if (!_internal_has_tcp_response()) {
+    clear_payload();
+    set_has_tcp_response();
+    payload_.tcp_response_ = CreateMaybeMessage< ::appguard::AppGuardTcpResponse >(GetArena());
   }
-  return tcp_info_;
+  return payload_.tcp_response_;
 }
-inline ::appguard::AppGuardTcpInfo* AppGuardTcpResponse::mutable_tcp_info() {
-  // @@protoc_insertion_point(field_mutable:appguard.AppGuardTcpResponse.tcp_info)
-  return _internal_mutable_tcp_info();
+inline ::appguard::AppGuardTcpResponse* AppGuardDecisionResponse::mutable_tcp_response() {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardDecisionResponse.tcp_response)
+  return _internal_mutable_tcp_response();
 }
-inline void AppGuardTcpResponse::set_allocated_tcp_info(::appguard::AppGuardTcpInfo* tcp_info) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
-  if (message_arena == nullptr) {
-    delete tcp_info_;
+
+// .appguard.AppGuardResponse response = 3;
+inline bool AppGuardDecisionResponse::_internal_has_response() const {
+  return payload_case() == kResponse;
+}
+inline bool AppGuardDecisionResponse::has_response() const {
+  return _internal_has_response();
+}
+inline void AppGuardDecisionResponse::set_has_response() {
+  _oneof_case_[0] = kResponse;
+}
+inline void AppGuardDecisionResponse::clear_response() {
+  if (_internal_has_response()) {
+    if (GetArena() == nullptr) {
+      delete payload_.response_;
+    }
+    clear_has_payload();
   }
-  if (tcp_info) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(tcp_info);
-    if (message_arena != submessage_arena) {
-      tcp_info = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, tcp_info, submessage_arena);
+}
+inline ::appguard::AppGuardResponse* AppGuardDecisionResponse::release_response() {
+  // @@protoc_insertion_point(field_release:appguard.AppGuardDecisionResponse.response)
+  if (_internal_has_response()) {
+    clear_has_payload();
+      ::appguard::AppGuardResponse* temp = payload_.response_;
+    if (GetArena() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
     }
-    
+    payload_.response_ = nullptr;
+    return temp;
   } else {
-    
+    return nullptr;
   }
-  tcp_info_ = tcp_info;
-  // @@protoc_insertion_point(field_set_allocated:appguard.AppGuardTcpResponse.tcp_info)
+}
+inline const ::appguard::AppGuardResponse& AppGuardDecisionResponse::_internal_response() const {
+  return _internal_has_response()
+      ? *payload_.response_
+      : *reinterpret_cast< ::appguard::AppGuardResponse*>(&::appguard::_AppGuardResponse_default_instance_);
+}
+inline const ::appguard::AppGuardResponse& AppGuardDecisionResponse::response() const {
+  // @@protoc_insertion_point(field_get:appguard.AppGuardDecisionResponse.response)
+  return _internal_response();
+}
+inline ::appguard::AppGuardResponse* AppGuardDecisionResponse::unsafe_arena_release_response() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:appguard.AppGuardDecisionResponse.response)
+  if (_internal_has_response()) {
+    clear_has_payload();
+    ::appguard::AppGuardResponse* temp = payload_.response_;
+    payload_.response_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void AppGuardDecisionResponse::unsafe_arena_set_allocated_response(::appguard::AppGuardResponse* response) {
+  clear_payload();
+  if (response) {
+    set_has_response();
+    payload_.response_ = response;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:appguard.AppGuardDecisionResponse.response)
+}
+inline ::appguard::AppGuardResponse* AppGuardDecisionResponse::_internal_mutable_response() {
+  if (!_internal_has_response()) {
+    clear_payload();
+    set_has_response();
+    payload_.response_ = CreateMaybeMessage< ::appguard::AppGuardResponse >(GetArena());
+  }
+  return payload_.response_;
+}
+inline ::appguard::AppGuardResponse* AppGuardDecisionResponse::mutable_response() {
+  // @@protoc_insertion_point(field_mutable:appguard.AppGuardDecisionResponse.response)
+  return _internal_mutable_response();
 }
 
+inline bool AppGuardDecisionResponse::has_payload() const {
+  return payload_case() != PAYLOAD_NOT_SET;
+}
+inline void AppGuardDecisionResponse::clear_has_payload() {
+  _oneof_case_[0] = PAYLOAD_NOT_SET;
+}
+inline AppGuardDecisionResponse::PayloadCase AppGuardDecisionResponse::payload_case() const {
+  return AppGuardDecisionResponse::PayloadCase(_oneof_case_[0]);
+}
 // -------------------------------------------------------------------
 
 // Token
@@ -6081,6 +8329,20 @@ inline void Token::unsafe_arena_set_allocated_token(
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 